@@ -0,0 +1,9 @@
+AC_DEFUN([RTEMS_ENABLE_SMP_MCS_LOCK],
+  [AC_ARG_ENABLE(smp-mcs-lock,
+    [AS_HELP_STRING([--enable-smp-mcs-lock],[use MCS locks instead of ticket locks for the SMP locks (default=no)])],
+    [case "${enableval}" in 
+      yes) RTEMS_HAS_SMP_MCS_LOCK=yes ;;
+      no) RTEMS_HAS_SMP_MCS_LOCK=no ;;
+      *) AC_MSG_ERROR(bad value ${enableval} for enable SMP MCS lock option) ;;
+    esac],
+    [RTEMS_HAS_SMP_MCS_LOCK=no])])
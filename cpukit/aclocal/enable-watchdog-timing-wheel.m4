@@ -0,0 +1,9 @@
+AC_DEFUN([RTEMS_ENABLE_WATCHDOG_TIMING_WHEEL],
+  [AC_ARG_ENABLE(watchdog-timing-wheel,
+    [AS_HELP_STRING([--enable-watchdog-timing-wheel],[use a hierarchical timing wheel for the ticks watchdog chain (default=no)])],
+    [case "${enableval}" in 
+      yes) RTEMS_HAS_WATCHDOG_TIMING_WHEEL=yes ;;
+      no) RTEMS_HAS_WATCHDOG_TIMING_WHEEL=no ;;
+      *) AC_MSG_ERROR(bad value ${enableval} for enable watchdog timing wheel option) ;;
+    esac],
+    [RTEMS_HAS_WATCHDOG_TIMING_WHEEL=no])])
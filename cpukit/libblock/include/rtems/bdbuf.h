@@ -308,8 +308,9 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
- * 'dd' and 'block' are search keys.
+ * speed-up buffer lookup descriptors are organized in AVL-Tree or in a hash
+ * table depending on the configured lookup method. The fields 'dd' and 'block'
+ * are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
@@ -331,6 +332,9 @@ typedef struct rtems_bdbuf_buffer
 
   rtems_bdbuf_buf_state state;           /**< State of the buffer. */
 
+  bool read_ahead;               /**< The buffer was filled by a read-ahead
+                                  * transfer and was not accessed since. */
+
   uint32_t waiters;              /**< The number of threads waiting on this
                                   * buffer. */
   rtems_bdbuf_group* group;      /**< Pointer to the group of BDs this BD is
@@ -360,6 +364,29 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * Buffer descriptor lookup methods.
+ */
+typedef enum {
+  /**
+   * @brief The buffer descriptors are organized in an AVL tree.
+   *
+   * The lookup time is logarithmic in the number of cached buffers.  No
+   * additional memory is required.
+   */
+  RTEMS_BDBUF_LOOKUP_AVL_TREE,
+
+  /**
+   * @brief The buffer descriptors are organized in an open-addressed hash
+   * table.
+   *
+   * The lookup time is constant on average.  The table has at least two
+   * entries for each minimum size buffer and is allocated during
+   * initialization.
+   */
+  RTEMS_BDBUF_LOOKUP_HASH
+} rtems_bdbuf_lookup;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -389,6 +416,23 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  rtems_bdbuf_lookup  lookup;                  /**< Buffer descriptor lookup
+                                                * method. */
+  size_t              shards;                  /**< Number of cache shards.
+                                                * Each shard has its own lock
+                                                * and serves the disks mapped
+                                                * to it. */
+  uint32_t            initial_read_ahead_blocks; /**< Initial read-ahead
+                                                * window of a sequential
+                                                * stream.  The window doubles
+                                                * with each read-ahead
+                                                * transfer up to the maximum
+                                                * read-ahead blocks.  Zero
+                                                * starts with the maximum. */
+  bool                swapout_write_coalescing; /**< If true, then the
+                                                * swap-out writes all
+                                                * modified buffers of a device
+                                                * once one of them is due. */
 } rtems_bdbuf_config;
 
 /**
@@ -461,6 +505,27 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default buffer descriptor lookup method.
+ */
+#define RTEMS_BDBUF_LOOKUP_DEFAULT RTEMS_BDBUF_LOOKUP_AVL_TREE
+
+/**
+ * Default number of cache shards.
+ */
+#define RTEMS_BDBUF_SHARDS_DEFAULT 1
+
+/**
+ * Default initial read-ahead window.  It disables the adaptive read-ahead
+ * window.
+ */
+#define RTEMS_BDBUF_INITIAL_READ_AHEAD_BLOCKS_DEFAULT 0
+
+/**
+ * Default swap-out write coalescing.
+ */
+#define RTEMS_BDBUF_SWAPOUT_WRITE_COALESCING_DEFAULT false
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -470,6 +535,9 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  * @retval RTEMS_CALLED_FROM_ISR Called from an interrupt context.
  * @retval RTEMS_INVALID_NUMBER The buffer maximum is not an integral multiple
  * of the buffer minimum.  The maximum read-ahead blocks count is too large.
+ * The initial read-ahead blocks count is greater than the maximum.
+ * The buffer descriptor lookup method is invalid.  The shard count is zero or
+ * too large for the count of buffer groups.
  * @retval RTEMS_RESOURCE_IN_USE Already initialized.
  * @retval RTEMS_UNSATISFIED Not enough resources.
  */
@@ -648,6 +716,22 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd);
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd);
 
+/**
+ * @brief Assigns a shard of the cache to the disk device @a dd.
+ *
+ * The shards are assigned to the disk devices in a round-robin fashion in
+ * the order of the disk device initialization.  With a single shard all disk
+ * devices use the complete cache.
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in, out] The disk device.
+ */
+void
+rtems_bdbuf_assign_shard (rtems_disk_device *dd);
+
 /**
  * @brief Sets the block size of a disk device.
  *
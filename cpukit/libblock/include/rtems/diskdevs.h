@@ -83,6 +83,15 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Block count of the next read-ahead request.
+   *
+   * The window grows with each read-ahead request of a sequential stream up
+   * to the configured maximum read-ahead blocks.  A value of zero indicates
+   * a new stream which starts with the configured initial read-ahead blocks.
+   */
+  uint32_t window;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -145,6 +154,24 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * block was read by a read-ahead transfer and is accessed the first time.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead miss count.
+   *
+   * A read-ahead miss occurs in the rtems_bdbuf_read() function in case a
+   * read-ahead transfer was issued for the block of a sequential stream, but
+   * the block is in the empty state, so the read-ahead did not keep up with
+   * the reader.
+   */
+  uint32_t read_ahead_misses;
 } rtems_blkdev_stats;
 
 /**
@@ -246,6 +273,13 @@ struct rtems_disk_device {
    */
   size_t bds_per_group;
 
+  /**
+   * @brief Index of the block device cache shard used by this disk.
+   *
+   * @see rtems_bdbuf_assign_shard().
+   */
+  size_t bdbuf_shard;
+
   /**
    * @brief IO control handler for this disk.
    */
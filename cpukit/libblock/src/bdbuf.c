@@ -96,28 +96,15 @@ typedef struct rtems_bdbuf_waiters {
 } rtems_bdbuf_waiters;
 
 /**
- * The BD buffer cache.
+ * A shard of the BD buffer cache. The buffers of the cache are partitioned
+ * into shards. Each disk device uses the buffers of exactly one shard. The
+ * shards have independent locks, lists and waiters so that operations on disk
+ * devices of different shards do not block each other.
  */
-typedef struct rtems_bdbuf_cache
+typedef struct rtems_bdbuf_shard
 {
-  rtems_id            swapout;           /**< Swapout task ID */
-  bool                swapout_enabled;   /**< Swapout is only running if
-                                          * enabled. Set to false to kill the
-                                          * swap out task. It deletes itself. */
-  rtems_chain_control swapout_free_workers; /**< The work threads for the swapout
-                                             * task. */
-
-  rtems_bdbuf_buffer* bds;               /**< Pointer to table of buffer
-                                          * descriptors. */
-  void*               buffers;           /**< The buffer's memory. */
-  size_t              buffer_min_count;  /**< Number of minimum size buffers
-                                          * that fit the buffer memory. */
-  size_t              max_bds_per_group; /**< The number of BDs of minimum
-                                          * buffer size that fit in a group. */
-  uint32_t            flags;             /**< Configuration flags. */
-
-  rtems_bdbuf_lock_type lock;            /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_bdbuf_lock_type lock;            /**< The shard lock. It locks all
+                                          * shard data, BD and lists. */
   rtems_bdbuf_lock_type sync_lock;       /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -126,7 +113,14 @@ typedef struct rtems_bdbuf_cache
                                           * sync. */
 
   rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
+                                          * root. There is one per shard. */
+  rtems_bdbuf_buffer** hash;             /**< Buffer descriptor lookup hash
+                                          * table. It is NULL if the AVL tree
+                                          * is used. */
+  size_t              hash_size;         /**< The number of hash table
+                                          * entries. It is a power of two. */
+  int                 hash_shift;        /**< Shift to get a hash table index
+                                          * from a 32-bit hash value. */
   rtems_chain_control lru;               /**< Least recently used list */
   rtems_chain_control modified;          /**< Modified buffers list */
   rtems_chain_control sync;              /**< Buffers to sync list */
@@ -140,13 +134,48 @@ typedef struct rtems_bdbuf_cache
   rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
                                           * available. */
 
+  rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
+} rtems_bdbuf_shard;
+
+/**
+ * The BD buffer cache.
+ */
+typedef struct rtems_bdbuf_cache
+{
+  rtems_id            swapout;           /**< Swapout task ID */
+  bool                swapout_enabled;   /**< Swapout is only running if
+                                          * enabled. Set to false to kill the
+                                          * swap out task. It deletes itself. */
+  rtems_chain_control swapout_free_workers; /**< The work threads for the swapout
+                                             * task. The chain is accessed
+                                             * with the protected chain
+                                             * operations since it is shared
+                                             * by all shards. */
+
+  rtems_bdbuf_buffer* bds;               /**< Pointer to table of buffer
+                                          * descriptors. */
+  void*               buffers;           /**< The buffer's memory. */
+  size_t              buffer_min_count;  /**< Number of minimum size buffers
+                                          * that fit the buffer memory. */
+  size_t              max_bds_per_group; /**< The number of BDs of minimum
+                                          * buffer size that fit in a group. */
+  uint32_t            flags;             /**< Configuration flags. */
+
+  rtems_bdbuf_shard*  shards;            /**< The shards. */
+  size_t              shard_count;       /**< The number of shards. */
+  size_t              shard_bd_count;    /**< The number of BDs of each
+                                          * shard. The last shard owns also
+                                          * the remaining BDs. */
+  size_t              next_shard;        /**< The shard of the next disk
+                                          * device. Protected by the lock of
+                                          * the first shard. */
+
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
 
   size_t              group_count;       /**< The number of groups. */
   rtems_bdbuf_group*  groups;            /**< The groups. */
   rtems_id            read_ahead_task;   /**< Read-ahead task */
-  rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
   bool                read_ahead_enabled; /**< Read-ahead enabled */
   rtems_status_code   init_status;       /**< The initialization status */
 } rtems_bdbuf_cache;
@@ -270,16 +299,27 @@ rtems_bdbuf_show_usage (void)
   uint32_t total = 0;
   uint32_t val;
 
+  uint32_t lru = 0;
+  uint32_t mod = 0;
+  uint32_t sync = 0;
+  size_t   s;
+
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    lru += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].lru);
+    mod += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].modified);
+    sync += rtems_bdbuf_list_count (&bdbuf_cache.shards[s].sync);
+  }
+  val = lru;
   printf (", lru=%lu", val);
   total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
+  val = mod;
   printf (", mod=%lu", val);
   total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
+  val = sync;
   printf (", sync=%lu", val);
   total += val;
   printf (", total=%lu\n", total);
@@ -898,6 +938,235 @@ rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
   return 0;
 }
 
+/**
+ * Returns the home index of the dd/block key in the hash table.
+ *
+ * The key is mixed with a Fibonacci hash so that consecutive block numbers are
+ * spread over the table.
+ *
+ * @param shard the shard of the hash table
+ * @param dd disk device key
+ * @param block block key
+ * @return the hash table index
+ */
+static size_t
+rtems_bdbuf_hash_index (const rtems_bdbuf_shard *shard,
+                        const rtems_disk_device *dd,
+                        rtems_blkdev_bnum        block)
+{
+  uint32_t key = (uint32_t) block ^ (uint32_t) ((uintptr_t) dd >> 4);
+
+  return (size_t) ((key * UINT32_C (0x9e3779b1)) >> shard->hash_shift);
+}
+
+static size_t
+rtems_bdbuf_hash_next (const rtems_bdbuf_shard *shard, size_t index)
+{
+  return (index + 1) & (shard->hash_size - 1);
+}
+
+/**
+ * Searches for the node with specified dd/block in the hash table.
+ *
+ * @param shard the shard of the hash table
+ * @param dd disk device search key
+ * @param block block search key
+ * @retval NULL node with the specified dd/block is not found
+ * @return pointer to the node with specified dd/block
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_search (const rtems_bdbuf_shard *shard,
+                         const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  rtems_bdbuf_buffer** table = shard->hash;
+  size_t               index = rtems_bdbuf_hash_index (shard, dd, block);
+  rtems_bdbuf_buffer*  p;
+
+  while ((p = table[index]) != NULL)
+  {
+    if ((p->dd == dd) && (p->block == block))
+      return p;
+
+    index = rtems_bdbuf_hash_next (shard, index);
+  }
+
+  return NULL;
+}
+
+/**
+ * Inserts the specified node into the hash table. The table has at least
+ * twice as many entries as there are buffer descriptors, so there is always
+ * a free entry.
+ *
+ * @param shard the shard of the hash table
+ * @param node Pointer to the node to add
+ * @retval 0 The node added successfully
+ * @retval -1 An error occured
+ */
+static int
+rtems_bdbuf_hash_insert (const rtems_bdbuf_shard *shard,
+                         rtems_bdbuf_buffer*      node)
+{
+  rtems_bdbuf_buffer** table = shard->hash;
+  size_t               index =
+    rtems_bdbuf_hash_index (shard, node->dd, node->block);
+  rtems_bdbuf_buffer*  p;
+
+  while ((p = table[index]) != NULL)
+  {
+    if ((p->dd == node->dd) && (p->block == node->block))
+      return -1;
+
+    index = rtems_bdbuf_hash_next (shard, index);
+  }
+
+  table[index] = node;
+
+  return 0;
+}
+
+/**
+ * Removes the node from the hash table. The entries following the removed
+ * node in its probe sequence are moved back so that no deleted markers are
+ * necessary.
+ *
+ * @param shard the shard of the hash table
+ * @param node Pointer to the node to remove
+ * @retval 0 Item removed
+ * @retval -1 No such item found
+ */
+static int
+rtems_bdbuf_hash_remove (const rtems_bdbuf_shard  *shard,
+                         const rtems_bdbuf_buffer* node)
+{
+  rtems_bdbuf_buffer** table = shard->hash;
+  size_t               hole =
+    rtems_bdbuf_hash_index (shard, node->dd, node->block);
+  size_t               index;
+  rtems_bdbuf_buffer*  p;
+
+  while (table[hole] != node)
+  {
+    if (table[hole] == NULL)
+      return -1;
+
+    hole = rtems_bdbuf_hash_next (shard, hole);
+  }
+
+  index = hole;
+
+  while (true)
+  {
+    size_t home;
+
+    index = rtems_bdbuf_hash_next (shard, index);
+    p = table[index];
+
+    if (p == NULL)
+      break;
+
+    home = rtems_bdbuf_hash_index (shard, p->dd, p->block);
+
+    /*
+     * The entry may move into the hole if its home index is not cyclically
+     * in the range (hole, index].
+     */
+    if ((hole < index && (home <= hole || home > index))
+        || (hole > index && (home <= hole && home > index)))
+    {
+      table[hole] = p;
+      hole = index;
+    }
+  }
+
+  table[hole] = NULL;
+
+  return 0;
+}
+
+static rtems_bdbuf_buffer *
+rtems_bdbuf_index_search (rtems_bdbuf_shard       *shard,
+                          const rtems_disk_device *dd,
+                          rtems_blkdev_bnum        block)
+{
+  if (shard->hash != NULL)
+    return rtems_bdbuf_hash_search (shard, dd, block);
+  else
+    return rtems_bdbuf_avl_search (&shard->tree, dd, block);
+}
+
+static int
+rtems_bdbuf_index_insert (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer* node)
+{
+  if (shard->hash != NULL)
+    return rtems_bdbuf_hash_insert (shard, node);
+  else
+    return rtems_bdbuf_avl_insert (&shard->tree, node);
+}
+
+static int
+rtems_bdbuf_index_remove (rtems_bdbuf_shard        *shard,
+                          const rtems_bdbuf_buffer* node)
+{
+  if (shard->hash != NULL)
+    return rtems_bdbuf_hash_remove (shard, node);
+  else
+    return rtems_bdbuf_avl_remove (&shard->tree, node);
+}
+
+/**
+ * Returns the shard used for the buffers of the disk device. The shard was
+ * assigned by rtems_bdbuf_assign_shard().
+ *
+ * @param dd The disk device.
+ * @return The shard of the disk device.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_disk_shard (const rtems_disk_device *dd)
+{
+  return &bdbuf_cache.shards [dd->bdbuf_shard];
+}
+
+/**
+ * Returns the shard which owns the buffer. Each shard owns a contiguous range
+ * of the buffer descriptors. The last shard owns also the buffer descriptors
+ * past the groups divided equally between the shards.
+ *
+ * @param bd The buffer.
+ * @return The shard of the buffer.
+ */
+static rtems_bdbuf_shard *
+rtems_bdbuf_buffer_shard (const rtems_bdbuf_buffer *bd)
+{
+  size_t index = bdbuf_cache.shard_count - 1;
+
+  if (bdbuf_cache.shard_bd_count != 0)
+  {
+    size_t b = (size_t) (bd - bdbuf_cache.bds) / bdbuf_cache.shard_bd_count;
+
+    if (b < index)
+      index = b;
+  }
+
+  return &bdbuf_cache.shards [index];
+}
+
+/**
+ * Returns the number of buffer descriptors owned by the shard.
+ *
+ * @param s The shard index.
+ * @return The number of buffer descriptors of the shard.
+ */
+static size_t
+rtems_bdbuf_shard_bd_count (size_t s)
+{
+  if (s < bdbuf_cache.shard_count - 1)
+    return bdbuf_cache.shard_bd_count;
+  else
+    return bdbuf_cache.buffer_min_count - s * bdbuf_cache.shard_bd_count;
+}
+
 static void
 rtems_bdbuf_set_state (rtems_bdbuf_buffer *bd, rtems_bdbuf_buf_state state)
 {
@@ -961,39 +1230,39 @@ rtems_bdbuf_unlock (rtems_bdbuf_lock_type *lock, uint32_t fatal_error_code)
 }
 
 /**
- * Lock the cache. A single task can nest calls.
+ * Lock the cache shard. A single task can nest calls.
  */
 static void
-rtems_bdbuf_lock_cache (void)
+rtems_bdbuf_lock_cache (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_lock (&bdbuf_cache.lock, RTEMS_BDBUF_FATAL_CACHE_LOCK);
+  rtems_bdbuf_lock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_LOCK);
 }
 
 /**
- * Unlock the cache.
+ * Unlock the cache shard.
  */
 static void
-rtems_bdbuf_unlock_cache (void)
+rtems_bdbuf_unlock_cache (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_unlock (&bdbuf_cache.lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
+  rtems_bdbuf_unlock (&shard->lock, RTEMS_BDBUF_FATAL_CACHE_UNLOCK);
 }
 
 /**
- * Lock the cache's sync. A single task can nest calls.
+ * Lock the cache shard's sync. A single task can nest calls.
  */
 static void
-rtems_bdbuf_lock_sync (void)
+rtems_bdbuf_lock_sync (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_lock (&bdbuf_cache.sync_lock, RTEMS_BDBUF_FATAL_SYNC_LOCK);
+  rtems_bdbuf_lock (&shard->sync_lock, RTEMS_BDBUF_FATAL_SYNC_LOCK);
 }
 
 /**
- * Unlock the cache's sync lock. Any blocked writers are woken.
+ * Unlock the cache shard's sync lock. Any blocked writers are woken.
  */
 static void
-rtems_bdbuf_unlock_sync (void)
+rtems_bdbuf_unlock_sync (rtems_bdbuf_shard *shard)
 {
-  rtems_bdbuf_unlock (&bdbuf_cache.sync_lock,
+  rtems_bdbuf_unlock (&shard->sync_lock,
                       RTEMS_BDBUF_FATAL_SYNC_UNLOCK);
 }
 
@@ -1050,7 +1319,8 @@ rtems_bdbuf_restore_preemption (rtems_mode prev_mode)
  * exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard   *shard,
+                            rtems_bdbuf_waiters *waiters)
 {
   /*
    * Indicate we are waiting.
@@ -1059,7 +1329,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
 
 #if defined(RTEMS_BDBUF_USE_PTHREAD)
   {
-    int eno = pthread_cond_wait (&waiters->cond_var, &bdbuf_cache.lock);
+    int eno = pthread_cond_wait (&waiters->cond_var, &shard->lock);
     if (eno != 0)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CV_WAIT);
   }
@@ -1083,7 +1353,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     /*
      * Unlock the cache, wait, and lock the cache when we return.
      */
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache (shard);
 
     sc = rtems_semaphore_obtain (waiters->sema, RTEMS_WAIT, RTEMS_BDBUF_WAIT_TIMEOUT);
 
@@ -1093,7 +1363,7 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
     if (sc != RTEMS_UNSATISFIED)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_CACHE_WAIT_2);
 
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_cache (shard);
 
     rtems_bdbuf_restore_preemption (prev_mode);
   }
@@ -1103,11 +1373,13 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
 }
 
 static void
-rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_wait (rtems_bdbuf_shard   *shard,
+                  rtems_bdbuf_buffer  *bd,
+                  rtems_bdbuf_waiters *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (shard, waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -1143,27 +1415,28 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (rtems_bdbuf_shard *shard)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return shard->buffer_waiters.count;
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_remove (shard, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_shard  *shard,
+                                           rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_tree (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -1173,10 +1446,11 @@ rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_shard  *shard,
+                                           rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&shard->lru, &bd->link);
 }
 
 static void
@@ -1186,38 +1460,40 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_shard  *shard,
+                                             rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_append_unprotected (&shard->lru, &bd->link);
 }
 
 static void
-rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_make_empty (bd);
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_remove_from_tree (shard, bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
   }
 }
 
 static void
-rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_shard  *shard,
+                                               rtems_bdbuf_buffer *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  if (shard->sync_active && shard->sync_device == bd->dd)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache (shard);
 
     /*
      * Wait for the sync lock.
      */
-    rtems_bdbuf_lock_sync ();
+    rtems_bdbuf_lock_sync (shard);
 
-    rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_unlock_sync (shard);
+    rtems_bdbuf_lock_cache (shard);
   }
 
   /*
@@ -1236,24 +1512,25 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&shard->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&shard->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (shard))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
-rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_shard  *shard,
+                                          rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+  rtems_bdbuf_make_cached_and_add_to_lru_list (shard, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
@@ -1281,28 +1558,32 @@ rtems_bdbuf_bds_per_group (size_t size)
 }
 
 static void
-rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_shard  *shard,
+                                         rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_discard_buffer (bd);
+  rtems_bdbuf_discard_buffer (shard, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
  * from the ALV tree and any lists then the new BD's are prepended to the ready
- * list of the cache.
+ * list of the cache shard.
  *
+ * @param shard The shard of the group.
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
  * @return A buffer of this group.
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
+rtems_bdbuf_group_realloc (rtems_bdbuf_shard* shard,
+                           rtems_bdbuf_group* group,
+                           size_t             new_bds_per_group)
 {
   rtems_bdbuf_buffer* bd;
   size_t              b;
@@ -1318,7 +1599,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1326,16 +1607,17 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 1, bd = group->bdbuf + bufs_per_bd;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 
   return group->bdbuf;
 }
 
 static void
-rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
+rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_shard  *shard,
+                                rtems_bdbuf_buffer *bd,
                                 rtems_disk_device  *dd,
                                 rtems_blkdev_bnum   block)
 {
@@ -1344,20 +1626,22 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
   bd->avl.left  = NULL;
   bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->read_ahead = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_insert (shard, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (&shard->lru);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (&shard->lru, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1375,17 +1659,18 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
 
         empty_bd = bd;
       }
       else if (bd->group->users == 0)
-        empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
+        empty_bd = rtems_bdbuf_group_realloc (shard, bd->group,
+                                              dd->bds_per_group);
     }
 
     if (empty_bd != NULL)
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+      rtems_bdbuf_setup_empty_buffer (shard, empty_bd, dd, block);
 
       return empty_bd;
     }
@@ -1487,7 +1772,7 @@ rtems_bdbuf_swapout_workers_create (void)
     {
       rtems_bdbuf_swapout_transfer_init (&worker->transfer, worker->id);
 
-      rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers, &worker->link);
+      rtems_chain_append (&bdbuf_cache.swapout_free_workers, &worker->link);
       worker->enabled = true;
 
       sc = rtems_task_start (worker->id,
@@ -1509,10 +1794,12 @@ rtems_bdbuf_read_request_size (uint32_t transfer_count)
 static rtems_status_code
 rtems_bdbuf_do_init (void)
 {
+  rtems_bdbuf_shard*  shard;
   rtems_bdbuf_group*  group;
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  size_t              s;
   size_t              cache_aligment;
   rtems_status_code   sc;
 
@@ -1533,6 +1820,17 @@ rtems_bdbuf_do_init (void)
       > RTEMS_MINIMUM_STACK_SIZE / 8U)
     return RTEMS_INVALID_NUMBER;
 
+  if (bdbuf_config.lookup != RTEMS_BDBUF_LOOKUP_AVL_TREE
+      && bdbuf_config.lookup != RTEMS_BDBUF_LOOKUP_HASH)
+    return RTEMS_INVALID_NUMBER;
+
+  if (bdbuf_config.shards == 0)
+    return RTEMS_INVALID_NUMBER;
+
+  if (bdbuf_config.initial_read_ahead_blocks
+      > bdbuf_config.max_read_ahead_blocks)
+    return RTEMS_INVALID_NUMBER;
+
   /*
    * For unspecified cache alignments we use the CPU alignment.
    */
@@ -1540,54 +1838,97 @@ rtems_bdbuf_do_init (void)
   if (cache_aligment <= 0)
     cache_aligment = CPU_ALIGNMENT;
 
-  bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
+  /*
+   * Compute the various number of elements in the cache. Each shard owns the
+   * same number of groups. The last shard owns also the remaining groups and
+   * buffers.
+   */
+  bdbuf_cache.buffer_min_count =
+    bdbuf_config.size / bdbuf_config.buffer_min;
+  bdbuf_cache.max_bds_per_group =
+    bdbuf_config.buffer_max / bdbuf_config.buffer_min;
+  bdbuf_cache.group_count =
+    bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
+  bdbuf_cache.shard_count = bdbuf_config.shards;
+  bdbuf_cache.shard_bd_count =
+    (bdbuf_cache.group_count / bdbuf_cache.shard_count)
+      * bdbuf_cache.max_bds_per_group;
+
+  if (bdbuf_cache.shard_count > 1 && bdbuf_cache.shard_bd_count == 0)
+    return RTEMS_INVALID_NUMBER;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
-  rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   /*
-   * Create the locks for the cache.
+   * Allocate the memory for the shards.
    */
-
-  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 'l'),
-                                &bdbuf_cache.lock);
-  if (sc != RTEMS_SUCCESSFUL)
+  bdbuf_cache.shards = calloc (sizeof (rtems_bdbuf_shard),
+                               bdbuf_cache.shard_count);
+  if (!bdbuf_cache.shards)
     goto error;
 
-  rtems_bdbuf_lock_cache ();
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    shard = &bdbuf_cache.shards[s];
 
-  sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 's'),
-                                &bdbuf_cache.sync_lock);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+    shard->sync_device = BDBUF_INVALID_DEV;
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
-                                  &bdbuf_cache.access_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+    rtems_chain_initialize_empty (&shard->lru);
+    rtems_chain_initialize_empty (&shard->modified);
+    rtems_chain_initialize_empty (&shard->sync);
+    rtems_chain_initialize_empty (&shard->read_ahead_chain);
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
-                                  &bdbuf_cache.transfer_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+    /*
+     * Create the locks for the shard.
+     */
 
-  sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
-                                  &bdbuf_cache.buffer_waiters);
-  if (sc != RTEMS_SUCCESSFUL)
-    goto error;
+    sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 'l'),
+                                  &shard->lock);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
 
-  /*
-   * Compute the various number of elements in the cache.
-   */
-  bdbuf_cache.buffer_min_count =
-    bdbuf_config.size / bdbuf_config.buffer_min;
-  bdbuf_cache.max_bds_per_group =
-    bdbuf_config.buffer_max / bdbuf_config.buffer_min;
-  bdbuf_cache.group_count =
-    bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
+    rtems_bdbuf_lock_cache (shard);
+
+    sc = rtems_bdbuf_lock_create (rtems_build_name ('B', 'D', 'C', 's'),
+                                  &shard->sync_lock);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'a'),
+                                    &shard->access_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 't'),
+                                    &shard->transfer_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    sc = rtems_bdbuf_waiter_create (rtems_build_name ('B', 'D', 'C', 'b'),
+                                    &shard->buffer_waiters);
+    if (sc != RTEMS_SUCCESSFUL)
+      goto error;
+
+    /*
+     * Allocate the hash table if configured. Each buffer descriptor can be in
+     * the table only once and the table is kept at most half full so that the
+     * probe sequences stay short.
+     */
+    if (bdbuf_config.lookup == RTEMS_BDBUF_LOOKUP_HASH)
+    {
+      size_t bd_count = rtems_bdbuf_shard_bd_count (s);
+      int    hash_bits = 1;
+
+      while (hash_bits < 31 && ((size_t) 1 << hash_bits) < 2 * bd_count)
+        ++hash_bits;
+
+      shard->hash_size = (size_t) 1 << hash_bits;
+      shard->hash_shift = 32 - hash_bits;
+      shard->hash = calloc (sizeof (rtems_bdbuf_buffer*), shard->hash_size);
+      if (!shard->hash)
+        goto error;
+    }
+  }
 
   /*
    * Allocate the memory for the buffer descriptors.
@@ -1619,7 +1960,8 @@ rtems_bdbuf_do_init (void)
 
   /*
    * The cache is empty after opening so we need to add all the buffers to it
-   * and initialise the groups.
+   * and initialise the groups. The buffers are distributed in contiguous
+   * ranges to the shards.
    */
   for (b = 0, group = bdbuf_cache.groups,
          bd = bdbuf_cache.bds, buffer = bdbuf_cache.buffers;
@@ -1630,7 +1972,8 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    shard = rtems_bdbuf_buffer_shard (bd);
+    rtems_chain_append_unprotected (&shard->lru, &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
@@ -1698,7 +2041,8 @@ rtems_bdbuf_do_init (void)
       goto error;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+    rtems_bdbuf_unlock_cache (&bdbuf_cache.shards[s]);
 
   return RTEMS_SUCCESSFUL;
 
@@ -1734,15 +2078,27 @@ error:
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
 
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.buffer_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.access_waiters);
-  rtems_bdbuf_waiter_delete (&bdbuf_cache.transfer_waiters);
-  rtems_bdbuf_lock_delete (&bdbuf_cache.sync_lock);
-
-  if (bdbuf_cache.lock != 0)
+  if (bdbuf_cache.shards)
   {
-    rtems_bdbuf_unlock_cache ();
-    rtems_bdbuf_lock_delete (&bdbuf_cache.lock);
+    for (s = 0; s < bdbuf_cache.shard_count; s++)
+    {
+      shard = &bdbuf_cache.shards[s];
+
+      free (shard->hash);
+
+      rtems_bdbuf_waiter_delete (&shard->buffer_waiters);
+      rtems_bdbuf_waiter_delete (&shard->access_waiters);
+      rtems_bdbuf_waiter_delete (&shard->transfer_waiters);
+      rtems_bdbuf_lock_delete (&shard->sync_lock);
+
+      if (shard->lock != 0)
+      {
+        rtems_bdbuf_unlock_cache (shard);
+        rtems_bdbuf_lock_delete (&shard->lock);
+      }
+    }
+
+    free (bdbuf_cache.shards);
   }
 
   return RTEMS_UNSATISFIED;
@@ -1791,7 +2147,8 @@ rtems_bdbuf_wait_for_transient_event (void)
 }
 
 static void
-rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_access (rtems_bdbuf_shard  *shard,
+                             rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1809,12 +2166,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1823,11 +2180,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_shard  *shard,
+                                              rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1838,7 +2196,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
  * @retval @c false Buffer is invalid and has to searched again.
  */
 static bool
-rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_recycle (rtems_bdbuf_shard  *shard,
+                              rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1847,7 +2206,7 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_FREE:
         return true;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        rtems_bdbuf_request_sync_for_modified_buffer (bd);
+        rtems_bdbuf_request_sync_for_modified_buffer (shard, bd);
         break;
       case RTEMS_BDBUF_STATE_CACHED:
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -1861,19 +2220,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1882,7 +2241,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_shard  *shard,
+                                rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1899,7 +2259,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1908,26 +2268,27 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_shard *shard)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&shard->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_sync_after_access (rtems_bdbuf_shard  *shard,
+                               rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_wait_for_sync_done (bd);
+  rtems_bdbuf_wait_for_sync_done (shard, bd);
 
   /*
    * We may have created a cached or empty buffer which may be recycled.
@@ -1938,24 +2299,25 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
-      rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+      rtems_bdbuf_remove_from_tree (shard, bd);
+      rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_shard *shard,
+                                       rtems_disk_device *dd,
                                        rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_index_search (shard, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
     if (bd != NULL)
       rtems_bdbuf_group_obtain (bd);
@@ -1971,39 +2333,40 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_shard *shard,
+                                   rtems_disk_device *dd,
                                    rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_index_search (shard, dd, block);
 
     if (bd != NULL)
     {
       if (bd->group->bds_per_group != dd->bds_per_group)
       {
-        if (rtems_bdbuf_wait_for_recycle (bd))
+        if (rtems_bdbuf_wait_for_recycle (shard, bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
-          rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_remove_from_tree_and_lru_list (shard, bd);
+          rtems_bdbuf_make_free_and_add_to_lru_list (shard, bd);
+          rtems_bdbuf_wake (&shard->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (shard);
     }
   }
   while (bd == NULL);
 
-  rtems_bdbuf_wait_for_access (bd);
+  rtems_bdbuf_wait_for_access (shard, bd);
   rtems_bdbuf_group_obtain (bd);
 
   return bd;
@@ -2039,10 +2402,11 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
                  rtems_bdbuf_buffer **bd_ptr)
 {
   rtems_status_code   sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard  *shard = rtems_bdbuf_disk_shard (dd);
   rtems_bdbuf_buffer *bd = NULL;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_cache (shard);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -2054,11 +2418,12 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
 
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        bd->read_ahead = false;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -2086,7 +2451,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
     }
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   *bd_ptr = bd;
 
@@ -2116,12 +2481,13 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
                                       bool                  cache_locked)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
   uint32_t transfer_index = 0;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
 
   if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache (shard);
 
   /* The return value will be ignored for transfer requests */
   dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
@@ -2130,7 +2496,7 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   rtems_bdbuf_wait_for_transient_event ();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_cache (shard);
 
   /* Statistics */
   if (req->req == RTEMS_BLKDEV_REQ_READ)
@@ -2160,22 +2526,22 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     rtems_bdbuf_group_release (bd);
 
     if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
-      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+      rtems_bdbuf_make_cached_and_add_to_lru_list (shard, bd);
     else
-      rtems_bdbuf_discard_buffer (bd);
+      rtems_bdbuf_discard_buffer (shard, bd);
 
     if (rtems_bdbuf_tracer)
       rtems_bdbuf_show_users ("transfer", bd);
   }
 
   if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+    rtems_bdbuf_wake (&shard->transfer_waiters);
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 
   if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache (shard);
 
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
@@ -2188,6 +2554,7 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
                                   rtems_bdbuf_buffer *bd,
                                   uint32_t            transfer_count)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_buffer_shard (bd);
   rtems_blkdev_request *req = NULL;
   rtems_blkdev_bnum media_block = bd->block;
   uint32_t media_blocks_per_block = dd->media_blocks_per_block;
@@ -2220,12 +2587,13 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
     if (bd == NULL)
       break;
 
     rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+    bd->read_ahead = true;
 
     req->bufs [transfer_index].user   = bd;
     req->bufs [transfer_index].block  = media_block;
@@ -2264,10 +2632,12 @@ rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
   rtems_bdbuf_read_ahead_cancel (dd);
   dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  dd->read_ahead.window = 0;
 }
 
 static void
-rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
+rtems_bdbuf_check_read_ahead_trigger (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
   if (bdbuf_cache.read_ahead_task != 0
@@ -2275,7 +2645,7 @@ rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
       && !rtems_bdbuf_is_read_ahead_active (dd))
   {
     rtems_status_code sc;
-    rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+    rtems_chain_control *chain = &shard->read_ahead_chain;
 
     if (rtems_chain_is_empty (chain))
     {
@@ -2289,6 +2659,16 @@ rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
   }
 }
 
+/**
+ * Set the read-ahead trigger after a read miss.  A miss of the trigger block
+ * continues the sequential stream, so the read-ahead window is kept.  Any
+ * other miss is a random access which starts a new stream with the initial
+ * read-ahead window.
+ *
+ * After a read-ahead transfer of the stream the trigger block is one of the
+ * transferred blocks.  A miss of it is a read-ahead miss.  The read-ahead
+ * window is zero until the first read-ahead transfer of the stream.
+ */
 static void
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
@@ -2298,7 +2678,38 @@ rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
     rtems_bdbuf_read_ahead_cancel (dd);
     dd->read_ahead.trigger = block + 1;
     dd->read_ahead.next = block + 2;
+    dd->read_ahead.window = 0;
   }
+  else if (dd->read_ahead.window != 0)
+  {
+    ++dd->stats.read_ahead_misses;
+  }
+}
+
+/**
+ * Return the block count of the next read-ahead transfer and grow the
+ * read-ahead window for the following transfer.  The window starts with the
+ * initial read-ahead blocks and doubles up to the maximum read-ahead blocks.
+ */
+static uint32_t
+rtems_bdbuf_read_ahead_window (rtems_disk_device *dd)
+{
+  uint32_t max_window = bdbuf_config.max_read_ahead_blocks;
+  uint32_t window = dd->read_ahead.window;
+
+  if (window == 0)
+  {
+    window = bdbuf_config.initial_read_ahead_blocks;
+    if (window == 0)
+      window = max_window;
+  }
+
+  if (window < max_window / 2)
+    dd->read_ahead.window = 2 * window;
+  else
+    dd->read_ahead.window = max_window;
+
+  return window;
 }
 
 rtems_status_code
@@ -2307,10 +2718,11 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
                   rtems_bdbuf_buffer **bd_ptr)
 {
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard    *shard = rtems_bdbuf_disk_shard (dd);
   rtems_bdbuf_buffer   *bd = NULL;
   rtems_blkdev_bnum     media_block;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_cache (shard);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -2319,11 +2731,16 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
         ++dd->stats.read_hits;
+        if (bd->read_ahead)
+        {
+          ++dd->stats.read_ahead_hits;
+          bd->read_ahead = false;
+        }
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
@@ -2350,10 +2767,10 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
+    rtems_bdbuf_check_read_ahead_trigger (shard, dd, block);
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   *bd_ptr = bd;
 
@@ -2361,8 +2778,12 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd,
+                                     const char         *kind,
+                                     rtems_bdbuf_shard **shard_ptr)
 {
+  rtems_bdbuf_shard *shard;
+
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
   if (rtems_bdbuf_tracer)
@@ -2370,7 +2791,9 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  shard = rtems_bdbuf_buffer_shard (bd);
+  rtems_bdbuf_lock_cache (shard);
+  *shard_ptr = shard;
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2379,22 +2802,23 @@ rtems_status_code
 rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-      rtems_bdbuf_add_to_lru_list_after_access (bd);
+      rtems_bdbuf_add_to_lru_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_0);
@@ -2404,7 +2828,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2413,8 +2837,9 @@ rtems_status_code
 rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2423,10 +2848,10 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_6);
@@ -2436,7 +2861,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2445,8 +2870,9 @@ rtems_status_code
 rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync", &shard);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2455,10 +2881,10 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      rtems_bdbuf_sync_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_5);
@@ -2468,7 +2894,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2476,6 +2902,8 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_syncdev (rtems_disk_device *dd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
+
   if (rtems_bdbuf_tracer)
     printf ("bdbuf:syncdev: %08x\n", (unsigned) dd->dev);
 
@@ -2485,24 +2913,24 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
    * thread to block until it owns the sync lock then it can own the cache. The
    * sync lock can only be obtained with the cache unlocked.
    */
-  rtems_bdbuf_lock_sync ();
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_sync (shard);
+  rtems_bdbuf_lock_cache (shard);
 
   /*
-   * Set the cache to have a sync active for a specific device and let the swap
+   * Set the shard to have a sync active for a specific device and let the swap
    * out task know the id of the requester to wake when done.
    *
    * The swap out task will negate the sync active flag when no more buffers
    * for the device are held on the "modified for sync" queues.
    */
-  bdbuf_cache.sync_active    = true;
-  bdbuf_cache.sync_requester = rtems_task_self ();
-  bdbuf_cache.sync_device    = dd;
+  shard->sync_active    = true;
+  shard->sync_requester = rtems_task_self ();
+  shard->sync_device    = dd;
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
   rtems_bdbuf_wait_for_transient_event ();
-  rtems_bdbuf_unlock_sync ();
+  rtems_bdbuf_unlock_sync (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2620,6 +3048,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param shard The shard of the modified list.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2631,7 +3060,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_shard   *shard,
+                                         rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
                                          bool                 sync_active,
@@ -2665,7 +3095,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (shard))
         bd->hold_timer = 0;
 
       if (bd->hold_timer)
@@ -2696,36 +3126,16 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
       if (bd->dd == *dd_ptr)
       {
         rtems_chain_node* next_node = node->next;
-        rtems_chain_node* tnode = rtems_chain_tail (transfer);
 
         /*
-         * The blocks on the transfer list are sorted in block order. This
-         * means multi-block transfers for drivers that require consecutive
-         * blocks perform better with sorted blocks and for real disks it may
-         * help lower head movement.
+         * The transfer list is sorted in block order once all buffers are
+         * gathered, see rtems_bdbuf_swapout_sort_transfer().
          */
 
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
         rtems_chain_extract_unprotected (node);
-
-        tnode = tnode->previous;
-
-        while (node && !rtems_chain_is_head (transfer, tnode))
-        {
-          rtems_bdbuf_buffer* tbd = (rtems_bdbuf_buffer*) tnode;
-
-          if (bd->block > tbd->block)
-          {
-            rtems_chain_insert_unprotected (tnode, node);
-            node = NULL;
-          }
-          else
-            tnode = tnode->previous;
-        }
-
-        if (node)
-          rtems_chain_prepend_unprotected (transfer, node);
+        rtems_chain_append_unprotected (transfer, node);
 
         node = next_node;
       }
@@ -2738,13 +3148,130 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
 }
 
 /**
- * Process the cache's modified buffers. Check the sync list first then the
- * modified list extracting the buffers suitable to be written to disk. We have
- * a device at a time. The task level loop will repeat this operation while
- * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * Move all buffers of the device on the modified list to the transfer list
+ * regardless of their hold timers. This coalesces the scattered modified
+ * buffers of a device into one transfer list, so that the adjacent buffers
+ * can be merged into larger write requests.
  *
+ * @param dd The device of the transfer.
+ * @param chain The modified list.
+ * @param transfer The transfer list.
+ */
+static void
+rtems_bdbuf_swapout_coalesce (const rtems_disk_device* dd,
+                              rtems_chain_control*     chain,
+                              rtems_chain_control*     transfer)
+{
+  rtems_chain_node* node = rtems_chain_first (chain);
+
+  while (!rtems_chain_is_tail (chain, node))
+  {
+    rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+    rtems_chain_node*   next_node = node->next;
+
+    if (bd->dd == dd)
+    {
+      bd->hold_timer = 0;
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+      rtems_chain_extract_unprotected (node);
+      rtems_chain_append_unprotected (transfer, node);
+    }
+
+    node = next_node;
+  }
+}
+
+/**
+ * Merge two block ordered singly linked lists of buffers. The lists are
+ * linked through the next pointer of the chain nodes.
+ */
+static rtems_chain_node*
+rtems_bdbuf_swapout_merge (rtems_chain_node* a, rtems_chain_node* b)
+{
+  rtems_chain_node  head;
+  rtems_chain_node* tail = &head;
+
+  while (a != NULL && b != NULL)
+  {
+    if (((rtems_bdbuf_buffer*) a)->block <= ((rtems_bdbuf_buffer*) b)->block)
+    {
+      tail->next = a;
+      a = a->next;
+    }
+    else
+    {
+      tail->next = b;
+      b = b->next;
+    }
+
+    tail = tail->next;
+  }
+
+  tail->next = a != NULL ? a : b;
+
+  return head.next;
+}
+
+/**
+ * Sort the transfer list in block order. This means multi-block transfers for
+ * drivers that require consecutive blocks perform better with sorted blocks
+ * and for real disks it may help lower head movement.
+ *
+ * This is a bottom-up merge sort. The bin i holds a sorted list of 2^i
+ * buffers, so the sort needs no memory and is O(n log n).
+ *
+ * @param transfer The transfer list.
+ */
+static void
+rtems_bdbuf_swapout_sort_transfer (rtems_chain_control* transfer)
+{
+  rtems_chain_node* bins [32];
+  rtems_chain_node* node;
+  size_t            fill = 0;
+  size_t            i;
+
+  while ((node = rtems_chain_get_unprotected (transfer)) != NULL)
+  {
+    node->next = NULL;
+
+    for (i = 0; i < fill && bins [i] != NULL; ++i)
+    {
+      node = rtems_bdbuf_swapout_merge (bins [i], node);
+      bins [i] = NULL;
+    }
+
+    bins [i] = node;
+
+    if (i == fill)
+      ++fill;
+  }
+
+  node = NULL;
+
+  for (i = 0; i < fill; ++i)
+  {
+    if (bins [i] != NULL)
+      node = rtems_bdbuf_swapout_merge (bins [i], node);
+  }
+
+  while (node != NULL)
+  {
+    rtems_chain_node* next_node = node->next;
+
+    rtems_chain_append_unprotected (transfer, node);
+    node = next_node;
+  }
+}
+
+/**
+ * Process the modified buffers of a cache shard. Check the sync list first
+ * then the modified list extracting the buffers suitable to be written to
+ * disk. We have a device at a time. The task level loop will repeat this
+ * operation while there are buffers to be written. If the transfer fails place
+ * the buffers back on the modified list and try again later. The shard is
+ * unlocked while the buffers are being written to disk.
+ *
+ * @param shard The shard to process.
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
  * @param update_timers If true update the timers.
@@ -2754,14 +3281,15 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
  * @retval false No buffers where written to disk.
  */
 static bool
-rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
-                                bool                          update_timers,
-                                rtems_bdbuf_swapout_transfer* transfer)
+rtems_bdbuf_swapout_shard_processing (rtems_bdbuf_shard*            shard,
+                                      unsigned long                 timer_delta,
+                                      bool                          update_timers,
+                                      rtems_bdbuf_swapout_transfer* transfer)
 {
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_cache (shard);
 
   /*
    * If a sync is active do not use a worker because the current code does not
@@ -2772,54 +3300,68 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
    * lock. The simplest solution is to get the main swap out task perform all
    * sync operations.
    */
-  if (bdbuf_cache.sync_active)
+  if (shard->sync_active)
     worker = NULL;
   else
   {
     worker = (rtems_bdbuf_swapout_worker*)
-      rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+      rtems_chain_get (&bdbuf_cache.swapout_free_workers);
     if (worker)
       transfer = &worker->transfer;
   }
 
   rtems_chain_initialize_empty (&transfer->bds);
   transfer->dd = BDBUF_INVALID_DEV;
-  transfer->syncing = bdbuf_cache.sync_active;
+  transfer->syncing = shard->sync_active;
 
   /*
    * When the sync is for a device limit the sync to that device. If the sync
    * is for a buffer handle process the devices in the order on the sync
    * list. This means the dev is BDBUF_INVALID_DEV.
    */
-  if (bdbuf_cache.sync_active)
-    transfer->dd = bdbuf_cache.sync_device;
+  if (shard->sync_active)
+    transfer->dd = shard->sync_device;
 
   /*
    * If we have any buffers in the sync queue move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
+  rtems_bdbuf_swapout_modified_processing (shard,
+                                           &transfer->dd,
+                                           &shard->sync,
                                            &transfer->bds,
                                            true, false,
                                            timer_delta);
 
   /*
-   * Process the cache's modified list.
+   * Process the shard's modified list.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
+  rtems_bdbuf_swapout_modified_processing (shard,
+                                           &transfer->dd,
+                                           &shard->modified,
                                            &transfer->bds,
-                                           bdbuf_cache.sync_active,
+                                           shard->sync_active,
                                            update_timers,
                                            timer_delta);
 
+  /*
+   * Once a device is due to be written take all its modified buffers to get
+   * fewer and larger write requests.
+   */
+  if (bdbuf_config.swapout_write_coalescing
+      && !rtems_chain_is_empty (&transfer->bds))
+    rtems_bdbuf_swapout_coalesce (transfer->dd,
+                                  &shard->modified,
+                                  &transfer->bds);
+
   /*
    * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
+   * shard can be unlocked because the state of each buffer has been set to
    * TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
+
+  rtems_bdbuf_swapout_sort_transfer (&transfer->bds);
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2840,15 +3382,22 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
 
     transfered_buffers = true;
   }
+  else if (worker)
+  {
+    /*
+     * Nothing to write, so give the worker back.
+     */
+    rtems_chain_append (&bdbuf_cache.swapout_free_workers, &worker->link);
+  }
 
-  if (bdbuf_cache.sync_active && !transfered_buffers)
+  if (shard->sync_active && !transfered_buffers)
   {
     rtems_id sync_requester;
-    rtems_bdbuf_lock_cache ();
-    sync_requester = bdbuf_cache.sync_requester;
-    bdbuf_cache.sync_active = false;
-    bdbuf_cache.sync_requester = 0;
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_lock_cache (shard);
+    sync_requester = shard->sync_requester;
+    shard->sync_active = false;
+    shard->sync_requester = 0;
+    rtems_bdbuf_unlock_cache (shard);
     if (sync_requester)
       rtems_event_transient_send (sync_requester);
   }
@@ -2856,6 +3405,37 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   return transfered_buffers;
 }
 
+/**
+ * Process the modified buffers of all cache shards.
+ *
+ * @param timer_delta It update_timers is true update the timers by this
+ *                    amount.
+ * @param update_timers If true update the timers.
+ * @param transfer The transfer transaction data.
+ *
+ * @retval true Buffers where written to disk so scan again.
+ * @retval false No buffers where written to disk.
+ */
+static bool
+rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
+                                bool                          update_timers,
+                                rtems_bdbuf_swapout_transfer* transfer)
+{
+  bool   transfered_buffers = false;
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    if (rtems_bdbuf_swapout_shard_processing (&bdbuf_cache.shards[s],
+                                              timer_delta,
+                                              update_timers,
+                                              transfer))
+      transfered_buffers = true;
+  }
+
+  return transfered_buffers;
+}
+
 /**
  * The swapout worker thread body.
  *
@@ -2873,14 +3453,10 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 
     rtems_bdbuf_swapout_write (&worker->transfer);
 
-    rtems_bdbuf_lock_cache ();
-
     rtems_chain_initialize_empty (&worker->transfer.bds);
     worker->transfer.dd = BDBUF_INVALID_DEV;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers, &worker->link);
-
-    rtems_bdbuf_unlock_cache ();
+    rtems_chain_append (&bdbuf_cache.swapout_free_workers, &worker->link);
   }
 
   free (worker);
@@ -2896,18 +3472,12 @@ rtems_bdbuf_swapout_workers_close (void)
 {
   rtems_chain_node* node;
 
-  rtems_bdbuf_lock_cache ();
-
-  node = rtems_chain_first (&bdbuf_cache.swapout_free_workers);
-  while (!rtems_chain_is_tail (&bdbuf_cache.swapout_free_workers, node))
+  while ((node = rtems_chain_get (&bdbuf_cache.swapout_free_workers)) != NULL)
   {
     rtems_bdbuf_swapout_worker* worker = (rtems_bdbuf_swapout_worker*) node;
     worker->enabled = false;
     rtems_event_send (worker->id, RTEMS_BDBUF_SWAPOUT_SYNC);
-    node = rtems_chain_next (node);
   }
-
-  rtems_bdbuf_unlock_cache ();
 }
 
 /**
@@ -2992,7 +3562,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_shard   *shard,
+                        rtems_chain_control *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -3004,56 +3575,89 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
     if (bd->waiters == 0)
       wake_buffer_waiters = true;
 
-    rtems_bdbuf_discard_buffer (bd);
+    rtems_bdbuf_discard_buffer (shard, bd);
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_buffer_for_purge (rtems_bdbuf_shard   *shard,
+                                     rtems_chain_control *purge_list,
+                                     rtems_bdbuf_buffer  *bd)
+{
+  switch (bd->state)
+  {
+    case RTEMS_BDBUF_STATE_FREE:
+    case RTEMS_BDBUF_STATE_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      break;
+    case RTEMS_BDBUF_STATE_SYNC:
+      rtems_bdbuf_wake (&shard->transfer_waiters);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_group_release (bd);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_chain_extract_unprotected (&bd->link);
+      rtems_chain_append_unprotected (purge_list, &bd->link);
+      break;
+    case RTEMS_BDBUF_STATE_TRANSFER:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+      break;
+    case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+      break;
+    default:
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+  }
+}
+
+static void
+rtems_bdbuf_gather_for_purge_in_hash (rtems_bdbuf_shard       *shard,
+                                      rtems_chain_control     *purge_list,
+                                      const rtems_disk_device *dd)
+{
+  size_t index;
+
+  /*
+   * Gathering changes only the buffer states and lists, so the hash table
+   * stays intact during the iteration.
+   */
+  for (index = 0; index < shard->hash_size; ++index)
+  {
+    rtems_bdbuf_buffer *cur = shard->hash [index];
+
+    if (cur != NULL && cur->dd == dd)
+      rtems_bdbuf_gather_buffer_for_purge (shard, purge_list, cur);
+  }
+}
+
+static void
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_shard       *shard,
+                              rtems_chain_control     *purge_list,
                               const rtems_disk_device *dd)
 {
   rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
   rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  rtems_bdbuf_buffer *cur = shard->tree;
+
+  if (shard->hash != NULL)
+  {
+    rtems_bdbuf_gather_for_purge_in_hash (shard, purge_list, dd);
+    return;
+  }
 
   *prev = NULL;
 
   while (cur != NULL)
   {
     if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+      rtems_bdbuf_gather_buffer_for_purge (shard, purge_list, cur);
 
     if (cur->avl.left != NULL)
     {
@@ -3089,22 +3693,38 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
 }
 
 static void
-rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
+rtems_bdbuf_do_purge_dev (rtems_bdbuf_shard *shard, rtems_disk_device *dd)
 {
   rtems_chain_control purge_list;
 
   rtems_chain_initialize_empty (&purge_list);
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+  rtems_bdbuf_gather_for_purge (shard, &purge_list, dd);
+  rtems_bdbuf_purge_list (shard, &purge_list);
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
-  rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
+
+  rtems_bdbuf_lock_cache (shard);
+  rtems_bdbuf_do_purge_dev (shard, dd);
+  rtems_bdbuf_unlock_cache (shard);
+}
+
+void
+rtems_bdbuf_assign_shard (rtems_disk_device *dd)
+{
+  rtems_bdbuf_shard *first = &bdbuf_cache.shards [0];
+
+  rtems_bdbuf_lock_cache (first);
+
+  dd->bdbuf_shard = bdbuf_cache.next_shard;
+  bdbuf_cache.next_shard = (bdbuf_cache.next_shard + 1)
+    % bdbuf_cache.shard_count;
+
+  rtems_bdbuf_unlock_cache (first);
 }
 
 rtems_status_code
@@ -3112,7 +3732,8 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
                             uint32_t           block_size,
                             bool               sync)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code  sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
 
   /*
    * We do not care about the synchronization status since we will purge the
@@ -3121,7 +3742,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_cache (shard);
 
   if (block_size > 0)
   {
@@ -3147,7 +3768,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
       dd->block_to_media_block_shift = block_to_media_block_shift;
       dd->bds_per_group = bds_per_group;
 
-      rtems_bdbuf_do_purge_dev (dd);
+      rtems_bdbuf_do_purge_dev (shard, dd);
     }
     else
     {
@@ -3159,66 +3780,76 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 
   return sc;
 }
 
-static rtems_task
-rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
+static void
+rtems_bdbuf_read_ahead_shard (rtems_bdbuf_shard *shard)
 {
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_chain_control *chain = &shard->read_ahead_chain;
+  rtems_chain_node    *node;
 
-  while (bdbuf_cache.read_ahead_enabled)
+  rtems_bdbuf_lock_cache (shard);
+
+  while ((node = rtems_chain_get_unprotected (chain)) != NULL)
   {
-    rtems_chain_node *node;
+    rtems_disk_device *dd = (rtems_disk_device *)
+      ((char *) node - offsetof (rtems_disk_device, read_ahead.node));
+    rtems_blkdev_bnum block = dd->read_ahead.next;
+    rtems_blkdev_bnum media_block = 0;
+    rtems_status_code sc =
+      rtems_bdbuf_get_media_block (dd, block, &media_block);
 
-    rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
+    rtems_chain_set_off_chain (&dd->read_ahead.node);
 
-    while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+    if (sc == RTEMS_SUCCESSFUL)
     {
-      rtems_disk_device *dd = (rtems_disk_device *)
-        ((char *) node - offsetof (rtems_disk_device, read_ahead.node));
-      rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
-
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+      rtems_bdbuf_buffer *bd =
+        rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
-      if (sc == RTEMS_SUCCESSFUL)
+      if (bd != NULL)
       {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+        uint32_t transfer_count = dd->block_count - block;
+        uint32_t max_transfer_count = rtems_bdbuf_read_ahead_window (dd);
 
-        if (bd != NULL)
+        if (transfer_count >= max_transfer_count)
         {
-          uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
-
-          if (transfer_count >= max_transfer_count)
-          {
-            transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
-          }
-          else
-          {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-          }
-
-          ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
+          transfer_count = max_transfer_count;
+          dd->read_ahead.trigger = block + transfer_count / 2;
+          dd->read_ahead.next = block + transfer_count;
         }
+        else
+        {
+          dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        }
+
+        bd->read_ahead = true;
+        ++dd->stats.read_ahead_transfers;
+        rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
       }
-      else
-      {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-      }
     }
+    else
+    {
+      dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    }
+  }
+
+  rtems_bdbuf_unlock_cache (shard);
+}
 
-    rtems_bdbuf_unlock_cache ();
+static rtems_task
+rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
+{
+  while (bdbuf_cache.read_ahead_enabled)
+  {
+    size_t s;
+
+    rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+
+    for (s = 0; s < bdbuf_cache.shard_count; s++)
+      rtems_bdbuf_read_ahead_shard (&bdbuf_cache.shards[s]);
   }
 
   rtems_task_delete (RTEMS_SELF);
@@ -3227,14 +3858,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
+
+  rtems_bdbuf_lock_cache (shard);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_shard *shard = rtems_bdbuf_disk_shard (dd);
+
+  rtems_bdbuf_lock_cache (shard);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_cache (shard);
 }
@@ -27,12 +27,28 @@
 
 #include <inttypes.h>
 
+static uint32_t average_in_hundredths(uint32_t blocks, uint32_t transfers)
+{
+  uint32_t avg = 0;
+
+  if (transfers > 0) {
+    avg = (uint32_t) (((uint64_t) blocks * 100 + transfers / 2) / transfers);
+  }
+
+  return avg;
+}
+
 void rtems_blkdev_print_stats(
   const rtems_blkdev_stats *stats,
   rtems_printk_plugin_t print,
   void *print_arg
 )
 {
+  uint32_t avg_write = average_in_hundredths(
+    stats->write_blocks,
+    stats->write_transfers
+  );
+
   (*print)(
      print_arg,
      "-------------------------------------------------------------------------------\n"
@@ -41,19 +57,26 @@ void rtems_blkdev_print_stats(
      " READ HITS            | %" PRIu32 "\n"
      " READ MISSES          | %" PRIu32 "\n"
      " READ AHEAD TRANSFERS | %" PRIu32 "\n"
+     " READ AHEAD HITS      | %" PRIu32 "\n"
+     " READ AHEAD MISSES    | %" PRIu32 "\n"
      " READ BLOCKS          | %" PRIu32 "\n"
      " READ ERRORS          | %" PRIu32 "\n"
      " WRITE TRANSFERS      | %" PRIu32 "\n"
      " WRITE BLOCKS         | %" PRIu32 "\n"
+     " AVG WRITE BLOCKS     | %" PRIu32 ".%02" PRIu32 "\n"
      " WRITE ERRORS         | %" PRIu32 "\n"
      "----------------------+--------------------------------------------------------\n",
      stats->read_hits,
      stats->read_misses,
      stats->read_ahead_transfers,
+     stats->read_ahead_hits,
+     stats->read_ahead_misses,
      stats->read_blocks,
      stats->read_errors,
      stats->write_transfers,
      stats->write_blocks,
+     avg_write / 100,
+     avg_write % 100,
      stats->write_errors
   );
 }
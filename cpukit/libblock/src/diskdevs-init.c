@@ -47,6 +47,8 @@ rtems_status_code rtems_disk_init_phys(
   dd->driver_data = driver_data;
   dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
 
+  rtems_bdbuf_assign_shard(dd);
+
   if (block_count > 0) {
     if ((*handler)(dd, RTEMS_BLKIO_CAPABILITIES, &dd->capabilities) != 0) {
       dd->capabilities = 0;
@@ -79,6 +81,8 @@ rtems_status_code rtems_disk_init_log(
   dd->driver_data = phys_dd->driver_data;
   dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
 
+  rtems_bdbuf_assign_shard(dd);
+
   if (phys_dd->phys_dev == phys_dd) {
     rtems_blkdev_bnum phys_block_count = phys_dd->size;
 
@@ -61,6 +61,10 @@ typedef struct {
     uint32_t    max_depth;		     /* most ever malloc'd at 1 time */
     uintmax_t   lifetime_allocated;
     uintmax_t   lifetime_freed;
+    uint32_t    cache_hits;                  /* # mallocs served by a cache */
+    uint32_t    cache_refills;               /* # cache refills from heap */
+    uint32_t    cache_flushes;               /* # cache flushes to heap */
+    uint32_t    cached_blocks;               /* # blocks held by caches */
 } rtems_malloc_statistics_t;
 
 /*
@@ -109,6 +113,30 @@ extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 typedef void (*rtems_malloc_dirtier_t)(void *, size_t);
 extern rtems_malloc_dirtier_t rtems_malloc_dirty_helper;
 
+/**
+ * @brief Indicates if the malloc heap uses the segregated fit allocation
+ * policy.
+ *
+ * @see _Heap_Enable_segregated_fit().
+ */
+extern const bool rtems_malloc_segregated_fit;
+
+/**
+ * @brief Maximum count of blocks of one size class in a per-processor malloc
+ * cache.
+ *
+ * A value of zero disables the per-processor malloc caches.
+ */
+extern const uint32_t rtems_malloc_cache_blocks;
+
+/**
+ * @brief Returns all blocks of the per-processor malloc caches to the C
+ * program heap.
+ *
+ * This may be used to get accurate free space information from the heap.
+ */
+void malloc_cache_flush(void);
+
 /**
  *  @brief Dirty Memory Function
  *
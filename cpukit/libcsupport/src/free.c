@@ -48,6 +48,12 @@ void free(
   if ( rtems_malloc_statistics_helpers )
     (*rtems_malloc_statistics_helpers->at_free)(ptr);
 
+  /*
+   *  If configured, keep small blocks in the per-processor cache
+   */
+  if ( malloc_cache_free( ptr ) )
+    return;
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     printk( "Program heap: free of bad pointer %p -- range %p - %p \n",
       ptr,
@@ -52,13 +52,19 @@ void *malloc(
        !malloc_is_system_state_OK() )
     return NULL;
 
+  /*
+   *  If configured, try the per-processor cache of small blocks first.
+   */
+  return_this = malloc_cache_allocate( size );
+
   /*
    * Try to give a segment in the current heap if there is not
    * enough space then try to grow the heap.
    * If this fails then return a NULL pointer.
    */
 
-  return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
+  if ( !return_this )
+    return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
 
   if ( !return_this ) {
     return_this = (*rtems_malloc_extend_handler)( RTEMS_Malloc_Heap, size );
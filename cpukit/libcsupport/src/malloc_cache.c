@@ -0,0 +1,471 @@
+/**
+ * @file
+ *
+ * @brief Per-Processor Malloc Caches
+ * @ingroup libcsupport
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include <inttypes.h>
+#include <string.h>
+
+#include "malloc_p.h"
+
+#include <rtems/score/apimutex.h>
+#include <rtems/score/interr.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/smp.h>
+
+/*
+ *  The small blocks are sorted into size classes of 16, 32, 64, 128 and 256
+ *  bytes.  Larger requests bypass the caches.
+ */
+#define MALLOC_CACHE_MIN_SIZE_LOG2 4
+
+#define MALLOC_CACHE_MIN_SIZE (1U << MALLOC_CACHE_MIN_SIZE_LOG2)
+
+#define MALLOC_CACHE_CLASS_COUNT 5
+
+#define MALLOC_CACHE_MAX_SIZE \
+  (MALLOC_CACHE_MIN_SIZE << (MALLOC_CACHE_CLASS_COUNT - 1))
+
+typedef struct Malloc_cache_node {
+  struct Malloc_cache_node *next;
+} Malloc_cache_node;
+
+typedef struct {
+  Malloc_cache_node *first;
+  uint32_t           count;
+} Malloc_cache_class;
+
+typedef struct {
+  ISR_lock_Control   Lock;
+  Malloc_cache_class classes[MALLOC_CACHE_CLASS_COUNT];
+  uint32_t           hits;
+  uint32_t           refills;
+  uint32_t           flushes;
+} Malloc_cache;
+
+static Malloc_cache *malloc_caches;
+
+static uint32_t malloc_cache_count;
+
+static int malloc_cache_msb(uintptr_t value)
+{
+  return (int) (8 * sizeof(unsigned long) - 1)
+    - __builtin_clzl((unsigned long) value);
+}
+
+static uint32_t malloc_cache_batch_size(void)
+{
+  return (rtems_malloc_cache_blocks + 1) / 2;
+}
+
+/*
+ *  Returns the class of blocks large enough for the requested size.
+ */
+static int malloc_cache_class_of_size(size_t size)
+{
+  if (size > MALLOC_CACHE_MAX_SIZE) {
+    return -1;
+  }
+
+  if (size <= MALLOC_CACHE_MIN_SIZE) {
+    return 0;
+  }
+
+  return malloc_cache_msb(size - 1) + 1 - MALLOC_CACHE_MIN_SIZE_LOG2;
+}
+
+/*
+ *  Returns the class of an allocated block by means of its usable size.  The
+ *  size portion of the block header of an allocated block does not change
+ *  while the block is in use, so it may be read without the allocator lock.
+ */
+static int malloc_cache_class_of_block(const void *ptr)
+{
+  Heap_Control *heap = RTEMS_Malloc_Heap;
+  uintptr_t alloc_begin = (uintptr_t) ptr;
+  Heap_Block *block = _Heap_Block_of_alloc_area(alloc_begin, heap->page_size);
+  Heap_Block *next_block;
+  uintptr_t size;
+  int c;
+
+  if (!_Heap_Is_block_in_heap(heap, block)) {
+    return -1;
+  }
+
+  next_block = _Heap_Block_at(block, _Heap_Block_size(block));
+
+  if (
+    !_Heap_Is_block_in_heap(heap, next_block)
+      || !_Heap_Is_prev_used(next_block)
+      || (uintptr_t) next_block <= alloc_begin
+  ) {
+    return -1;
+  }
+
+  size = (uintptr_t) next_block - alloc_begin + HEAP_ALLOC_BONUS;
+
+  if (size < MALLOC_CACHE_MIN_SIZE) {
+    return -1;
+  }
+
+  c = malloc_cache_msb(size) - MALLOC_CACHE_MIN_SIZE_LOG2;
+
+  if (c >= MALLOC_CACHE_CLASS_COUNT) {
+    return -1;
+  }
+
+  return c;
+}
+
+/*
+ *  Interrupts are disabled to pin the executing thread to its processor.  The
+ *  lock is only contended by malloc_cache_flush() and the walk and statistics
+ *  functions.
+ */
+static Malloc_cache *malloc_cache_acquire(
+  ISR_Level        *level,
+  ISR_lock_Context *lock_context
+)
+{
+  Malloc_cache *cache;
+
+  _ISR_Disable_without_giant(*level);
+  cache = &malloc_caches[_SMP_Get_current_processor()];
+  _ISR_lock_Acquire(&cache->Lock, lock_context);
+
+  return cache;
+}
+
+static void malloc_cache_release(
+  Malloc_cache     *cache,
+  ISR_Level         level,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release(&cache->Lock, lock_context);
+  _ISR_Enable_without_giant(level);
+}
+
+static void malloc_cache_free_to_heap(Malloc_cache_node *node)
+{
+  _RTEMS_Lock_allocator();
+
+  while (node != NULL) {
+    Malloc_cache_node *next = node->next;
+
+    _Heap_Free(RTEMS_Malloc_Heap, node);
+    node = next;
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+void malloc_cache_initialize(void)
+{
+  uint32_t cache_count = rtems_configuration_get_maximum_processors();
+  size_t size = cache_count * sizeof(*malloc_caches);
+  uint32_t i;
+
+  if (rtems_malloc_cache_blocks == 0) {
+    return;
+  }
+
+  malloc_caches = _Heap_Allocate(RTEMS_Malloc_Heap, size);
+  if (malloc_caches == NULL) {
+    _Terminate(
+      INTERNAL_ERROR_CORE,
+      true,
+      INTERNAL_ERROR_NO_MEMORY_FOR_HEAP
+    );
+  }
+
+  memset(malloc_caches, 0, size);
+
+  for (i = 0; i < cache_count; ++i) {
+    _ISR_lock_Initialize(&malloc_caches[i].Lock, "Malloc Cache");
+  }
+
+  malloc_cache_count = cache_count;
+}
+
+void *malloc_cache_allocate(size_t size)
+{
+  int c = malloc_cache_class_of_size(size);
+  uintptr_t class_size;
+  uint32_t batch_size;
+  Malloc_cache *cache;
+  Malloc_cache_class *cls;
+  Malloc_cache_node *node;
+  Malloc_cache_node *first;
+  Malloc_cache_node *last;
+  ISR_Level level;
+  ISR_lock_Context lock_context;
+  uint32_t n;
+
+  if (malloc_caches == NULL || c < 0) {
+    return NULL;
+  }
+
+  cache = malloc_cache_acquire(&level, &lock_context);
+  cls = &cache->classes[c];
+  node = cls->first;
+
+  if (node != NULL) {
+    cls->first = node->next;
+    --cls->count;
+    ++cache->hits;
+  }
+
+  malloc_cache_release(cache, level, &lock_context);
+
+  if (node != NULL) {
+    return node;
+  }
+
+  /*
+   *  Refill the cache with a batch of blocks obtained under one allocator
+   *  lock acquisition.
+   */
+  class_size = (uintptr_t) MALLOC_CACHE_MIN_SIZE << c;
+  batch_size = malloc_cache_batch_size();
+  first = NULL;
+  last = NULL;
+
+  _RTEMS_Lock_allocator();
+
+  for (n = 0; n < batch_size; ++n) {
+    node = _Heap_Allocate(RTEMS_Malloc_Heap, class_size);
+    if (node == NULL) {
+      break;
+    }
+
+    node->next = first;
+    first = node;
+
+    if (last == NULL) {
+      last = node;
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if (first == NULL) {
+    return NULL;
+  }
+
+  node = first;
+  first = first->next;
+  --n;
+
+  cache = malloc_cache_acquire(&level, &lock_context);
+  cls = &cache->classes[c];
+
+  if (n > 0) {
+    last->next = cls->first;
+    cls->first = first;
+    cls->count += n;
+  }
+
+  ++cache->refills;
+
+  malloc_cache_release(cache, level, &lock_context);
+
+  return node;
+}
+
+bool malloc_cache_free(void *ptr)
+{
+  int c;
+  Malloc_cache *cache;
+  Malloc_cache_class *cls;
+  Malloc_cache_node *node = ptr;
+  Malloc_cache_node *flush = NULL;
+  ISR_Level level;
+  ISR_lock_Context lock_context;
+
+  if (malloc_caches == NULL) {
+    return false;
+  }
+
+  c = malloc_cache_class_of_block(ptr);
+  if (c < 0) {
+    return false;
+  }
+
+  cache = malloc_cache_acquire(&level, &lock_context);
+  cls = &cache->classes[c];
+
+  if (cls->count >= rtems_malloc_cache_blocks) {
+    uint32_t batch_size = malloc_cache_batch_size();
+    Malloc_cache_node *last = cls->first;
+    uint32_t n;
+
+    for (n = 1; n < batch_size; ++n) {
+      last = last->next;
+    }
+
+    flush = cls->first;
+    cls->first = last->next;
+    cls->count -= batch_size;
+    last->next = NULL;
+    ++cache->flushes;
+  }
+
+  node->next = cls->first;
+  cls->first = node;
+  ++cls->count;
+
+  malloc_cache_release(cache, level, &lock_context);
+
+  if (flush != NULL) {
+    malloc_cache_free_to_heap(flush);
+  }
+
+  return true;
+}
+
+void malloc_cache_flush(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < malloc_cache_count; ++i) {
+    Malloc_cache *cache = &malloc_caches[i];
+    Malloc_cache_node *flush = NULL;
+    ISR_lock_Context lock_context;
+    int c;
+
+    _ISR_lock_ISR_disable_and_acquire(&cache->Lock, &lock_context);
+
+    for (c = 0; c < MALLOC_CACHE_CLASS_COUNT; ++c) {
+      Malloc_cache_class *cls = &cache->classes[c];
+
+      if (cls->first != NULL) {
+        Malloc_cache_node *last = cls->first;
+
+        while (last->next != NULL) {
+          last = last->next;
+        }
+
+        last->next = flush;
+        flush = cls->first;
+        cls->first = NULL;
+        cls->count = 0;
+      }
+    }
+
+    if (flush != NULL) {
+      ++cache->flushes;
+    }
+
+    _ISR_lock_Release_and_ISR_enable(&cache->Lock, &lock_context);
+
+    malloc_cache_free_to_heap(flush);
+  }
+}
+
+bool malloc_cache_walk(int source, bool printf_enabled)
+{
+  uint32_t i;
+
+  for (i = 0; i < malloc_cache_count; ++i) {
+    Malloc_cache *cache = &malloc_caches[i];
+    Malloc_cache_node *bad = NULL;
+    uint32_t cached = 0;
+    ISR_lock_Context lock_context;
+    int c;
+
+    _ISR_lock_ISR_disable_and_acquire(&cache->Lock, &lock_context);
+
+    for (c = 0; c < MALLOC_CACHE_CLASS_COUNT && bad == NULL; ++c) {
+      const Malloc_cache_class *cls = &cache->classes[c];
+      Malloc_cache_node *node = cls->first;
+      uint32_t count = 0;
+
+      while (node != NULL && bad == NULL) {
+        if (malloc_cache_class_of_block(node) != c) {
+          bad = node;
+        }
+
+        ++count;
+        node = node->next;
+      }
+
+      if (bad == NULL && count != cls->count) {
+        bad = cls->first;
+      }
+
+      cached += count;
+    }
+
+    _ISR_lock_Release_and_ISR_enable(&cache->Lock, &lock_context);
+
+    if (bad != NULL) {
+      if (printf_enabled) {
+        printk(
+          "FAIL[%d]: malloc cache %" PRIu32 ": invalid block %p\n",
+          source,
+          i,
+          bad
+        );
+      }
+
+      return false;
+    }
+
+    if (printf_enabled) {
+      printk(
+        "PASS[%d]: malloc cache %" PRIu32 ": %" PRIu32 " cached blocks\n",
+        source,
+        i,
+        cached
+      );
+    }
+  }
+
+  return true;
+}
+
+void malloc_cache_get_statistics(rtems_malloc_statistics_t *stats)
+{
+  uint32_t i;
+
+  stats->cache_hits = 0;
+  stats->cache_refills = 0;
+  stats->cache_flushes = 0;
+  stats->cached_blocks = 0;
+
+  for (i = 0; i < malloc_cache_count; ++i) {
+    Malloc_cache *cache = &malloc_caches[i];
+    ISR_lock_Context lock_context;
+    int c;
+
+    _ISR_lock_ISR_disable_and_acquire(&cache->Lock, &lock_context);
+
+    stats->cache_hits += cache->hits;
+    stats->cache_refills += cache->refills;
+    stats->cache_flushes += cache->flushes;
+
+    for (c = 0; c < MALLOC_CACHE_CLASS_COUNT; ++c) {
+      stats->cached_blocks += cache->classes[c].count;
+    }
+
+    _ISR_lock_Release_and_ISR_enable(&cache->Lock, &lock_context);
+  }
+}
+#endif
@@ -30,6 +30,7 @@ int malloc_get_statistics(
   _RTEMS_Lock_allocator();
   *stats = rtems_malloc_statistics;
   _RTEMS_Unlock_allocator();
+  malloc_cache_get_statistics( stats );
   return 0;
 }
 
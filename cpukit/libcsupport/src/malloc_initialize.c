@@ -60,6 +60,22 @@ void RTEMS_Malloc_Initialize(
     }
   }
 
+  /*
+   *  If configured, use the segregated fit allocation policy
+   */
+  if ( rtems_malloc_segregated_fit && !_Heap_Enable_segregated_fit( heap ) ) {
+    _Terminate(
+      INTERNAL_ERROR_CORE,
+      true,
+      INTERNAL_ERROR_NO_MEMORY_FOR_HEAP
+    );
+  }
+
+  /*
+   *  If configured, initialize the per-processor caches of small blocks
+   */
+  malloc_cache_initialize();
+
   /*
    *  If configured, initialize the statistics support
    */
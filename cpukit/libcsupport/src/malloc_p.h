@@ -34,3 +34,12 @@ extern rtems_malloc_statistics_t rtems_malloc_statistics;
 bool malloc_is_system_state_OK(void);
 void malloc_deferred_frees_process(void);
 void malloc_deferred_free(void *);
+
+/*
+ *  Per-processor caches of small blocks
+ */
+void malloc_cache_initialize(void);
+void *malloc_cache_allocate(size_t size);
+bool malloc_cache_free(void *ptr);
+bool malloc_cache_walk(int source, bool printf_enabled);
+void malloc_cache_get_statistics(rtems_malloc_statistics_t *stats);
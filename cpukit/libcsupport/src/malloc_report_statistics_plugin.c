@@ -54,6 +54,20 @@ void malloc_report_statistics_with_plugin(
     s->realloc_calls,
     s->calloc_calls
   );
+  if ( rtems_malloc_cache_blocks != 0 ) {
+    rtems_malloc_statistics_t cache_stats;
+
+    malloc_cache_get_statistics( &cache_stats );
+    (*print)(
+      context,
+      "  Caches:   hits:%"PRIu32"   refills:%"PRIu32"   flushes:%"PRIu32
+         "   cached blocks:%"PRIu32"\n",
+      cache_stats.cache_hits,
+      cache_stats.cache_refills,
+      cache_stats.cache_flushes,
+      cache_stats.cached_blocks
+    );
+  }
 }
 
 #endif
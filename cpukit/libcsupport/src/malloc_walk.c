@@ -25,7 +25,9 @@
 
 bool malloc_walk(int source, bool printf_enabled)
 {
-  return _Protected_heap_Walk( RTEMS_Malloc_Heap, source, printf_enabled );
+  bool ok = _Protected_heap_Walk( RTEMS_Malloc_Heap, source, printf_enabled );
+
+  return malloc_cache_walk( source, printf_enabled ) && ok;
 }
 
 #endif
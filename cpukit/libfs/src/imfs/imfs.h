@@ -20,6 +20,7 @@
 
 #include <rtems/libio_.h>
 #include <rtems/pipe.h>
+#include <rtems/rbtree.h>
 
 /**
  * @brief In-Memory File System Support.
@@ -44,6 +45,14 @@ typedef struct IMFS_jnode_tt IMFS_jnode_t;
 typedef struct {
   rtems_chain_control                    Entries;
   rtems_filesystem_mount_table_entry_t  *mt_fs;
+
+  /**
+   * @brief Index of the entries ordered by name.
+   *
+   * The index is only maintained in case the directory index is enabled, see
+   * imfs_rq_directory_index.
+   */
+  rtems_rbtree_control                   Index;
 }  IMFS_directory_t;
 
 typedef struct {
@@ -93,6 +102,20 @@ typedef struct {
   extern int imfs_rq_memfile_bytes_per_block;
   extern int imfs_memfile_bytes_per_block;
 
+/**
+ * @brief Enables the name index of IMFS directories.
+ *
+ * In case this is true, then each directory maintains a red-black tree of its
+ * entries ordered by name.  The path evaluation uses this tree to find an
+ * entry in O(log(n)) time instead of a linear search through the entries.
+ * This is useful for directories with many entries, e.g. a /dev directory with
+ * thousands of device nodes.
+ *
+ * The value is provided by the application configuration, see
+ * CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX, and must not change at run-time.
+ */
+extern bool imfs_rq_directory_index;
+
 #define IMFS_MEMFILE_BYTES_PER_BLOCK imfs_memfile_bytes_per_block
 #define IMFS_MEMFILE_BLOCK_SLOTS \
   (IMFS_MEMFILE_BYTES_PER_BLOCK / sizeof(void *))
@@ -112,6 +135,57 @@ typedef struct {
   block_p       direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+/**
+ * @brief An extent of an IMFS extent file.
+ *
+ * The data area of an extent follows the extent header in the same memory
+ * block.
+ */
+typedef struct IMFS_extent IMFS_extent_t;
+
+struct IMFS_extent {
+  IMFS_extent_t *next;            /* next extent in file order */
+  size_t         capacity;        /* size of the data area in bytes */
+  unsigned char  data[ RTEMS_ZERO_LENGTH_ARRAY ];
+};
+
+/**
+ * @brief IMFS extent file information.
+ *
+ * The file content starts with an optional read-only file image which is
+ * mapped without a copy.  The extents follow the image.  The capacity of a
+ * new extent is at least the capacity of all previous extents, so the extent
+ * count grows logarithmically with the file size.
+ *
+ * The size must be the first member, see IMFS_memfile_t.
+ */
+typedef struct {
+  off_t                size;        /* size of file in bytes */
+  size_t               capacity;    /* size of the image and the extents */
+  const unsigned char *image;       /* mapped file image or NULL */
+  size_t               image_size;  /* size of the mapped file image */
+  IMFS_extent_t       *extents;     /* first extent or NULL */
+} IMFS_extfile_t;
+
+/**
+ * @brief A compressed tar archive shared by the IMFS tar file nodes.
+ */
+typedef struct IMFS_tar_archive IMFS_tar_archive;
+
+/**
+ * @brief IMFS tar file information.
+ *
+ * A tar file node refers to a file content in a compressed tar archive.  The
+ * content is decompressed on demand in blocks cached by the archive.
+ *
+ * The size must be the first member, see IMFS_extfile_t.
+ */
+typedef struct {
+  off_t             size;         /* size of file in bytes */
+  IMFS_tar_archive *archive;      /* archive containing the file content */
+  off_t             offset;       /* offset of content in the archive data */
+} IMFS_tarfile_t;
+
 /*
  *  Important block numbers for "memfiles"
  */
@@ -157,6 +231,8 @@ typedef union {
   IMFS_sym_link_t    sym_link;
   IMFS_memfile_t     file;
   IMFS_linearfile_t  linearfile;
+  IMFS_extfile_t     extfile;
+  IMFS_tarfile_t     tarfile;
   IMFS_fifo_t        fifo;
   IMFS_generic_t     generic;
 } IMFS_types_union;
@@ -310,6 +386,7 @@ typedef struct {
 struct IMFS_jnode_tt {
   rtems_chain_node    Node;                  /* for chaining them together */
   IMFS_jnode_t       *Parent;                /* Parent node */
+  rtems_rbtree_node   Index_node;            /* for the directory index */
   char                name[IMFS_NAME_MAX+1]; /* "basename" */
   mode_t              st_mode;               /* File mode */
   unsigned short      reference_count;
@@ -379,9 +456,20 @@ extern const IMFS_node_control IMFS_node_control_hard_link;
 extern const IMFS_node_control IMFS_node_control_sym_link;
 extern const IMFS_node_control IMFS_node_control_memfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
+extern const IMFS_node_control IMFS_node_control_extfile;
 extern const IMFS_node_control IMFS_node_control_fifo;
 extern const IMFS_node_control IMFS_node_control_enosys;
 
+/**
+ * @brief The node control used for regular files created via open() or
+ * mknod().
+ *
+ * This is either IMFS_node_control_memfile or IMFS_node_control_extfile.  The
+ * value is provided by the application configuration, see
+ * CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS.
+ */
+extern const IMFS_node_control *const imfs_rq_memfile_node_control;
+
 extern const rtems_filesystem_operations_table miniIMFS_ops;
 extern const rtems_filesystem_operations_table IMFS_ops;
 extern const rtems_filesystem_operations_table fifoIMFS_ops;
@@ -423,55 +511,21 @@ extern void IMFS_fsunmount(
 );
 
 /**
- * @brief RTEMS load tarfs.
- * 
- * This file implements the "mount" procedure for tar-based IMFS
- * extensions.  The TAR is not actually mounted under the IMFS.
- * Directories from the TAR file are created as usual in the IMFS.
- * File entries are created as IMFS_LINEAR_FILE nodes with their nods
- * pointing to addresses in the TAR image.
- *
- * Here we create the mountpoint directory and load the tarfs at
- * that node.  Once the IMFS has been mounted, we work through the
- * tar image and perform as follows:
- *  - For directories, simply call mkdir().  The IMFS creates nodes as
- *    needed.
- *  - For files, we make our own calls to IMFS eval_for_make and
- *    create_node.
- * 
- * TAR file format:
+ * @brief Loads a tar image into an existing IMFS directory.
  *
- * @code
- *   Offset   Length                 Contents
- *     0    100  bytes  File name ('\0' terminated, 99 maxmum length)
- *   100      8  bytes  File mode (in octal ascii)
- *   108      8  bytes  User ID (in octal ascii)
- *   116      8  bytes  Group ID (in octal ascii)
- *   124     12  bytes  File size (s) (in octal ascii)
- *   136     12  bytes  Modify time (in octal ascii)
- *   148      8  bytes  Header checksum (in octal ascii)
- *   156      1  bytes  Link flag
- *   157    100  bytes  Linkname ('\0' terminated, 99 maxmum length)
- *   257      8  bytes  Magic PAX ("ustar\0" + 2 bytes padding)
- *   257      8  bytes  Magic GNU tar ("ustar  \0")
- *   265     32  bytes  User name ('\0' terminated, 31 maxmum length)
- *   297     32  bytes  Group name ('\0' terminated, 31 maxmum length)
- *   329      8  bytes  Major device ID (in octal ascii)
- *   337      8  bytes  Minor device ID (in octal ascii)
- *   345    167  bytes  Padding
- *   512   (s+p) bytes  File contents (s+p) := (((s) + 511) & ~511),
- *                      round up to 512 bytes
- * @endcode
+ * The directories, regular files and symbolic links of the tar image are
+ * created below the mount point with IMFS_tar_load_image(), see
+ * rtems_tarfs_mount().  The content of regular files is mapped without a
+ * copy.  A file is copied into memory on its first modification.
  *
- *  Checksum:
- *  @code
- *    int   i, sum;
- *    char *header = tar_header_pointer;
+ * @param[in] mountpoint The path to an existing directory of an IMFS
+ *   instance.  The mini IMFS is not supported.
+ * @param[in] tar_image The begin of the tar image.
+ * @param[in] tar_size The size of the tar image in bytes.
  *
- *    sum = 0;
- *    for (i = 0; i < 512; i++)
- *        sum += 0xFF & header[i];
- * @endcode
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The @c errno indicates the error.  The nodes
+ *   created before the error are not removed.
  */
 extern int rtems_tarfs_load(
    const char *mountpoint,
@@ -479,6 +533,131 @@ extern int rtems_tarfs_load(
    size_t tar_size
 );
 
+/**
+ * @brief Consumes the decompressed archive data.
+ *
+ * @param[in] arg The argument passed to the scan operation.
+ * @param[in] data The next decompressed data.
+ * @param[in] size The size of the data in bytes.
+ *
+ * @retval 0 Successful operation.
+ * @retval other The error number to abort the scan.
+ */
+typedef int (*rtems_tarfs_consume)( void *arg, const void *data, size_t size );
+
+/**
+ * @brief Decompressor for tar file system images.
+ *
+ * All operations return zero in case of success, otherwise an error number.
+ */
+typedef struct {
+  /**
+   * @brief Returns true if the image is compressed by this decompressor.
+   */
+  bool (*probe)( const void *image, size_t size );
+
+  /**
+   * @brief Decompresses the entire image and passes the data to the consume
+   * function.
+   *
+   * The image is verified.  In case of success a decompressor context is
+   * returned which enables the extract operation.
+   */
+  int (*scan)(
+    const void           *image,
+    size_t                size,
+    rtems_tarfs_consume   consume,
+    void                 *arg,
+    void                **context
+  );
+
+  /**
+   * @brief Decompresses the data area of the specified offset and size.
+   *
+   * The extract operations of a context are serialized by the caller, so the
+   * context may keep a position to continue the decompression of following
+   * data.
+   */
+  int (*extract)( void *context, off_t offset, void *buffer, size_t size );
+
+  /**
+   * @brief Destroys a decompressor context.
+   */
+  void (*destroy)( void *context );
+} rtems_tarfs_decompressor;
+
+/**
+ * @brief The gzip decompressor based on the zlib.
+ *
+ * The scan records an access point for about each MiB of decompressed data.
+ * Each access point needs 32KiB of memory, so the extract operation needs to
+ * decompress at most about one MiB before the requested area.  An extract
+ * following the previously extracted data continues the decompression.
+ *
+ * The application must link with the zlib (libz.a) if it uses this
+ * decompressor.
+ */
+extern const rtems_tarfs_decompressor rtems_tarfs_decompressor_gzip;
+
+/**
+ * @brief Mounts a tar image as a read-only file system.
+ *
+ * A new IMFS instance is mounted read-only at the mount point and populated
+ * with the directories, regular files and symbolic links of the tar image.
+ * Only POSIX and GNU ustar headers are accepted.  The header checksums are
+ * verified.  In case of an error, the file system is unmounted.
+ *
+ * The content of regular files of an uncompressed image is mapped without a
+ * copy, see IMFS_make_mapped_file().
+ *
+ * In case a decompressor is provided and it recognizes the image, then the
+ * entire image is decompressed once to create the file nodes and verify the
+ * image.  The decompressed data is not kept, since the tar headers are spread
+ * over the entire image.  The content of regular files is decompressed on
+ * demand by the read operations in blocks of 16KiB.  The archive caches at
+ * most 16 of these blocks, so the memory used for file content is bounded by
+ * 256KiB independent of the file sizes.
+ *
+ * The image must stay valid and unchanged until the file system is unmounted.
+ *
+ * @param[in] mountpoint The path to an existing directory.
+ * @param[in] image The begin of the tar image.
+ * @param[in] size The size of the tar image in bytes.
+ * @param[in] decompressor The optional decompressor, e.g.
+ *   rtems_tarfs_decompressor_gzip.  May be NULL.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The @c errno indicates the error.
+ */
+extern int rtems_tarfs_mount(
+  const char                     *mountpoint,
+  const void                     *image,
+  size_t                          size,
+  const rtems_tarfs_decompressor *decompressor
+);
+
+/**
+ * @brief Creates the nodes of a tar image below a directory.
+ *
+ * This is the image loader of rtems_tarfs_mount() and rtems_tarfs_load().
+ * The nodes are created directly in the IMFS instance, so the directory may
+ * belong to a read-only file system.
+ *
+ * @param[in] rootloc The location of a directory of an IMFS instance.
+ * @param[in] image The begin of the tar image.
+ * @param[in] size The size of the tar image in bytes.
+ * @param[in] decompressor The optional decompressor.  May be NULL.
+ *
+ * @retval 0 Successful operation.
+ * @retval errno An error occurred.
+ */
+extern int IMFS_tar_load_image(
+  const rtems_filesystem_location_info_t *rootloc,
+  const void                             *image,
+  size_t                                  size,
+  const rtems_tarfs_decompressor         *decompressor
+);
+
 /**
  * @brief Dump the entire IMFS.
  * 
@@ -541,6 +720,24 @@ extern void IMFS_eval_path(
   rtems_filesystem_eval_path_context_t *ctx
 );
 
+/**
+ * @brief Searches a directory entry.
+ *
+ * The current and parent directory tokens yield the directory itself and its
+ * parent.
+ *
+ * @param[in] dir The directory node.
+ * @param[in] token The entry name.  It needs no zero termination.
+ * @param[in] tokenlen The entry name length.
+ *
+ * @return The entry node or NULL if no such entry exists.
+ */
+extern IMFS_jnode_t *IMFS_search_in_directory(
+  IMFS_jnode_t *dir,
+  const char *token,
+  size_t tokenlen
+);
+
 /**
  * @brief Create a new IMFS link node.
  * 
@@ -780,6 +977,75 @@ extern ssize_t memfile_write(
 
 /** @} */
 
+/**
+ * @name IMFS Extent File Handlers
+ *
+ * This section contains the set of handlers used to process operations on
+ * IMFS extent file nodes.  An extent file stores its content in a short list
+ * of contiguous memory areas which grow geometrically.  Thus a read or write
+ * needs at most one memcpy() per extent.  An extent file may start with a
+ * file image which is already in memory, e.g. from a linked-in tar image.
+ * This image is mapped without a copy and copied only in case it is modified.
+ */
+/**@{*/
+
+/**
+ * @brief Makes an IMFS extent file which maps a file image.
+ *
+ * The file image is not copied.  It must stay valid and unchanged for the life
+ * time of the file node.  It may reside in read-only memory since it is copied
+ * before it is modified.
+ *
+ * @param[in] path The path to the new file.
+ * @param[in] mode The file mode.  The file type bits are ignored.
+ * @param[in] image The begin of the file image.
+ * @param[in] size The size of the file image in bytes.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The @c errno indicates the error.
+ */
+extern int IMFS_make_mapped_file(
+  const char *path,
+  mode_t      mode,
+  const void *image,
+  size_t      size
+);
+
+/**
+ * @brief Reads from an extent file.
+ *
+ * This routine processes the read() system call.
+ */
+extern ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+);
+
+/**
+ * @brief Writes to an extent file.
+ *
+ * This routine processes the write() system call.
+ */
+extern ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+);
+
+/**
+ * @brief Truncates an extent file.
+ *
+ * This routine processes the ftruncate() system call.  Extents beyond the new
+ * file size are released.
+ */
+extern int IMFS_extfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+);
+
+/** @} */
+
 /**
  * @name IMFS Device Node Handlers
  *
@@ -921,13 +1187,24 @@ static inline void IMFS_add_to_directory(
 {
   node->Parent = dir;
   rtems_chain_append_unprotected( &dir->info.directory.Entries, &node->Node );
+
+  if ( imfs_rq_directory_index ) {
+    rtems_rbtree_insert( &dir->info.directory.Index, &node->Index_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
-  IMFS_assert( node->Parent != NULL );
+  IMFS_jnode_t *dir = node->Parent;
+
+  IMFS_assert( dir != NULL );
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
+
+  if ( !rtems_rbtree_is_node_off_rbtree( &node->Index_node ) ) {
+    rtems_rbtree_extract( &dir->info.directory.Index, &node->Index_node );
+    rtems_rbtree_set_off_rbtree( &node->Index_node );
+  }
 }
 
 static inline IMFS_jnode_types_t IMFS_type( const IMFS_jnode_t *node )
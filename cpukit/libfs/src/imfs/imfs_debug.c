@@ -24,6 +24,31 @@
 #include <unistd.h>
 #include <stdio.h>
 
+/*
+ *  IMFS_print_extfile
+ *
+ *  This routine prints the mapped file image and the extent list of an
+ *  extent file.
+ */
+static void IMFS_print_extfile(
+  const IMFS_extfile_t *file
+)
+{
+  const IMFS_extent_t *extent;
+
+  fprintf(stdout, " (extent file %" PRIu32, (uint32_t)file->size );
+
+  if ( file->image != NULL )
+    fprintf(stdout, " image %p %" PRIu32,
+      file->image, (uint32_t)file->image_size );
+
+  for ( extent = file->extents ; extent != NULL ; extent = extent->next )
+    fprintf(stdout, " extent %p %" PRIu32,
+      extent->data, (uint32_t)extent->capacity );
+
+  fprintf(stdout, ")" );
+}
+
 /*
  *  IMFS_print_jnode
  *
@@ -54,6 +79,12 @@ static void IMFS_print_jnode(
       break;
 
     case IMFS_MEMORY_FILE:
+      /* Extent files share the type but not the memory file information */
+      if ( the_jnode->control == &IMFS_node_control_extfile ) {
+        IMFS_print_extfile( &the_jnode->info.extfile );
+        break;
+      }
+
       /* Useful when debugging .. varies between targets  */
 #if 0
       fprintf(stdout, " (file %" PRId32 " %p %p %p)",
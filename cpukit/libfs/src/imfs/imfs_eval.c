@@ -37,7 +37,42 @@ static bool IMFS_eval_is_directory(
   return IMFS_is_directory( node );
 }
 
-static IMFS_jnode_t *IMFS_search_in_directory(
+static IMFS_jnode_t *IMFS_search_in_directory_index(
+  IMFS_jnode_t *dir,
+  const char *token,
+  size_t tokenlen
+)
+{
+  rtems_rbtree_node *current = rtems_rbtree_root( &dir->info.directory.Index );
+
+  /*
+   * The token is not zero terminated, so we cannot use rtems_rbtree_find()
+   * here.  The order must agree with the strcmp() used to insert the nodes.
+   */
+  while ( current != NULL ) {
+    IMFS_jnode_t *entry =
+      rtems_rbtree_container_of( current, IMFS_jnode_t, Index_node );
+    int cmp = strncmp( entry->name, token, tokenlen );
+
+    if ( cmp == 0 ) {
+      if ( entry->name [tokenlen] == '\0' ) {
+        return entry;
+      }
+
+      cmp = 1;
+    }
+
+    if ( cmp > 0 ) {
+      current = rtems_rbtree_left( current );
+    } else {
+      current = rtems_rbtree_right( current );
+    }
+  }
+
+  return NULL;
+}
+
+IMFS_jnode_t *IMFS_search_in_directory(
   IMFS_jnode_t *dir,
   const char *token,
   size_t tokenlen
@@ -48,6 +83,8 @@ static IMFS_jnode_t *IMFS_search_in_directory(
   } else {
     if ( rtems_filesystem_is_parent_directory( token, tokenlen ) ) {
       return dir->Parent;
+    } else if ( imfs_rq_directory_index ) {
+      return IMFS_search_in_directory_index( dir, token, tokenlen );
     } else {
       rtems_chain_control *entries = &dir->info.directory.Entries;
       rtems_chain_node *current = rtems_chain_first( entries );
@@ -0,0 +1,461 @@
+/**
+ * @file
+ *
+ * @brief IMFS Extent File Support
+ * @ingroup IMFS
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "imfs.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum {
+  IMFS_EXTFILE_READ,
+  IMFS_EXTFILE_WRITE,
+  IMFS_EXTFILE_ZERO
+} IMFS_extfile_operation;
+
+/*
+ * Copies a file area to the destination buffer or from the source buffer, or
+ * fills it with zeros.  The area must be within the file capacity.  Only read
+ * operations may access the mapped file image.
+ */
+static void IMFS_extfile_copy(
+  const IMFS_extfile_t    *file,
+  size_t                   start,
+  unsigned char           *destination,
+  const unsigned char     *source,
+  size_t                   length,
+  IMFS_extfile_operation   operation
+)
+{
+  const IMFS_extent_t *extent = file->extents;
+  size_t begin = file->image_size;
+
+  IMFS_assert( start + length <= file->capacity );
+
+  if ( start < begin ) {
+    size_t n = begin - start;
+
+    IMFS_assert( operation == IMFS_EXTFILE_READ );
+
+    if ( n > length ) {
+      n = length;
+    }
+
+    memcpy( destination, &file->image [start], n );
+    destination += n;
+    start += n;
+    length -= n;
+  }
+
+  while ( length > 0 ) {
+    size_t end = begin + extent->capacity;
+
+    if ( start < end ) {
+      unsigned char *data = (unsigned char *) &extent->data [start - begin];
+      size_t n = end - start;
+
+      if ( n > length ) {
+        n = length;
+      }
+
+      switch ( operation ) {
+        case IMFS_EXTFILE_READ:
+          memcpy( destination, data, n );
+          destination += n;
+          break;
+        case IMFS_EXTFILE_WRITE:
+          memcpy( data, source, n );
+          source += n;
+          break;
+        default:
+          IMFS_assert( operation == IMFS_EXTFILE_ZERO );
+          memset( data, 0, n );
+          break;
+      }
+
+      start += n;
+      length -= n;
+    }
+
+    begin = end;
+    extent = extent->next;
+  }
+}
+
+/*
+ * Replaces the mapped file image with a copy in a new first extent.  The
+ * capacity of this extent is the image size, so the offsets of the other
+ * extents do not change.
+ */
+static int IMFS_extfile_unmap( IMFS_extfile_t *file )
+{
+  size_t image_size = file->image_size;
+
+  if ( image_size > 0 ) {
+    IMFS_extent_t *extent = malloc( sizeof( *extent ) + image_size );
+
+    if ( extent == NULL ) {
+      errno = ENOSPC;
+
+      return -1;
+    }
+
+    extent->next = file->extents;
+    extent->capacity = image_size;
+    memcpy( extent->data, file->image, image_size );
+    file->extents = extent;
+  }
+
+  file->image = NULL;
+  file->image_size = 0;
+
+  return 0;
+}
+
+/*
+ * Ensures that the file capacity is at least the new capacity.  The new extent
+ * is at least as large as all previous extents together.  In case this
+ * allocation fails, then we try to allocate only the missing capacity.
+ */
+static int IMFS_extfile_reserve( IMFS_extfile_t *file, size_t new_capacity )
+{
+  if ( new_capacity > file->capacity ) {
+    size_t missing = new_capacity - file->capacity;
+    size_t capacity = file->capacity;
+    IMFS_extent_t *extent = NULL;
+    IMFS_extent_t **link;
+
+    if ( capacity < (size_t) IMFS_MEMFILE_BYTES_PER_BLOCK ) {
+      capacity = (size_t) IMFS_MEMFILE_BYTES_PER_BLOCK;
+    }
+
+    if ( capacity > missing && capacity <= SIZE_MAX - sizeof( *extent ) ) {
+      extent = malloc( sizeof( *extent ) + capacity );
+    }
+
+    if ( extent == NULL ) {
+      capacity = missing;
+
+      if ( capacity <= SIZE_MAX - sizeof( *extent ) ) {
+        extent = malloc( sizeof( *extent ) + capacity );
+      }
+
+      if ( extent == NULL ) {
+        errno = ENOSPC;
+
+        return -1;
+      }
+    }
+
+    link = &file->extents;
+    while ( *link != NULL ) {
+      link = &(*link)->next;
+    }
+
+    extent->next = NULL;
+    extent->capacity = capacity;
+    *link = extent;
+    file->capacity += capacity;
+  }
+
+  return 0;
+}
+
+/*
+ * Prepares the file for a modification of the area starting at the current
+ * file size or the start offset, whatever is less, up to the end offset.  The
+ * area between the current file size and the start offset is filled with
+ * zeros.
+ */
+static int IMFS_extfile_prepare_modify(
+  IMFS_extfile_t *file,
+  off_t           start,
+  off_t           end
+)
+{
+  size_t size = (size_t) file->size;
+  int rv;
+
+  if ( (uintmax_t) end > SIZE_MAX ) {
+    errno = EFBIG;
+
+    return -1;
+  }
+
+  if (
+    file->image != NULL
+      && ( (uintmax_t) start < file->image_size || size < file->image_size )
+  ) {
+    rv = IMFS_extfile_unmap( file );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  }
+
+  rv = IMFS_extfile_reserve( file, (size_t) end );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  if ( (uintmax_t) start > size ) {
+    IMFS_extfile_copy(
+      file,
+      size,
+      NULL,
+      NULL,
+      (size_t) start - size,
+      IMFS_EXTFILE_ZERO
+    );
+  }
+
+  return 0;
+}
+
+ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_jnode_t *node = iop->pathinfo.node_access;
+  const IMFS_extfile_t *file = &node->info.extfile;
+  off_t start = iop->offset;
+
+  if ( start >= file->size ) {
+    return 0;
+  }
+
+  if ( (uintmax_t) count > (uintmax_t) ( file->size - start ) ) {
+    count = (size_t) ( file->size - start );
+  }
+
+  IMFS_extfile_copy(
+    file,
+    (size_t) start,
+    buffer,
+    NULL,
+    count,
+    IMFS_EXTFILE_READ
+  );
+  iop->offset += count;
+
+  IMFS_update_atime( node );
+
+  return (ssize_t) count;
+}
+
+ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_jnode_t *node = iop->pathinfo.node_access;
+  IMFS_extfile_t *file = &node->info.extfile;
+  off_t start;
+  off_t end;
+  int rv;
+
+  if ( ( iop->flags & LIBIO_FLAGS_APPEND ) != 0 ) {
+    iop->offset = file->size;
+  }
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  start = iop->offset;
+
+  if ( (uintmax_t) start > SIZE_MAX - count ) {
+    errno = EFBIG;
+
+    return -1;
+  }
+
+  end = start + (off_t) count;
+
+  rv = IMFS_extfile_prepare_modify( file, start, end );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  IMFS_extfile_copy(
+    file,
+    (size_t) start,
+    NULL,
+    buffer,
+    count,
+    IMFS_EXTFILE_WRITE
+  );
+
+  if ( end > file->size ) {
+    file->size = end;
+  }
+
+  iop->offset = end;
+
+  IMFS_mtime_ctime_update( node );
+
+  return (ssize_t) count;
+}
+
+int IMFS_extfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+)
+{
+  IMFS_jnode_t *node = iop->pathinfo.node_access;
+  IMFS_extfile_t *file = &node->info.extfile;
+
+  if ( length > file->size ) {
+    int rv = IMFS_extfile_prepare_modify( file, length, length );
+
+    if ( rv != 0 ) {
+      return rv;
+    }
+  } else {
+    IMFS_extent_t **link = &file->extents;
+    size_t begin = file->image_size;
+
+    while ( *link != NULL && (uintmax_t) begin < (uintmax_t) length ) {
+      begin += (*link)->capacity;
+      link = &(*link)->next;
+    }
+
+    while ( *link != NULL ) {
+      IMFS_extent_t *extent = *link;
+
+      *link = extent->next;
+      free( extent );
+    }
+
+    file->capacity = begin;
+  }
+
+  file->size = length;
+
+  IMFS_mtime_ctime_update( node );
+
+  return 0;
+}
+
+static int IMFS_stat_extfile(
+  const rtems_filesystem_location_info_t *loc,
+  struct stat *buf
+)
+{
+  const IMFS_jnode_t *node = loc->node_access;
+
+  buf->st_size = node->info.extfile.size;
+  buf->st_blksize = imfs_rq_memfile_bytes_per_block;
+
+  return IMFS_stat( loc, buf );
+}
+
+static IMFS_jnode_t *IMFS_node_destroy_extfile( IMFS_jnode_t *node )
+{
+  IMFS_extent_t *extent = node->info.extfile.extents;
+
+  while ( extent != NULL ) {
+    IMFS_extent_t *next = extent->next;
+
+    free( extent );
+    extent = next;
+  }
+
+  return node;
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_extfile,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_node_control IMFS_node_control_extfile = {
+  .imfs_type = IMFS_MEMORY_FILE,
+  .handlers = &IMFS_extfile_handlers,
+  .node_initialize = IMFS_node_initialize_default,
+  .node_remove = IMFS_node_remove_default,
+  .node_destroy = IMFS_node_destroy_extfile
+};
+
+int IMFS_make_mapped_file(
+  const char *path,
+  mode_t      mode,
+  const void *image,
+  size_t      size
+)
+{
+  int rv = 0;
+  rtems_filesystem_eval_path_context_t ctx;
+  int eval_flags = RTEMS_FS_FOLLOW_LINK
+    | RTEMS_FS_MAKE
+    | RTEMS_FS_EXCLUSIVE;
+  const rtems_filesystem_location_info_t *currentloc =
+    rtems_filesystem_eval_path_start( &ctx, path, eval_flags );
+
+  mode = ( mode & ~( S_IFMT | rtems_filesystem_umask ) ) | S_IFREG;
+
+  if ( IMFS_is_imfs_instance( currentloc ) ) {
+    IMFS_jnode_t *node = IMFS_create_node_with_control(
+      currentloc,
+      &IMFS_node_control_extfile,
+      rtems_filesystem_eval_path_get_token( &ctx ),
+      rtems_filesystem_eval_path_get_tokenlen( &ctx ),
+      mode,
+      NULL
+    );
+
+    if ( node != NULL ) {
+      IMFS_jnode_t *parent = currentloc->node_access;
+      IMFS_extfile_t *file = &node->info.extfile;
+
+      file->size = (off_t) size;
+      file->capacity = size;
+      file->image = image;
+      file->image_size = size;
+
+      IMFS_mtime_ctime_update( parent );
+    } else {
+      rv = -1;
+    }
+  } else {
+    rtems_filesystem_eval_path_error( &ctx, ENOTSUP );
+    rv = -1;
+  }
+
+  rtems_filesystem_eval_path_cleanup( &ctx );
+
+  return rv;
+}
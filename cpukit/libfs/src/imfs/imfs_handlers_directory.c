@@ -21,6 +21,7 @@
 #include "imfs.h"
 
 #include <dirent.h>
+#include <string.h>
 
 static size_t IMFS_directory_size( const IMFS_jnode_t *node )
 {
@@ -67,12 +68,30 @@ static const rtems_filesystem_file_handlers_r IMFS_directory_handlers = {
   .writev_h = rtems_filesystem_default_writev
 };
 
+static int IMFS_directory_index_compare(
+  const rtems_rbtree_node *a,
+  const rtems_rbtree_node *b
+)
+{
+  const IMFS_jnode_t *node_a =
+    rtems_rbtree_container_of( a, IMFS_jnode_t, Index_node );
+  const IMFS_jnode_t *node_b =
+    rtems_rbtree_container_of( b, IMFS_jnode_t, Index_node );
+
+  return strcmp( node_a->name, node_b->name );
+}
+
 static IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_jnode_t *node,
   const IMFS_types_union *info
 )
 {
   rtems_chain_initialize_empty( &node->info.directory.Entries );
+  rtems_rbtree_initialize_empty(
+    &node->info.directory.Index,
+    IMFS_directory_index_compare,
+    false
+  );
 
   return node;
 }
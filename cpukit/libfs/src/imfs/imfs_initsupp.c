@@ -76,6 +76,17 @@ int IMFS_initialize_support(
       sizeof( fs_info->node_controls )
     );
 
+    /*
+     * The application configuration may replace the default memory file node
+     * control with the extent file node control.
+     */
+    if (
+      fs_info->node_controls [IMFS_MEMORY_FILE] == &IMFS_node_control_memfile
+    ) {
+      fs_info->node_controls [IMFS_MEMORY_FILE] =
+        imfs_rq_memfile_node_control;
+    }
+
     root_node = IMFS_allocate_node(
       fs_info,
       fs_info->node_controls [IMFS_DIRECTORY],
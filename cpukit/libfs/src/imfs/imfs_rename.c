@@ -41,10 +41,15 @@ int IMFS_rename(
 
   if ( node->Parent != NULL ) {
     if ( namelen < IMFS_NAME_MAX ) {
+      /*
+       * Change the name while the node is not part of a directory, otherwise
+       * the directory index would be out of order.
+       */
+      IMFS_remove_from_directory( node );
+
       memcpy( node->name, name, namelen );
       node->name [namelen] = '\0';
 
-      IMFS_remove_from_directory( node );
       IMFS_add_to_directory( new_parent, node );
       IMFS_update_ctime( node );
     } else {
@@ -0,0 +1,753 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Mount Tar File System
+ * @ingroup IMFS
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "imfs.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tar.h>
+
+#include <rtems/untar.h>
+
+#define IMFS_TAR_BLOCK_SIZE 512
+
+#define IMFS_TAR_NAME_SIZE 100
+
+#define IMFS_TAR_PREFIX_SIZE 155
+
+#define IMFS_TAR_DEFAULT_DIRECTORY_MODE \
+  ( S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH )
+
+/*
+ * The decompressed content of regular files is read through a cache of fixed
+ * size blocks shared by all files of an archive.  The blocks are aligned with
+ * respect to the decompressed archive data.
+ */
+#define IMFS_TAR_CACHE_BLOCK_SIZE 16384
+
+#define IMFS_TAR_CACHE_BLOCK_COUNT 16
+
+typedef struct {
+  unsigned char *data;
+  off_t          offset;    /* offset of the block in the archive data */
+  size_t         size;      /* valid data size, zero for an unused block */
+  uint32_t       last_use;
+} IMFS_tar_cache_block;
+
+struct IMFS_tar_archive {
+  const rtems_tarfs_decompressor *decompressor;
+  void                           *context;
+  uint32_t                        references;
+  off_t                           size;
+  uint32_t                        use_count;
+  IMFS_tar_cache_block            blocks[ IMFS_TAR_CACHE_BLOCK_COUNT ];
+};
+
+typedef struct {
+  rtems_filesystem_location_info_t  rootloc;
+  const unsigned char              *image;
+  size_t                            image_size;
+  IMFS_tar_archive                 *archive;
+  off_t                             offset;
+  off_t                             skip;
+  size_t                            header_fill;
+  bool                              end;
+  char                              header[ IMFS_TAR_BLOCK_SIZE ];
+} IMFS_tar_loader;
+
+static void IMFS_tar_archive_release( IMFS_tar_archive *archive )
+{
+  --archive->references;
+
+  if ( archive->references == 0 ) {
+    size_t i;
+
+    if ( archive->context != NULL ) {
+      ( *archive->decompressor->destroy )( archive->context );
+    }
+
+    for ( i = 0; i < IMFS_TAR_CACHE_BLOCK_COUNT; ++i ) {
+      free( archive->blocks[ i ].data );
+    }
+
+    free( archive );
+  }
+}
+
+/*
+ * Returns the cache block containing the archive data at the block offset.
+ * In case the block is not cached, then the least recently used block is
+ * replaced.  The file system instance lock must be held.
+ */
+static int IMFS_tar_cache_get(
+  IMFS_tar_archive            *archive,
+  off_t                        offset,
+  const IMFS_tar_cache_block **block_ptr
+)
+{
+  IMFS_tar_cache_block *victim = &archive->blocks[ 0 ];
+  IMFS_tar_cache_block *block;
+  size_t i;
+  int eno;
+
+  ++archive->use_count;
+
+  for ( i = 0; i < IMFS_TAR_CACHE_BLOCK_COUNT; ++i ) {
+    block = &archive->blocks[ i ];
+
+    if ( block->size > 0 && block->offset == offset ) {
+      block->last_use = archive->use_count;
+      *block_ptr = block;
+
+      return 0;
+    }
+
+    if (
+      block->size == 0
+        || ( victim->size > 0
+          && archive->use_count - block->last_use
+            > archive->use_count - victim->last_use )
+    ) {
+      victim = block;
+    }
+  }
+
+  block = victim;
+
+  if ( block->data == NULL ) {
+    block->data = malloc( IMFS_TAR_CACHE_BLOCK_SIZE );
+    if ( block->data == NULL ) {
+      return ENOMEM;
+    }
+  }
+
+  block->size = IMFS_TAR_CACHE_BLOCK_SIZE;
+  if ( (uintmax_t) block->size > (uintmax_t) ( archive->size - offset ) ) {
+    block->size = (size_t) ( archive->size - offset );
+  }
+
+  eno = ( *archive->decompressor->extract )(
+    archive->context,
+    offset,
+    block->data,
+    block->size
+  );
+  if ( eno != 0 ) {
+    block->size = 0;
+
+    return eno;
+  }
+
+  block->offset = offset;
+  block->last_use = archive->use_count;
+  *block_ptr = block;
+
+  return 0;
+}
+
+/*
+ * Copies the file content through the block cache.  Complete blocks which are
+ * not cached are decompressed directly into the buffer, so that a large read
+ * does not evict the cached blocks.  The file system instance lock must be
+ * held.
+ */
+static int IMFS_tarfile_copy(
+  const IMFS_tarfile_t *file,
+  off_t                 start,
+  unsigned char        *buffer,
+  size_t                count
+)
+{
+  IMFS_tar_archive *archive = file->archive;
+  off_t offset = file->offset + start;
+
+  if ( archive->context == NULL ) {
+    return EBUSY;
+  }
+
+  while ( count > 0 ) {
+    off_t block_offset = offset & ~(off_t) ( IMFS_TAR_CACHE_BLOCK_SIZE - 1 );
+    size_t begin = (size_t) ( offset - block_offset );
+    size_t n = IMFS_TAR_CACHE_BLOCK_SIZE - begin;
+    const IMFS_tar_cache_block *block;
+    int eno;
+
+    if ( n > count ) {
+      n = count;
+    }
+
+    if ( n == IMFS_TAR_CACHE_BLOCK_SIZE ) {
+      size_t i;
+
+      block = NULL;
+
+      for ( i = 0; i < IMFS_TAR_CACHE_BLOCK_COUNT; ++i ) {
+        if (
+          archive->blocks[ i ].size > 0
+            && archive->blocks[ i ].offset == block_offset
+        ) {
+          block = &archive->blocks[ i ];
+        }
+      }
+
+      if ( block == NULL ) {
+        eno = ( *archive->decompressor->extract )(
+          archive->context,
+          offset,
+          buffer,
+          n
+        );
+        if ( eno != 0 ) {
+          return eno;
+        }
+      }
+    } else {
+      eno = IMFS_tar_cache_get( archive, block_offset, &block );
+      if ( eno != 0 ) {
+        return eno;
+      }
+    }
+
+    if ( block != NULL ) {
+      memcpy( buffer, &block->data[ begin ], n );
+    }
+
+    offset += (off_t) n;
+    buffer += n;
+    count -= n;
+  }
+
+  return 0;
+}
+
+static ssize_t IMFS_tarfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_jnode_t *node = iop->pathinfo.node_access;
+  const IMFS_tarfile_t *file = &node->info.tarfile;
+  off_t start = iop->offset;
+  int eno;
+
+  if ( start >= file->size ) {
+    return 0;
+  }
+
+  if ( (uintmax_t) count > (uintmax_t) ( file->size - start ) ) {
+    count = (size_t) ( file->size - start );
+  }
+
+  rtems_filesystem_instance_lock( &iop->pathinfo );
+  eno = IMFS_tarfile_copy( file, start, buffer, count );
+  rtems_filesystem_instance_unlock( &iop->pathinfo );
+
+  if ( eno != 0 ) {
+    rtems_set_errno_and_return_minus_one( eno );
+  }
+
+  iop->offset += count;
+
+  IMFS_update_atime( node );
+
+  return (ssize_t) count;
+}
+
+static int IMFS_stat_tarfile(
+  const rtems_filesystem_location_info_t *loc,
+  struct stat *buf
+)
+{
+  const IMFS_jnode_t *node = loc->node_access;
+
+  buf->st_size = node->info.tarfile.size;
+  buf->st_blksize = imfs_rq_memfile_bytes_per_block;
+
+  return IMFS_stat( loc, buf );
+}
+
+static IMFS_jnode_t *IMFS_node_destroy_tarfile( IMFS_jnode_t *node )
+{
+  IMFS_tar_archive_release( node->info.tarfile.archive );
+
+  return node;
+}
+
+/*
+ * The file system is read-only, so the open for writing fails before the
+ * write and truncate handlers are reachable.
+ */
+static const rtems_filesystem_file_handlers_r IMFS_tarfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_tarfile_read,
+  .write_h = rtems_filesystem_default_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_tarfile,
+  .ftruncate_h = rtems_filesystem_default_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+static const IMFS_node_control IMFS_node_control_tarfile = {
+  .imfs_type = IMFS_MEMORY_FILE,
+  .handlers = &IMFS_tarfile_handlers,
+  .node_initialize = IMFS_node_initialize_default,
+  .node_remove = IMFS_node_remove_default,
+  .node_destroy = IMFS_node_destroy_tarfile
+};
+
+static IMFS_jnode_t *IMFS_tar_make_file(
+  IMFS_tar_loader                        *loader,
+  const rtems_filesystem_location_info_t *parentloc,
+  const char                             *name,
+  size_t                                  namelen,
+  mode_t                                  mode,
+  off_t                                   size
+)
+{
+  IMFS_jnode_t *node;
+
+  if ( loader->image != NULL ) {
+    if ( (uintmax_t) size > loader->image_size - (size_t) loader->offset ) {
+      errno = EINVAL;
+
+      return NULL;
+    }
+
+    node = IMFS_create_node_with_control(
+      parentloc,
+      &IMFS_node_control_extfile,
+      name,
+      namelen,
+      mode | S_IFREG,
+      NULL
+    );
+    if ( node != NULL ) {
+      IMFS_extfile_t *file = &node->info.extfile;
+
+      file->size = size;
+      file->capacity = (size_t) size;
+      file->image = &loader->image[ loader->offset ];
+      file->image_size = (size_t) size;
+    }
+  } else {
+    node = IMFS_create_node_with_control(
+      parentloc,
+      size > 0 ? &IMFS_node_control_tarfile : &IMFS_node_control_extfile,
+      name,
+      namelen,
+      mode | S_IFREG,
+      NULL
+    );
+    if ( node != NULL && size > 0 ) {
+      IMFS_tarfile_t *file = &node->info.tarfile;
+
+      file->size = size;
+      file->archive = loader->archive;
+      file->offset = loader->offset;
+      ++loader->archive->references;
+    }
+  }
+
+  return node;
+}
+
+static int IMFS_tar_make_node(
+  IMFS_tar_loader *loader,
+  const char      *path,
+  const char      *header,
+  mode_t           mode,
+  off_t            size,
+  time_t           mtime
+)
+{
+  rtems_filesystem_location_info_t parentloc = loader->rootloc;
+  IMFS_jnode_t *dir = loader->rootloc.node_access;
+  IMFS_jnode_t *node;
+  const char *token;
+  size_t tokenlen;
+
+  /* Walk along the path and create missing intermediate directories */
+  while ( true ) {
+    while ( *path == '/' ) {
+      ++path;
+    }
+
+    token = path;
+    while ( *path != '\0' && *path != '/' ) {
+      ++path;
+    }
+
+    tokenlen = (size_t) ( path - token );
+
+    while ( *path == '/' ) {
+      ++path;
+    }
+
+    if ( tokenlen == 0 ) {
+      /* This is the root directory itself */
+      return 0;
+    }
+
+    if ( rtems_filesystem_is_parent_directory( token, tokenlen ) ) {
+      return EINVAL;
+    }
+
+    if ( *path == '\0' ) {
+      if ( rtems_filesystem_is_current_directory( token, tokenlen ) ) {
+        return 0;
+      }
+
+      break;
+    }
+
+    node = IMFS_search_in_directory( dir, token, tokenlen );
+
+    if ( node == NULL ) {
+      parentloc.node_access = dir;
+      node = IMFS_create_node(
+        &parentloc,
+        IMFS_DIRECTORY,
+        token,
+        tokenlen,
+        IMFS_TAR_DEFAULT_DIRECTORY_MODE | S_IFDIR,
+        NULL
+      );
+      if ( node == NULL ) {
+        return errno;
+      }
+    } else if ( !IMFS_is_directory( node ) ) {
+      return ENOTDIR;
+    }
+
+    dir = node;
+  }
+
+  node = IMFS_search_in_directory( dir, token, tokenlen );
+  parentloc.node_access = dir;
+
+  switch ( header[ 156 ] ) {
+    case REGTYPE:
+    case AREGTYPE:
+      if ( node != NULL ) {
+        return EEXIST;
+      }
+
+      node = IMFS_tar_make_file(
+        loader,
+        &parentloc,
+        token,
+        tokenlen,
+        mode,
+        size
+      );
+      break;
+    case DIRTYPE:
+      if ( node != NULL ) {
+        if ( !IMFS_is_directory( node ) ) {
+          return EEXIST;
+        }
+
+        /* An implicitly created directory gets the mode of the archive */
+        node->st_mode = mode | S_IFDIR;
+      } else {
+        node = IMFS_create_node(
+          &parentloc,
+          IMFS_DIRECTORY,
+          token,
+          tokenlen,
+          mode | S_IFDIR,
+          NULL
+        );
+      }
+      break;
+    case SYMTYPE: {
+      char target[ IMFS_TAR_NAME_SIZE + 1 ];
+
+      if ( node != NULL ) {
+        return EEXIST;
+      }
+
+      memcpy( target, &header[ 157 ], IMFS_TAR_NAME_SIZE );
+      target[ IMFS_TAR_NAME_SIZE ] = '\0';
+
+      if ( IMFS_symlink( &parentloc, token, tokenlen, target ) == 0 ) {
+        node = IMFS_search_in_directory( dir, token, tokenlen );
+      }
+      break;
+    }
+    default:
+      /* Other entry types, e.g. hard links and devices, are ignored */
+      return 0;
+  }
+
+  if ( node == NULL ) {
+    return errno;
+  }
+
+  node->stat_mtime = mtime;
+
+  return 0;
+}
+
+static bool IMFS_tar_is_end_of_archive( const char *header )
+{
+  size_t i;
+
+  for ( i = 0; i < IMFS_TAR_BLOCK_SIZE; ++i ) {
+    if ( header[ i ] != '\0' ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static int IMFS_tar_process_header( IMFS_tar_loader *loader )
+{
+  const char *header = loader->header;
+  char path[ IMFS_TAR_PREFIX_SIZE + 1 + IMFS_TAR_NAME_SIZE + 1 ];
+  size_t prefixlen = 0;
+  size_t namelen;
+  unsigned long checksum;
+  mode_t mode;
+  off_t size;
+  time_t mtime;
+  int eno;
+
+  if ( IMFS_tar_is_end_of_archive( header ) ) {
+    loader->end = true;
+
+    return 0;
+  }
+
+  if ( strncmp( &header[ 257 ], "ustar", 5 ) != 0 ) {
+    return EINVAL;
+  }
+
+  checksum = _rtems_octal2ulong( &header[ 148 ], 8 );
+  if ( (unsigned long) _rtems_tar_header_checksum( header ) != checksum ) {
+    return EINVAL;
+  }
+
+  mode = (mode_t) _rtems_octal2ulong( &header[ 100 ], 8 )
+    & ( S_IRWXU | S_IRWXG | S_IRWXO );
+  size = (off_t) _rtems_octal2ulong( &header[ 124 ], 12 );
+  mtime = (time_t) _rtems_octal2ulong( &header[ 136 ], 12 );
+
+  /* Only the POSIX format has a name prefix, GNU uses this area otherwise */
+  if ( header[ 262 ] == '\0' ) {
+    prefixlen = strnlen( &header[ 345 ], IMFS_TAR_PREFIX_SIZE );
+    memcpy( path, &header[ 345 ], prefixlen );
+
+    if ( prefixlen > 0 ) {
+      path[ prefixlen ] = '/';
+      ++prefixlen;
+    }
+  }
+
+  namelen = strnlen( header, IMFS_TAR_NAME_SIZE );
+  memcpy( &path[ prefixlen ], header, namelen );
+  path[ prefixlen + namelen ] = '\0';
+
+  rtems_filesystem_instance_lock( &loader->rootloc );
+  eno = IMFS_tar_make_node( loader, path, header, mode, size, mtime );
+  rtems_filesystem_instance_unlock( &loader->rootloc );
+
+  loader->skip = ( size + IMFS_TAR_BLOCK_SIZE - 1 )
+    & ~(off_t) ( IMFS_TAR_BLOCK_SIZE - 1 );
+
+  return eno;
+}
+
+static int IMFS_tar_consume( void *arg, const void *data, size_t size )
+{
+  IMFS_tar_loader *loader = arg;
+  const char *in = data;
+  int eno = 0;
+
+  while ( size > 0 && !loader->end && eno == 0 ) {
+    size_t n;
+
+    if ( loader->skip > 0 ) {
+      n = size;
+
+      if ( (uintmax_t) n > (uintmax_t) loader->skip ) {
+        n = (size_t) loader->skip;
+      }
+
+      loader->skip -= (off_t) n;
+    } else {
+      n = IMFS_TAR_BLOCK_SIZE - loader->header_fill;
+
+      if ( n > size ) {
+        n = size;
+      }
+
+      memcpy( &loader->header[ loader->header_fill ], in, n );
+      loader->header_fill += n;
+    }
+
+    loader->offset += (off_t) n;
+    in += n;
+    size -= n;
+
+    if ( loader->header_fill == IMFS_TAR_BLOCK_SIZE ) {
+      loader->header_fill = 0;
+      eno = IMFS_tar_process_header( loader );
+    }
+  }
+
+  return eno;
+}
+
+static int IMFS_tar_load(
+  IMFS_tar_loader                *loader,
+  const void                     *image,
+  size_t                          size,
+  const rtems_tarfs_decompressor *decompressor
+)
+{
+  int eno;
+
+  if (
+    decompressor != NULL
+      && ( *decompressor->probe )( image, size )
+  ) {
+    IMFS_tar_archive *archive = calloc( 1, sizeof( *archive ) );
+    void *context = NULL;
+
+    if ( archive == NULL ) {
+      return ENOMEM;
+    }
+
+    archive->decompressor = decompressor;
+    archive->references = 1;
+    loader->archive = archive;
+
+    eno = ( *decompressor->scan )(
+      image,
+      size,
+      IMFS_tar_consume,
+      loader,
+      &context
+    );
+
+    rtems_filesystem_instance_lock( &loader->rootloc );
+
+    if ( eno == 0 ) {
+      archive->context = context;
+      archive->size = loader->offset;
+    }
+
+    IMFS_tar_archive_release( archive );
+
+    rtems_filesystem_instance_unlock( &loader->rootloc );
+  } else {
+    loader->image = image;
+    loader->image_size = size;
+
+    eno = IMFS_tar_consume( loader, image, size );
+  }
+
+  if ( eno == 0 && ( loader->skip > 0 || loader->header_fill > 0 ) ) {
+    eno = EINVAL;
+  }
+
+  return eno;
+}
+
+int IMFS_tar_load_image(
+  const rtems_filesystem_location_info_t *rootloc,
+  const void                             *image,
+  size_t                                  size,
+  const rtems_tarfs_decompressor         *decompressor
+)
+{
+  IMFS_tar_loader loader;
+
+  if ( !IMFS_is_directory( rootloc->node_access ) ) {
+    return ENOTDIR;
+  }
+
+  memset( &loader, 0, sizeof( loader ) );
+  loader.rootloc = *rootloc;
+
+  return IMFS_tar_load( &loader, image, size, decompressor );
+}
+
+int rtems_tarfs_mount(
+  const char                     *mountpoint,
+  const void                     *image,
+  size_t                          size,
+  const rtems_tarfs_decompressor *decompressor
+)
+{
+  rtems_filesystem_eval_path_context_t ctx;
+  rtems_filesystem_location_info_t rootloc;
+  int rv;
+  int eno;
+
+  rv = mount(
+    NULL,
+    mountpoint,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_ONLY,
+    NULL
+  );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  /*
+   * The nodes are created directly in the mounted file system, since the path
+   * evaluation rejects new nodes in a read-only file system.
+   */
+  rtems_filesystem_eval_path_start( &ctx, mountpoint, RTEMS_FS_FOLLOW_LINK );
+  rtems_filesystem_eval_path_extract_currentloc( &ctx, &rootloc );
+  rtems_filesystem_eval_path_cleanup( &ctx );
+
+  if ( IMFS_is_imfs_instance( &rootloc ) ) {
+    eno = IMFS_tar_load_image( &rootloc, image, size, decompressor );
+  } else {
+    eno = ENOTSUP;
+  }
+
+  rtems_filesystem_location_free( &rootloc );
+
+  if ( eno != 0 ) {
+    unmount( mountpoint );
+    errno = eno;
+    rv = -1;
+  }
+
+  return rv;
+}
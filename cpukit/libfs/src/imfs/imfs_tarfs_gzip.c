@@ -0,0 +1,439 @@
+/**
+ * @file
+ *
+ * @brief RTEMS Tar File System Gzip Decompressor
+ * @ingroup IMFS
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "imfs.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+/*
+ * The deflate format uses back references of up to 32KiB, so this is the
+ * amount of decompressed data necessary to start a decompression at a block
+ * boundary.
+ */
+#define IMFS_TAR_GZIP_WINDOW_SIZE 32768
+
+/* Distance between access points in the decompressed data */
+#define IMFS_TAR_GZIP_SPAN ( 1024 * 1024 )
+
+/* Raw deflate data */
+#define IMFS_TAR_GZIP_RAW_WINDOW_BITS ( -15 )
+
+/* Deflate data with gzip header and trailer */
+#define IMFS_TAR_GZIP_WINDOW_BITS ( 15 + 16 )
+
+/*
+ * An access point enables the decompression of the data starting at a deflate
+ * block boundary.
+ */
+typedef struct {
+  off_t         out;    /* offset in the decompressed data */
+  size_t        in;     /* offset of the first complete byte in the image */
+  int           bits;   /* count of bits of the preceding byte in the block */
+  unsigned char window[ IMFS_TAR_GZIP_WINDOW_SIZE ];
+} IMFS_tar_gzip_point;
+
+/*
+ * The cursor is the raw inflate stream of the last extract operation.  It is
+ * positioned at the end of the last extracted data, so a subsequent extract
+ * of following data continues without a restart at an access point.
+ */
+typedef struct {
+  const unsigned char  *image;
+  size_t                size;
+  size_t                point_count;
+  IMFS_tar_gzip_point **points;
+  z_stream              cursor;
+  bool                  cursor_initialized;
+  bool                  cursor_valid;
+  off_t                 cursor_out;     /* offset in the decompressed data */
+} IMFS_tar_gzip_context;
+
+static int IMFS_tar_gzip_error( int ret )
+{
+  return ret == Z_MEM_ERROR ? ENOMEM : EIO;
+}
+
+static void IMFS_tar_gzip_destroy( void *arg )
+{
+  IMFS_tar_gzip_context *context = arg;
+  size_t i;
+
+  for ( i = 0; i < context->point_count; ++i ) {
+    free( context->points[ i ] );
+  }
+
+  if ( context->cursor_initialized ) {
+    inflateEnd( &context->cursor );
+  }
+
+  free( context->points );
+  free( context );
+}
+
+static bool IMFS_tar_gzip_probe( const void *image, size_t size )
+{
+  const unsigned char *magic = image;
+
+  return size >= 2 && magic[ 0 ] == 0x1f && magic[ 1 ] == 0x8b;
+}
+
+static int IMFS_tar_gzip_add_point(
+  IMFS_tar_gzip_context *context,
+  const z_stream        *strm,
+  off_t                  out,
+  const unsigned char   *window
+)
+{
+  IMFS_tar_gzip_point **points;
+  IMFS_tar_gzip_point *point;
+  size_t left = strm->avail_out;
+
+  points = realloc(
+    context->points,
+    ( context->point_count + 1 ) * sizeof( *points )
+  );
+  if ( points == NULL ) {
+    return ENOMEM;
+  }
+
+  context->points = points;
+
+  point = malloc( sizeof( *point ) );
+  if ( point == NULL ) {
+    return ENOMEM;
+  }
+
+  point->out = out;
+  point->in = context->size - strm->avail_in;
+  point->bits = strm->data_type & 7;
+
+  /* The window is a ring buffer, the oldest data starts at the write position */
+  memcpy(
+    &point->window[ 0 ],
+    &window[ IMFS_TAR_GZIP_WINDOW_SIZE - left ],
+    left
+  );
+  memcpy(
+    &point->window[ left ],
+    &window[ 0 ],
+    IMFS_TAR_GZIP_WINDOW_SIZE - left
+  );
+
+  points[ context->point_count ] = point;
+  ++context->point_count;
+
+  return 0;
+}
+
+static int IMFS_tar_gzip_scan_stream(
+  IMFS_tar_gzip_context *context,
+  z_stream              *strm,
+  rtems_tarfs_consume    consume,
+  void                  *arg,
+  unsigned char         *window
+)
+{
+  off_t out = 0;
+  off_t last = 0;
+
+  strm->avail_out = 0;
+
+  while ( true ) {
+    unsigned char *begin;
+    size_t n;
+    int ret;
+    int eno;
+
+    if ( strm->avail_out == 0 ) {
+      strm->next_out = window;
+      strm->avail_out = IMFS_TAR_GZIP_WINDOW_SIZE;
+    }
+
+    /* Stop at each block boundary to be able to record an access point */
+    begin = strm->next_out;
+    ret = inflate( strm, Z_BLOCK );
+    if ( ret != Z_OK && ret != Z_STREAM_END ) {
+      return IMFS_tar_gzip_error( ret );
+    }
+
+    n = (size_t) ( strm->next_out - begin );
+    if ( n > 0 ) {
+      eno = ( *consume )( arg, begin, n );
+      if ( eno != 0 ) {
+        return eno;
+      }
+
+      out += (off_t) n;
+    }
+
+    /* The inflate() verified the CRC and length of the gzip trailer */
+    if ( ret == Z_STREAM_END ) {
+      return 0;
+    }
+
+    if (
+      ( strm->data_type & 128 ) != 0
+        && ( strm->data_type & 64 ) == 0
+        && ( out == 0 || out - last > IMFS_TAR_GZIP_SPAN )
+    ) {
+      eno = IMFS_tar_gzip_add_point( context, strm, out, window );
+      if ( eno != 0 ) {
+        return eno;
+      }
+
+      last = out;
+    }
+  }
+}
+
+static int IMFS_tar_gzip_scan(
+  const void           *image,
+  size_t                size,
+  rtems_tarfs_consume   consume,
+  void                 *arg,
+  void                **context_ptr
+)
+{
+  IMFS_tar_gzip_context *context;
+  unsigned char *window;
+  z_stream strm;
+  int ret;
+  int eno;
+
+  if ( size > UINT_MAX ) {
+    return EFBIG;
+  }
+
+  context = calloc( 1, sizeof( *context ) );
+  if ( context == NULL ) {
+    return ENOMEM;
+  }
+
+  context->image = image;
+  context->size = size;
+
+  window = malloc( IMFS_TAR_GZIP_WINDOW_SIZE );
+  if ( window == NULL ) {
+    IMFS_tar_gzip_destroy( context );
+
+    return ENOMEM;
+  }
+
+  memset( &strm, 0, sizeof( strm ) );
+  ret = inflateInit2( &strm, IMFS_TAR_GZIP_WINDOW_BITS );
+  if ( ret == Z_OK ) {
+    strm.next_in = (Bytef *) image;
+    strm.avail_in = (uInt) size;
+
+    eno = IMFS_tar_gzip_scan_stream( context, &strm, consume, arg, window );
+
+    inflateEnd( &strm );
+  } else {
+    eno = IMFS_tar_gzip_error( ret );
+  }
+
+  free( window );
+
+  if ( eno == 0 ) {
+    *context_ptr = context;
+  } else {
+    IMFS_tar_gzip_destroy( context );
+  }
+
+  return eno;
+}
+
+/*
+ * Decompresses exactly the requested amount of data.  The input is the entire
+ * remainder of the image, so a short output indicates a corrupt stream.
+ */
+static int IMFS_tar_gzip_inflate(
+  z_stream      *strm,
+  unsigned char *buffer,
+  size_t         size
+)
+{
+  while ( size > 0 ) {
+    uInt n = size > UINT_MAX ? UINT_MAX : (uInt) size;
+    int ret;
+
+    strm->next_out = buffer;
+    strm->avail_out = n;
+
+    ret = inflate( strm, Z_NO_FLUSH );
+    if ( ( ret != Z_OK && ret != Z_STREAM_END ) || strm->avail_out != 0 ) {
+      return IMFS_tar_gzip_error( ret );
+    }
+
+    buffer += n;
+    size -= n;
+  }
+
+  return 0;
+}
+
+static int IMFS_tar_gzip_start_at_point(
+  IMFS_tar_gzip_context     *context,
+  const IMFS_tar_gzip_point *point
+)
+{
+  z_stream *strm = &context->cursor;
+  int ret;
+
+  if ( context->cursor_initialized ) {
+    ret = inflateReset( strm );
+  } else {
+    memset( strm, 0, sizeof( *strm ) );
+    ret = inflateInit2( strm, IMFS_TAR_GZIP_RAW_WINDOW_BITS );
+    context->cursor_initialized = ret == Z_OK;
+  }
+
+  if ( ret != Z_OK ) {
+    return IMFS_tar_gzip_error( ret );
+  }
+
+  if ( point->bits > 0 ) {
+    int value = context->image[ point->in - 1 ] >> ( 8 - point->bits );
+
+    ret = inflatePrime( strm, point->bits, value );
+    if ( ret != Z_OK ) {
+      return IMFS_tar_gzip_error( ret );
+    }
+  }
+
+  ret = inflateSetDictionary(
+    strm,
+    point->window,
+    IMFS_TAR_GZIP_WINDOW_SIZE
+  );
+  if ( ret != Z_OK ) {
+    return IMFS_tar_gzip_error( ret );
+  }
+
+  strm->next_in = (Bytef *) &context->image[ point->in ];
+  strm->avail_in = (uInt) ( context->size - point->in );
+  context->cursor_out = point->out;
+  context->cursor_valid = true;
+
+  return 0;
+}
+
+static int IMFS_tar_gzip_skip( z_stream *strm, off_t skip )
+{
+  unsigned char *discard;
+  int eno = 0;
+
+  if ( skip == 0 ) {
+    return 0;
+  }
+
+  discard = malloc( IMFS_TAR_GZIP_WINDOW_SIZE );
+  if ( discard == NULL ) {
+    return ENOMEM;
+  }
+
+  while ( skip > 0 && eno == 0 ) {
+    size_t n = IMFS_TAR_GZIP_WINDOW_SIZE;
+
+    if ( skip < (off_t) n ) {
+      n = (size_t) skip;
+    }
+
+    eno = IMFS_tar_gzip_inflate( strm, discard, n );
+    skip -= (off_t) n;
+  }
+
+  free( discard );
+
+  return eno;
+}
+
+/*
+ * The caller serializes the extract operations, see rtems_tarfs_decompressor.
+ */
+static int IMFS_tar_gzip_extract(
+  void   *arg,
+  off_t   offset,
+  void   *buffer,
+  size_t  size
+)
+{
+  IMFS_tar_gzip_context *context = arg;
+  const IMFS_tar_gzip_point *point;
+  size_t begin = 0;
+  size_t end = context->point_count;
+  int eno;
+
+  if ( end == 0 || context->points[ 0 ]->out > offset ) {
+    return EIO;
+  }
+
+  /* Find the last access point before or at the offset */
+  while ( end - begin > 1 ) {
+    size_t middle = begin + ( end - begin ) / 2;
+
+    if ( context->points[ middle ]->out <= offset ) {
+      begin = middle;
+    } else {
+      end = middle;
+    }
+  }
+
+  point = context->points[ begin ];
+
+  /* Restart at the access point unless the cursor is closer to the offset */
+  if (
+    !context->cursor_valid
+      || context->cursor_out > offset
+      || context->cursor_out < point->out
+  ) {
+    context->cursor_valid = false;
+
+    eno = IMFS_tar_gzip_start_at_point( context, point );
+    if ( eno != 0 ) {
+      return eno;
+    }
+  }
+
+  eno = IMFS_tar_gzip_skip( &context->cursor, offset - context->cursor_out );
+  if ( eno == 0 ) {
+    eno = IMFS_tar_gzip_inflate( &context->cursor, buffer, size );
+  }
+
+  if ( eno == 0 ) {
+    context->cursor_out = offset + (off_t) size;
+  } else {
+    context->cursor_valid = false;
+  }
+
+  return eno;
+}
+
+const rtems_tarfs_decompressor rtems_tarfs_decompressor_gzip = {
+  .probe = IMFS_tar_gzip_probe,
+  .scan = IMFS_tar_gzip_scan,
+  .extract = IMFS_tar_gzip_extract,
+  .destroy = IMFS_tar_gzip_destroy
+};
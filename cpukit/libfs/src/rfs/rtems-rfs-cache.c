@@ -0,0 +1,440 @@
+/**
+ * @file
+ *
+ * @brief RTEMS File System Directory Entry and Inode Cache
+ * @ingroup rtems_rfs
+ *
+ * The caches are tables of entries allocated when the file system is opened.
+ * Each table has hash buckets to find an entry and a least recently used list
+ * to select the entry to reuse. Free entries are held at the end of the list
+ * so they are used first.
+ */
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-cache.h>
+
+/**
+ * Return the hash bucket of a directory entry.
+ */
+static rtems_rfs_cache_dentry**
+rtems_rfs_cache_dentry_bucket (struct _rtems_rfs_cache* cache,
+                               rtems_rfs_ino            parent,
+                               uint32_t                 hash)
+{
+  uint32_t key = hash ^ (parent * UINT32_C (2654435761));
+  return &cache->dentry_buckets[key % cache->dentry_stats.entries];
+}
+
+/**
+ * Return the hash bucket of an inode.
+ */
+static rtems_rfs_cache_inode**
+rtems_rfs_cache_inode_bucket (struct _rtems_rfs_cache* cache,
+                              rtems_rfs_ino            ino)
+{
+  return &cache->inode_buckets[ino % cache->inode_stats.entries];
+}
+
+/**
+ * Make the entry the most recently used entry.
+ */
+static void
+rtems_rfs_cache_touch (rtems_chain_control* lru, rtems_chain_node* node)
+{
+  rtems_chain_extract_unprotected (node);
+  rtems_chain_prepend_unprotected (lru, node);
+}
+
+/**
+ * Make the entry the first entry to be reused.
+ */
+static void
+rtems_rfs_cache_retire (rtems_chain_control* lru, rtems_chain_node* node)
+{
+  rtems_chain_extract_unprotected (node);
+  rtems_chain_append_unprotected (lru, node);
+}
+
+/**
+ * Remove a directory entry from the cache.
+ */
+static void
+rtems_rfs_cache_dentry_remove (struct _rtems_rfs_cache* cache,
+                               rtems_rfs_cache_dentry*  entry)
+{
+  rtems_rfs_cache_dentry** link;
+
+  link = rtems_rfs_cache_dentry_bucket (cache, entry->parent, entry->hash);
+  while (*link != entry)
+    link = &(*link)->next;
+  *link = entry->next;
+
+  entry->next = NULL;
+  entry->parent = RTEMS_RFS_EMPTY_INO;
+  cache->dentry_stats.used--;
+
+  rtems_rfs_cache_retire (&cache->dentry_lru, &entry->link);
+}
+
+/**
+ * Remove an inode from the cache. An entry in use is reused when released.
+ */
+static void
+rtems_rfs_cache_inode_remove (struct _rtems_rfs_cache* cache,
+                              rtems_rfs_cache_inode*   entry)
+{
+  rtems_rfs_cache_inode** link;
+
+  link = rtems_rfs_cache_inode_bucket (cache, entry->ino);
+  while (*link != entry)
+    link = &(*link)->next;
+  *link = entry->next;
+
+  entry->next = NULL;
+  entry->ino = RTEMS_RFS_EMPTY_INO;
+  cache->inode_stats.used--;
+
+  if (entry->users == 0)
+    rtems_rfs_cache_retire (&cache->inode_lru, &entry->link);
+}
+
+/**
+ * Find an inode in the cache.
+ */
+static rtems_rfs_cache_inode*
+rtems_rfs_cache_inode_find (struct _rtems_rfs_cache* cache,
+                            rtems_rfs_ino            ino)
+{
+  rtems_rfs_cache_inode* entry;
+
+  entry = *rtems_rfs_cache_inode_bucket (cache, ino);
+  while (entry && (entry->ino != ino))
+    entry = entry->next;
+
+  return entry;
+}
+
+int
+rtems_rfs_cache_open (rtems_rfs_file_system* fs,
+                      size_t                 dentries,
+                      size_t                 inodes)
+{
+  struct _rtems_rfs_cache* cache;
+  size_t                   e;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_CACHE))
+    printf ("rtems-rfs: cache-open: dentries=%zu inodes=%zu\n",
+            dentries, inodes);
+
+  fs->cache = NULL;
+
+  if ((dentries == 0) && (inodes == 0))
+    return 0;
+
+  cache = calloc (1, sizeof (struct _rtems_rfs_cache));
+  if (!cache)
+    return ENOMEM;
+
+  rtems_chain_initialize_empty (&cache->dentry_lru);
+  rtems_chain_initialize_empty (&cache->inode_lru);
+
+  if (dentries)
+  {
+    cache->dentries = calloc (dentries, sizeof (rtems_rfs_cache_dentry));
+    cache->dentry_buckets = calloc (dentries, sizeof (rtems_rfs_cache_dentry*));
+    if (!cache->dentries || !cache->dentry_buckets)
+    {
+      free (cache->dentries);
+      free (cache->dentry_buckets);
+      free (cache);
+      return ENOMEM;
+    }
+
+    cache->dentry_stats.entries = dentries;
+    for (e = 0; e < dentries; e++)
+      rtems_chain_append_unprotected (&cache->dentry_lru,
+                                      &cache->dentries[e].link);
+  }
+
+  if (inodes)
+  {
+    cache->inodes = calloc (inodes, sizeof (rtems_rfs_cache_inode));
+    cache->inode_buckets = calloc (inodes, sizeof (rtems_rfs_cache_inode*));
+    if (!cache->inodes || !cache->inode_buckets)
+    {
+      free (cache->inodes);
+      free (cache->inode_buckets);
+      free (cache->dentries);
+      free (cache->dentry_buckets);
+      free (cache);
+      return ENOMEM;
+    }
+
+    cache->inode_stats.entries = inodes;
+    for (e = 0; e < inodes; e++)
+      rtems_chain_append_unprotected (&cache->inode_lru,
+                                      &cache->inodes[e].link);
+  }
+
+  fs->cache = cache;
+
+  return 0;
+}
+
+void
+rtems_rfs_cache_close (rtems_rfs_file_system* fs)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_CACHE))
+    printf ("rtems-rfs: cache-close\n");
+
+  if (cache)
+  {
+    free (cache->inodes);
+    free (cache->inode_buckets);
+    free (cache->dentries);
+    free (cache->dentry_buckets);
+    free (cache);
+    fs->cache = NULL;
+  }
+}
+
+bool
+rtems_rfs_cache_dentry_lookup (rtems_rfs_file_system* fs,
+                               rtems_rfs_ino          parent,
+                               const char*            name,
+                               int                    length,
+                               uint32_t               hash,
+                               rtems_rfs_ino*         ino,
+                               uint32_t*              offset)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_dentry*  entry;
+
+  if (!cache || (cache->dentry_stats.entries == 0))
+    return false;
+
+  entry = *rtems_rfs_cache_dentry_bucket (cache, parent, hash);
+  while (entry)
+  {
+    if ((entry->parent == parent) && (entry->hash == hash) &&
+        (entry->length == length) && (memcmp (entry->name, name, length) == 0))
+    {
+      *ino = entry->ino;
+      *offset = entry->offset;
+      cache->dentry_stats.hits++;
+      rtems_rfs_cache_touch (&cache->dentry_lru, &entry->link);
+      return true;
+    }
+    entry = entry->next;
+  }
+
+  cache->dentry_stats.misses++;
+
+  return false;
+}
+
+void
+rtems_rfs_cache_dentry_add (rtems_rfs_file_system* fs,
+                            rtems_rfs_ino          parent,
+                            const char*            name,
+                            int                    length,
+                            uint32_t               hash,
+                            rtems_rfs_ino          ino,
+                            uint32_t               offset)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_dentry** bucket;
+  rtems_rfs_cache_dentry*  entry;
+
+  if (!cache || (cache->dentry_stats.entries == 0) ||
+      (length > RTEMS_RFS_CACHE_NAME_LENGTH))
+    return;
+
+  /*
+   * Reuse the least recently used entry. Free entries are at the end of the
+   * list.
+   */
+  entry = (rtems_rfs_cache_dentry*) rtems_chain_last (&cache->dentry_lru);
+  if (entry->parent != RTEMS_RFS_EMPTY_INO)
+    rtems_rfs_cache_dentry_remove (cache, entry);
+
+  entry->parent = parent;
+  entry->hash = hash;
+  entry->ino = ino;
+  entry->offset = offset;
+  entry->length = length;
+  memcpy (entry->name, name, length);
+
+  bucket = rtems_rfs_cache_dentry_bucket (cache, parent, hash);
+  entry->next = *bucket;
+  *bucket = entry;
+  cache->dentry_stats.used++;
+
+  rtems_rfs_cache_touch (&cache->dentry_lru, &entry->link);
+}
+
+void
+rtems_rfs_cache_dentry_purge (rtems_rfs_file_system* fs,
+                              rtems_rfs_ino          parent)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  size_t                   e;
+
+  if (!cache)
+    return;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_CACHE))
+    printf ("rtems-rfs: cache-dentry-purge: parent=%" PRIu32 "\n", parent);
+
+  for (e = 0; e < cache->dentry_stats.entries; e++)
+    if (cache->dentries[e].parent == parent)
+      rtems_rfs_cache_dentry_remove (cache, &cache->dentries[e]);
+}
+
+rtems_rfs_cache_inode*
+rtems_rfs_cache_inode_get (rtems_rfs_file_system* fs,
+                           rtems_rfs_ino          ino)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_inode*   entry;
+
+  if (!cache || (cache->inode_stats.entries == 0))
+    return NULL;
+
+  entry = rtems_rfs_cache_inode_find (cache, ino);
+  if (!entry)
+  {
+    cache->inode_stats.misses++;
+    return NULL;
+  }
+
+  entry->users++;
+  cache->inode_stats.hits++;
+  rtems_rfs_cache_touch (&cache->inode_lru, &entry->link);
+
+  return entry;
+}
+
+rtems_rfs_cache_inode*
+rtems_rfs_cache_inode_add (rtems_rfs_file_system*  fs,
+                           rtems_rfs_ino           ino,
+                           const rtems_rfs_inode*  node)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_inode**  bucket;
+  rtems_rfs_cache_inode*   entry;
+  rtems_chain_node*        node_link;
+
+  if (!cache || (cache->inode_stats.entries == 0))
+    return NULL;
+
+  /*
+   * Reuse the least recently used entry that is not in use.
+   */
+  node_link = rtems_chain_last (&cache->inode_lru);
+  while (!rtems_chain_is_head (&cache->inode_lru, node_link))
+  {
+    entry = (rtems_rfs_cache_inode*) node_link;
+    if (entry->users == 0)
+      break;
+    node_link = rtems_chain_previous (node_link);
+  }
+
+  if (rtems_chain_is_head (&cache->inode_lru, node_link))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_CACHE))
+      printf ("rtems-rfs: cache-inode-add: all entries in use: ino=%" PRIu32 "\n",
+              ino);
+    return NULL;
+  }
+
+  entry = (rtems_rfs_cache_inode*) node_link;
+  if (entry->ino != RTEMS_RFS_EMPTY_INO)
+    rtems_rfs_cache_inode_remove (cache, entry);
+
+  entry->ino = ino;
+  entry->users = 1;
+  memcpy (&entry->node, node, sizeof (rtems_rfs_inode));
+
+  bucket = rtems_rfs_cache_inode_bucket (cache, ino);
+  entry->next = *bucket;
+  *bucket = entry;
+  cache->inode_stats.used++;
+
+  rtems_rfs_cache_touch (&cache->inode_lru, &entry->link);
+
+  return entry;
+}
+
+void
+rtems_rfs_cache_inode_release (rtems_rfs_file_system* fs,
+                               rtems_rfs_cache_inode* entry)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+
+  if (entry->users > 0)
+    entry->users--;
+
+  if ((entry->users == 0) && (entry->ino == RTEMS_RFS_EMPTY_INO))
+    rtems_rfs_cache_retire (&cache->inode_lru, &entry->link);
+}
+
+void
+rtems_rfs_cache_inode_update (rtems_rfs_file_system*  fs,
+                              rtems_rfs_ino           ino,
+                              const rtems_rfs_inode*  node)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_inode*   entry;
+
+  if (!cache || (cache->inode_stats.entries == 0))
+    return;
+
+  entry = rtems_rfs_cache_inode_find (cache, ino);
+  if (entry && (&entry->node != node))
+    memcpy (&entry->node, node, sizeof (rtems_rfs_inode));
+}
+
+void
+rtems_rfs_cache_inode_purge (rtems_rfs_file_system* fs,
+                             rtems_rfs_ino          ino)
+{
+  struct _rtems_rfs_cache* cache = fs->cache;
+  rtems_rfs_cache_inode*   entry;
+
+  if (!cache)
+    return;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_CACHE))
+    printf ("rtems-rfs: cache-inode-purge: ino=%" PRIu32 "\n", ino);
+
+  /*
+   * The ino can be reused by a new directory so remove the entries of this
+   * directory.
+   */
+  rtems_rfs_cache_dentry_purge (fs, ino);
+
+  if (cache->inode_stats.entries == 0)
+    return;
+
+  entry = rtems_rfs_cache_inode_find (cache, ino);
+  if (entry)
+    rtems_rfs_cache_inode_remove (cache, entry);
+}
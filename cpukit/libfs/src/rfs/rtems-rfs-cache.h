@@ -0,0 +1,309 @@
+/**
+ * @file
+ *
+ * @brief RTEMS File System Directory Entry and Inode Cache
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File System Directory Entry and Inode Cache.
+ *
+ * The directory entry cache maps a parent directory ino and a name to the ino
+ * and offset of the directory entry. The inode cache holds copies of inodes so
+ * the path evaluation does not need to request the inode blocks from the
+ * buffer layer. Both caches have a fixed number of entries set when the file
+ * system is mounted and the least recently used entry is reused.
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if !defined (_RTEMS_RFS_CACHE_H_)
+#define _RTEMS_RFS_CACHE_H_
+
+#include <rtems/chain.h>
+
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+/**
+ * The maximum length of a name held in the directory entry cache. Longer names
+ * are not cached.
+ */
+#define RTEMS_RFS_CACHE_NAME_LENGTH (32)
+
+/**
+ * A directory entry cache entry.
+ */
+typedef struct _rtems_rfs_cache_dentry
+{
+  /**
+   * The link on the least recently used list. The head is the most recently
+   * used entry.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The next entry in the hash bucket.
+   */
+  struct _rtems_rfs_cache_dentry* next;
+
+  /**
+   * The ino of the parent directory. The entry is free if 0.
+   */
+  rtems_rfs_ino parent;
+
+  /**
+   * The hash of the name.
+   */
+  uint32_t hash;
+
+  /**
+   * The ino the directory entry references.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The offset of the directory entry in the directory.
+   */
+  uint32_t offset;
+
+  /**
+   * The length of the name.
+   */
+  uint8_t length;
+
+  /**
+   * The name.
+   */
+  char name[RTEMS_RFS_CACHE_NAME_LENGTH];
+
+} rtems_rfs_cache_dentry;
+
+/**
+ * An inode cache entry.
+ */
+typedef struct _rtems_rfs_cache_inode
+{
+  /**
+   * The link on the least recently used list. The head is the most recently
+   * used entry.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The next entry in the hash bucket.
+   */
+  struct _rtems_rfs_cache_inode* next;
+
+  /**
+   * The ino of the inode. The entry is free if 0.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The number of inode handles using the entry. An entry in use is not
+   * reused.
+   */
+  int users;
+
+  /**
+   * The copy of the inode.
+   */
+  rtems_rfs_inode node;
+
+} rtems_rfs_cache_inode;
+
+/**
+ * The cache usage counters.
+ */
+typedef struct _rtems_rfs_cache_stats
+{
+  size_t   entries;   /**< The number of entries. */
+  size_t   used;      /**< The number of entries holding data. */
+  uint32_t hits;      /**< The number of look ups found in the cache. */
+  uint32_t misses;    /**< The number of look ups not found in the cache. */
+} rtems_rfs_cache_stats;
+
+/**
+ * The directory entry and inode cache of a file system.
+ */
+struct _rtems_rfs_cache
+{
+  /**
+   * The least recently used list of directory entries.
+   */
+  rtems_chain_control dentry_lru;
+
+  /**
+   * The hash buckets of the directory entries.
+   */
+  rtems_rfs_cache_dentry** dentry_buckets;
+
+  /**
+   * The directory entries.
+   */
+  rtems_rfs_cache_dentry* dentries;
+
+  /**
+   * The directory entry cache usage.
+   */
+  rtems_rfs_cache_stats dentry_stats;
+
+  /**
+   * The least recently used list of inodes.
+   */
+  rtems_chain_control inode_lru;
+
+  /**
+   * The hash buckets of the inodes.
+   */
+  rtems_rfs_cache_inode** inode_buckets;
+
+  /**
+   * The inodes.
+   */
+  rtems_rfs_cache_inode* inodes;
+
+  /**
+   * The inode cache usage.
+   */
+  rtems_rfs_cache_stats inode_stats;
+};
+
+/**
+ * Open the cache of the file system. If both sizes are 0 there is no cache.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] dentries is the number of directory entries to cache.
+ * @param[in] inodes is the number of inodes to cache.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_cache_open (rtems_rfs_file_system* fs,
+                          size_t                 dentries,
+                          size_t                 inodes);
+
+/**
+ * Close the cache of the file system.
+ *
+ * @param[in] fs is the file system data.
+ */
+void rtems_rfs_cache_close (rtems_rfs_file_system* fs);
+
+/**
+ * Look up a directory entry in the cache.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] parent is the ino of the directory.
+ * @param[in] name is a pointer to the name.
+ * @param[in] length is the length of the name.
+ * @param[in] hash is the hash of the name.
+ * @param[out] ino is the ino of the entry if found.
+ * @param[out] offset is the offset of the entry in the directory if found.
+ *
+ * @retval true The entry is in the cache.
+ * @retval false The entry is not in the cache.
+ */
+bool rtems_rfs_cache_dentry_lookup (rtems_rfs_file_system* fs,
+                                    rtems_rfs_ino          parent,
+                                    const char*            name,
+                                    int                    length,
+                                    uint32_t               hash,
+                                    rtems_rfs_ino*         ino,
+                                    uint32_t*              offset);
+
+/**
+ * Add a directory entry found in a directory to the cache. The entry must not
+ * be in the cache.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] parent is the ino of the directory.
+ * @param[in] name is a pointer to the name.
+ * @param[in] length is the length of the name.
+ * @param[in] hash is the hash of the name.
+ * @param[in] ino is the ino of the entry.
+ * @param[in] offset is the offset of the entry in the directory.
+ */
+void rtems_rfs_cache_dentry_add (rtems_rfs_file_system* fs,
+                                 rtems_rfs_ino          parent,
+                                 const char*            name,
+                                 int                    length,
+                                 uint32_t               hash,
+                                 rtems_rfs_ino          ino,
+                                 uint32_t               offset);
+
+/**
+ * Remove the cached directory entries of a directory. This must be called when
+ * an entry is removed or entries move in the directory.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] parent is the ino of the directory.
+ */
+void rtems_rfs_cache_dentry_purge (rtems_rfs_file_system* fs,
+                                   rtems_rfs_ino          parent);
+
+/**
+ * Get the cached inode and mark it as used. The entry is not reused until it
+ * is released.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the inode.
+ *
+ * @return rtems_rfs_cache_inode* The cache entry or NULL if not cached.
+ */
+rtems_rfs_cache_inode* rtems_rfs_cache_inode_get (rtems_rfs_file_system* fs,
+                                                  rtems_rfs_ino          ino);
+
+/**
+ * Add a copy of an inode to the cache and mark it as used. The entry is not
+ * reused until it is released.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the inode.
+ * @param[in] node is a pointer to the inode.
+ *
+ * @return rtems_rfs_cache_inode* The cache entry or NULL if all entries are
+ *                                used.
+ */
+rtems_rfs_cache_inode* rtems_rfs_cache_inode_add (rtems_rfs_file_system*  fs,
+                                                  rtems_rfs_ino           ino,
+                                                  const rtems_rfs_inode*  node);
+
+/**
+ * Release a cached inode.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] entry is the cache entry.
+ */
+void rtems_rfs_cache_inode_release (rtems_rfs_file_system* fs,
+                                    rtems_rfs_cache_inode* entry);
+
+/**
+ * Update the cached copy of an inode if the inode is cached.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the inode.
+ * @param[in] node is a pointer to the inode.
+ */
+void rtems_rfs_cache_inode_update (rtems_rfs_file_system*  fs,
+                                   rtems_rfs_ino           ino,
+                                   const rtems_rfs_inode*  node);
+
+/**
+ * Remove an inode from the cache. This removes the cached directory entries of
+ * the inode if it is a directory.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the inode.
+ */
+void rtems_rfs_cache_inode_purge (rtems_rfs_file_system* fs,
+                                  rtems_rfs_ino          ino);
+
+#endif
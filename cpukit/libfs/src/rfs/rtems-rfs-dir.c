@@ -11,6 +11,12 @@
  * entries do not span a block and removal of an entry results in the space in
  * the block being compacted and the spare area being initialised to ones.
  *
+ * If the file system supports the hashed directory index a directory larger
+ * than a block has an index similar to the ext3 htree. The first block is the
+ * root of the index and the entries are held in leaf blocks selected by the
+ * hash of the name. A look up only searches a single leaf. Directories
+ * without an index are searched linearly.
+ *
  * The maximum length can be 1 or 2 bytes depending on the value in the
  * superblock.
  */
@@ -28,6 +34,7 @@
 #endif
 
 #include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 #if SIZEOF_OFF_T == 8
@@ -40,6 +47,7 @@
 
 #include <rtems/rfs/rtems-rfs-block.h>
 #include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-cache.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
@@ -52,6 +60,734 @@
   (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
    || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
 
+/**
+ * Access the header and the entries of an index block.
+ */
+#define rtems_rfs_dir_index_magic(_d) \
+  rtems_rfs_read_u32 ((_d) + RTEMS_RFS_DIR_ENTRY_HASH)
+#define rtems_rfs_dir_index_depth(_d) \
+  rtems_rfs_read_u8 ((_d) + RTEMS_RFS_DIR_INDEX_DEPTH)
+#define rtems_rfs_dir_index_count(_d) \
+  rtems_rfs_read_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT)
+#define rtems_rfs_dir_index_set_count(_d, _c) \
+  rtems_rfs_write_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT, _c)
+#define rtems_rfs_dir_index_entry(_d, _p) \
+  ((_d) + RTEMS_RFS_DIR_INDEX_HEADER_SIZE + ((_p) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE))
+#define rtems_rfs_dir_index_hash(_d, _p) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _p) + RTEMS_RFS_DIR_INDEX_ENTRY_HASH)
+#define rtems_rfs_dir_index_block(_d, _p) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _p) + RTEMS_RFS_DIR_INDEX_ENTRY_BLOCK)
+
+/**
+ * The path through the hashed directory index to a leaf block. Level 0 is the
+ * root of the index.
+ */
+typedef struct _rtems_rfs_dir_index_path
+{
+  /**
+   * The number of levels of index blocks.
+   */
+  int levels;
+
+  /**
+   * The logical block of the index block at each level.
+   */
+  rtems_rfs_block_no bno[RTEMS_RFS_DIR_INDEX_MAX_DEPTH + 1];
+
+  /**
+   * The position of the entry used at each level.
+   */
+  int pos[RTEMS_RFS_DIR_INDEX_MAX_DEPTH + 1];
+
+  /**
+   * The number of entries in the index block at each level.
+   */
+  int count[RTEMS_RFS_DIR_INDEX_MAX_DEPTH + 1];
+
+  /**
+   * The logical block of the leaf holding the directory entries.
+   */
+  rtems_rfs_block_no leaf;
+
+} rtems_rfs_dir_index_path;
+
+/**
+ * Request the logical block of the directory.
+ */
+static int
+rtems_rfs_dir_request (rtems_rfs_file_system*   fs,
+                       rtems_rfs_block_map*     map,
+                       rtems_rfs_buffer_handle* handle,
+                       rtems_rfs_block_no       bno,
+                       bool                     read)
+{
+  rtems_rfs_block_pos bpos;
+  rtems_rfs_block_no  block;
+  int                 rc;
+
+  rtems_rfs_block_set_bpos_zero (&bpos);
+  bpos.bno = bno;
+
+  rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+  if (rc > 0)
+  {
+    if (rc == ENXIO)
+      rc = EIO;
+    return rc;
+  }
+
+  return rtems_rfs_buffer_handle_request (fs, handle, block, read);
+}
+
+/**
+ * Set an entry in an index block.
+ */
+static void
+rtems_rfs_dir_index_set_entry (uint8_t*           data,
+                               int                pos,
+                               uint32_t           hash,
+                               rtems_rfs_block_no bno)
+{
+  uint8_t* entry = rtems_rfs_dir_index_entry (data, pos);
+  rtems_rfs_write_u32 (entry + RTEMS_RFS_DIR_INDEX_ENTRY_HASH, hash);
+  rtems_rfs_write_u32 (entry + RTEMS_RFS_DIR_INDEX_ENTRY_BLOCK, bno);
+}
+
+/**
+ * Initialise an index block with no entries. The unused part of the block is
+ * set to ones.
+ */
+static void
+rtems_rfs_dir_index_init (rtems_rfs_file_system* fs, uint8_t* data, int depth)
+{
+  memset (data, 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_write_u32 (data + RTEMS_RFS_DIR_ENTRY_HASH, RTEMS_RFS_DIR_INDEX_MAGIC);
+  rtems_rfs_write_u8 (data + RTEMS_RFS_DIR_INDEX_DEPTH, depth);
+  rtems_rfs_dir_index_set_count (data, 0);
+}
+
+/**
+ * Load an index block and check the header.
+ */
+static int
+rtems_rfs_dir_index_load (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* handle,
+                          rtems_rfs_block_no       bno,
+                          uint8_t**                data)
+{
+  int count;
+  int rc;
+
+  rc = rtems_rfs_dir_request (fs, map, handle, bno, true);
+  if (rc > 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: block request failed: bno=%" PRIu32 ": %d: %s\n",
+              bno, rc, strerror (rc));
+    return rc;
+  }
+
+  *data = rtems_rfs_buffer_data (handle);
+  count = rtems_rfs_dir_index_count (*data);
+
+  if ((rtems_rfs_dir_index_magic (*data) != RTEMS_RFS_DIR_INDEX_MAGIC) ||
+      (rtems_rfs_dir_index_depth (*data) > RTEMS_RFS_DIR_INDEX_MAX_DEPTH) ||
+      (count == 0) || (count > rtems_rfs_dir_index_limit (fs)))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: bad index block: bno=%" PRIu32
+              " magic=%08" PRIx32 " depth=%d count=%d\n",
+              bno, rtems_rfs_dir_index_magic (*data),
+              rtems_rfs_dir_index_depth (*data), count);
+    return EIO;
+  }
+
+  return 0;
+}
+
+/**
+ * Find the path through the index to the leaf block holding the hash. The
+ * entries in an index block are sorted so a binary search locates the last
+ * entry with a hash less than or equal to the hash. The first entry has a hash
+ * of 0 so there is always a leaf.
+ */
+static int
+rtems_rfs_dir_index_find (rtems_rfs_file_system*    fs,
+                          rtems_rfs_block_map*      map,
+                          rtems_rfs_buffer_handle*  handle,
+                          uint32_t                  hash,
+                          rtems_rfs_dir_index_path* path)
+{
+  rtems_rfs_block_no bno = 0;
+  int                level = 0;
+
+  while (true)
+  {
+    uint8_t* data;
+    int      depth;
+    int      low;
+    int      high;
+    int      rc;
+
+    rc = rtems_rfs_dir_index_load (fs, map, handle, bno, &data);
+    if (rc > 0)
+      return rc;
+
+    depth = rtems_rfs_dir_index_depth (data);
+
+    if (level == 0)
+      path->levels = depth + 1;
+    else if ((level + depth) != (path->levels - 1))
+      return EIO;
+
+    low  = 0;
+    high = rtems_rfs_dir_index_count (data);
+
+    path->bno[level] = bno;
+    path->count[level] = high;
+
+    while ((high - low) > 1)
+    {
+      int mid = low + ((high - low) / 2);
+      if (rtems_rfs_dir_index_hash (data, mid) <= hash)
+        low = mid;
+      else
+        high = mid;
+    }
+
+    path->pos[level] = low;
+
+    bno = rtems_rfs_dir_index_block (data, low);
+    if ((bno == 0) || (bno >= rtems_rfs_block_map_count (map)))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+        printf ("rtems-rfs: dir-index: bad block in index: bno=%" PRIu32 "\n",
+                bno);
+      return EIO;
+    }
+
+    if (depth == 0)
+    {
+      path->leaf = bno;
+      return 0;
+    }
+
+    level++;
+  }
+}
+
+/**
+ * Insert an entry into an index block. The block must have space.
+ */
+static int
+rtems_rfs_dir_index_insert (rtems_rfs_file_system*   fs,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* handle,
+                            rtems_rfs_block_no       bno,
+                            int                      pos,
+                            uint32_t                 hash,
+                            rtems_rfs_block_no       child)
+{
+  uint8_t* data;
+  int      count;
+  int      rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: insert: bno=%" PRIu32 " pos=%d hash=%08" PRIx32
+            " child=%" PRIu32 "\n", bno, pos, hash, child);
+
+  rc = rtems_rfs_dir_index_load (fs, map, handle, bno, &data);
+  if (rc > 0)
+    return rc;
+
+  count = rtems_rfs_dir_index_count (data);
+
+  memmove (rtems_rfs_dir_index_entry (data, pos + 1),
+           rtems_rfs_dir_index_entry (data, pos),
+           (count - pos) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  rtems_rfs_dir_index_set_entry (data, pos, hash, child);
+  rtems_rfs_dir_index_set_count (data, count + 1);
+  rtems_rfs_buffer_mark_dirty (handle);
+
+  return 0;
+}
+
+/**
+ * Grow the directory by a block and request the new block with the second
+ * handle. On an error the handle is closed.
+ */
+static int
+rtems_rfs_dir_index_grow (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* handle,
+                          rtems_rfs_block_no*      bno)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  rc = rtems_rfs_buffer_handle_open (fs, handle);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_block_map_grow (fs, map, 1, &block);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, handle);
+    return rc;
+  }
+
+  *bno = rtems_rfs_block_map_count (map) - 1;
+
+  rc = rtems_rfs_buffer_handle_request (fs, handle, block, false);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, handle);
+    rtems_rfs_block_map_shrink (fs, map, 1);
+    return rc;
+  }
+
+  memset (rtems_rfs_buffer_data (handle), 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_buffer_mark_dirty (handle);
+
+  return 0;
+}
+
+/**
+ * Create the index of a directory with a single full block. The entries are
+ * moved to a new leaf block and the first block becomes the root of the index.
+ */
+static int
+rtems_rfs_dir_index_create (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  dir,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* buffer)
+{
+  rtems_rfs_buffer_handle leaf;
+  rtems_rfs_block_no      bno;
+  uint8_t*                root;
+  int                     rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: create: dir=%" PRIu32 "\n",
+            rtems_rfs_inode_ino (dir));
+
+  /*
+   * The entries move to the leaf.
+   */
+  rtems_rfs_cache_dentry_purge (fs, rtems_rfs_inode_ino (dir));
+
+  rc = rtems_rfs_dir_index_grow (fs, map, &leaf, &bno);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_request (fs, map, buffer, 0, true);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &leaf);
+    rtems_rfs_block_map_shrink (fs, map, 1);
+    return rc;
+  }
+
+  root = rtems_rfs_buffer_data (buffer);
+
+  memcpy (rtems_rfs_buffer_data (&leaf), root, rtems_rfs_fs_block_size (fs));
+
+  rtems_rfs_dir_index_init (fs, root, 0);
+  rtems_rfs_dir_index_set_entry (root, 0, 0, bno);
+  rtems_rfs_dir_index_set_count (root, 1);
+  rtems_rfs_buffer_mark_dirty (buffer);
+
+  rtems_rfs_inode_set_flags (dir, rtems_rfs_inode_get_flags (dir) |
+                             RTEMS_RFS_INODE_FLAG_DIR_INDEX);
+
+  return rtems_rfs_buffer_handle_close (fs, &leaf);
+}
+
+/**
+ * Compare hashes for the sort.
+ */
+static int
+rtems_rfs_dir_index_hash_compare (const void* a, const void* b)
+{
+  uint32_t lhs = *((const uint32_t*) a);
+  uint32_t rhs = *((const uint32_t*) b);
+  if (lhs < rhs)
+    return -1;
+  if (lhs > rhs)
+    return 1;
+  return 0;
+}
+
+/**
+ * Split the full leaf on the path. The entries with a hash greater than or
+ * equal to the median hash are moved to a new leaf. Entries with the same hash
+ * are never split so a look up only needs to search a single leaf. The parent
+ * index block must have space for the new leaf.
+ */
+static int
+rtems_rfs_dir_index_split_leaf (rtems_rfs_file_system*    fs,
+                                rtems_rfs_block_map*      map,
+                                rtems_rfs_buffer_handle*  buffer,
+                                rtems_rfs_dir_index_path* path)
+{
+  rtems_rfs_buffer_handle sibling;
+  rtems_rfs_block_no      bno;
+  uint32_t*               hashes;
+  uint32_t                split;
+  uint8_t*                data;
+  uint8_t*                sdata;
+  int                     count;
+  int                     offset;
+  int                     keep;
+  int                     moved;
+  int                     level;
+  int                     k;
+  int                     rc;
+
+  rc = rtems_rfs_dir_request (fs, map, buffer, path->leaf, true);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_buffer_data (buffer);
+
+  count  = 0;
+  offset = 0;
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    int elength = rtems_rfs_dir_entry_length (data + offset);
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+    offset += elength;
+    count++;
+  }
+
+  if (count < 2)
+    return ENOSPC;
+
+  hashes = malloc (count * sizeof (uint32_t));
+  if (!hashes)
+    return ENOMEM;
+
+  for (k = 0, offset = 0; k < count; k++)
+  {
+    hashes[k] = rtems_rfs_dir_entry_hash (data + offset);
+    offset += rtems_rfs_dir_entry_length (data + offset);
+  }
+
+  qsort (hashes, count, sizeof (uint32_t), rtems_rfs_dir_index_hash_compare);
+
+  /*
+   * Find the split hash closest to the median that leaves entries in both
+   * leaves. If all entries have the same hash the leaf cannot be split.
+   */
+  k = count / 2;
+  while ((k < count) && (hashes[k] == hashes[k - 1]))
+    k++;
+  if (k == count)
+  {
+    k = count / 2;
+    while ((k > 0) && (hashes[k] == hashes[k - 1]))
+      k--;
+  }
+
+  split = hashes[k];
+  free (hashes);
+
+  if (k == 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: split-leaf: all hashes match: bno=%" PRIu32 "\n",
+              path->leaf);
+    return ENOSPC;
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: split-leaf: bno=%" PRIu32 " entries=%d split=%08" PRIx32 "\n",
+            path->leaf, count, split);
+
+  rc = rtems_rfs_dir_index_grow (fs, map, &sibling, &bno);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Growing the map can release the buffer of the leaf.
+   */
+  rc = rtems_rfs_dir_request (fs, map, buffer, path->leaf, true);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &sibling);
+    return rc;
+  }
+
+  data  = rtems_rfs_buffer_data (buffer);
+  sdata = rtems_rfs_buffer_data (&sibling);
+
+  offset = 0;
+  keep   = 0;
+  moved  = 0;
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    uint8_t* entry = data + offset;
+    int      elength = rtems_rfs_dir_entry_length (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_hash (entry) >= split)
+    {
+      memcpy (sdata + moved, entry, elength);
+      moved += elength;
+    }
+    else
+    {
+      if (keep != offset)
+        memmove (data + keep, entry, elength);
+      keep += elength;
+    }
+
+    offset += elength;
+  }
+
+  memset (data + keep, 0xff, rtems_rfs_fs_block_size (fs) - keep);
+  rtems_rfs_buffer_mark_dirty (buffer);
+
+  rc = rtems_rfs_buffer_handle_close (fs, &sibling);
+  if (rc > 0)
+    return rc;
+
+  level = path->levels - 1;
+
+  return rtems_rfs_dir_index_insert (fs, map, buffer, path->bno[level],
+                                     path->pos[level] + 1, split, bno);
+}
+
+/**
+ * The root is full and references the leaves. Move the entries of the root to
+ * a new index block and make it the only entry of the root.
+ */
+static int
+rtems_rfs_dir_index_add_level (rtems_rfs_file_system*   fs,
+                               rtems_rfs_block_map*     map,
+                               rtems_rfs_buffer_handle* buffer)
+{
+  rtems_rfs_buffer_handle node;
+  rtems_rfs_block_no      bno;
+  uint8_t*                root;
+  int                     rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: add-level\n");
+
+  rc = rtems_rfs_dir_index_grow (fs, map, &node, &bno);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_load (fs, map, buffer, 0, &root);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &node);
+    return rc;
+  }
+
+  memcpy (rtems_rfs_buffer_data (&node), root, rtems_rfs_fs_block_size (fs));
+
+  rtems_rfs_dir_index_init (fs, root, 1);
+  rtems_rfs_dir_index_set_entry (root, 0, 0, bno);
+  rtems_rfs_dir_index_set_count (root, 1);
+  rtems_rfs_buffer_mark_dirty (buffer);
+
+  return rtems_rfs_buffer_handle_close (fs, &node);
+}
+
+/**
+ * The index block referenced by the root is full. Move the upper half of the
+ * entries to a new index block and add it to the root. The root must have
+ * space.
+ */
+static int
+rtems_rfs_dir_index_split_node (rtems_rfs_file_system*    fs,
+                                rtems_rfs_block_map*      map,
+                                rtems_rfs_buffer_handle*  buffer,
+                                rtems_rfs_dir_index_path* path)
+{
+  rtems_rfs_buffer_handle sibling;
+  rtems_rfs_block_no      bno;
+  uint32_t                split;
+  uint8_t*                data;
+  uint8_t*                sdata;
+  int                     count;
+  int                     half;
+  int                     rc;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, &sibling, &bno);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_load (fs, map, buffer, path->bno[1], &data);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &sibling);
+    return rc;
+  }
+
+  count = rtems_rfs_dir_index_count (data);
+  half  = count / 2;
+  split = rtems_rfs_dir_index_hash (data, half);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: split-node: bno=%" PRIu32 " entries=%d split=%08" PRIx32 "\n",
+            path->bno[1], count, split);
+
+  sdata = rtems_rfs_buffer_data (&sibling);
+  rtems_rfs_dir_index_init (fs, sdata, 0);
+  memcpy (rtems_rfs_dir_index_entry (sdata, 0),
+          rtems_rfs_dir_index_entry (data, half),
+          (count - half) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  rtems_rfs_dir_index_set_count (sdata, count - half);
+
+  memset (rtems_rfs_dir_index_entry (data, half), 0xff,
+          (count - half) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  rtems_rfs_dir_index_set_count (data, half);
+  rtems_rfs_buffer_mark_dirty (buffer);
+
+  rc = rtems_rfs_buffer_handle_close (fs, &sibling);
+  if (rc > 0)
+    return rc;
+
+  return rtems_rfs_dir_index_insert (fs, map, buffer, 0,
+                                     path->pos[0] + 1, split, bno);
+}
+
+/**
+ * Add the entry to the directory block held in the buffer if there is space.
+ *
+ * @retval 0 The entry has been added.
+ * @retval ENOSPC There is not enough space in the block.
+ * @retval EIO The block is corrupt.
+ */
+static int
+rtems_rfs_dir_insert_entry (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  dir,
+                            rtems_rfs_buffer_handle* buffer,
+                            const char*              name,
+                            size_t                   length,
+                            rtems_rfs_ino            ino,
+                            uint32_t                 hash)
+{
+  uint8_t* entry;
+  int      offset;
+
+  entry  = rtems_rfs_buffer_data (buffer);
+  offset = 0;
+
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+    {
+      if ((length + RTEMS_RFS_DIR_ENTRY_SIZE) <
+          (rtems_rfs_fs_block_size (fs) - offset))
+      {
+        rtems_rfs_dir_set_entry_hash (entry, hash);
+        rtems_rfs_dir_set_entry_ino (entry, ino);
+        rtems_rfs_dir_set_entry_length (entry,
+                                        RTEMS_RFS_DIR_ENTRY_SIZE + length);
+        memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
+        rtems_rfs_buffer_mark_dirty (buffer);
+        return 0;
+      }
+
+      break;
+    }
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+        printf ("rtems-rfs: dir-add-entry: "
+                "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04x\n",
+                rtems_rfs_inode_ino (dir), elength, eino, offset);
+      return EIO;
+    }
+
+    entry  += elength;
+    offset += elength;
+  }
+
+  return ENOSPC;
+}
+
+/**
+ * Add the entry to a directory with an index. If the leaf is full make one
+ * change to the structure of the index and try again.
+ */
+static int
+rtems_rfs_dir_index_add_entry (rtems_rfs_file_system*   fs,
+                               rtems_rfs_inode_handle*  dir,
+                               rtems_rfs_block_map*     map,
+                               rtems_rfs_buffer_handle* buffer,
+                               const char*              name,
+                               size_t                   length,
+                               rtems_rfs_ino            ino)
+{
+  uint32_t hash;
+
+  hash = rtems_rfs_dir_hash (name, length);
+
+  while (true)
+  {
+    rtems_rfs_dir_index_path path;
+    int                      level;
+    int                      rc;
+
+    rc = rtems_rfs_dir_index_find (fs, map, buffer, hash, &path);
+    if (rc > 0)
+      return rc;
+
+    rc = rtems_rfs_dir_request (fs, map, buffer, path.leaf, true);
+    if (rc > 0)
+      return rc;
+
+    rc = rtems_rfs_dir_insert_entry (fs, dir, buffer, name, length, ino, hash);
+    if (rc != ENOSPC)
+      return rc;
+
+    /*
+     * The leaf is full. If the parent of the leaf has space split the leaf
+     * else make space in the index and try again.
+     */
+    level = path.levels - 1;
+
+    if (path.count[level] < rtems_rfs_dir_index_limit (fs))
+    {
+      /*
+       * The split moves entries to the new leaf.
+       */
+      rtems_rfs_cache_dentry_purge (fs, rtems_rfs_inode_ino (dir));
+      rc = rtems_rfs_dir_index_split_leaf (fs, map, buffer, &path);
+    }
+    else if (level == 0)
+      rc = rtems_rfs_dir_index_add_level (fs, map, buffer);
+    else if (path.count[0] < rtems_rfs_dir_index_limit (fs))
+      rc = rtems_rfs_dir_index_split_node (fs, map, buffer, &path);
+    else
+      rc = ENOSPC;
+
+    if (rc > 0)
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+        printf ("rtems-rfs: dir-index: add-entry: dir=%" PRIu32 ": %d: %s\n",
+                rtems_rfs_inode_ino (dir), rc, strerror (rc));
+      return rc;
+    }
+  }
+}
+
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -62,6 +798,7 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 {
   rtems_rfs_block_map     map;
   rtems_rfs_buffer_handle entries;
+  uint32_t                hash;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -77,6 +814,21 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   *ino = RTEMS_RFS_EMPTY_INO;
   *offset = 0;
 
+  /*
+   * Calculate the hash of the look up string.
+   */
+  hash = rtems_rfs_dir_hash (name, length);
+
+  if (rtems_rfs_cache_dentry_lookup (fs, rtems_rfs_inode_ino (inode),
+                                     name, length, hash, ino, offset))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
+      printf ("rtems-rfs: dir-lookup-ino: "
+              "entry cached in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
+              rtems_rfs_inode_ino (inode), *ino, *offset);
+    return 0;
+  }
+
   rc = rtems_rfs_block_map_open (fs, inode, &map);
   if (rc > 0)
   {
@@ -98,18 +850,35 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   else
   {
     rtems_rfs_block_no block;
-    uint32_t           hash;
+    bool               indexed;
 
-    /*
-     * Calculate the hash of the look up string.
-     */
-    hash = rtems_rfs_dir_hash (name, length);
+    indexed = rtems_rfs_dir_indexed (fs, inode);
+
+    if (indexed)
+    {
+      rtems_rfs_dir_index_path path;
+      rtems_rfs_block_pos      bpos;
+
+      /*
+       * Only the leaf the index references for the hash can hold the entry.
+       */
+      rc = rtems_rfs_dir_index_find (fs, &map, &entries, hash, &path);
+      if (rc == 0)
+      {
+        rtems_rfs_block_set_bpos_zero (&bpos);
+        bpos.bno = path.leaf;
+        rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
+      }
+    }
+    else
+    {
+      /*
+       * Locate the first block. The map points to the start after open so just
+       * seek 0. If an error the block will be 0.
+       */
+      rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    }
 
-    /*
-     * Locate the first block. The map points to the start after open so just
-     * seek 0. If an error the block will be 0.
-     */
-    rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -188,6 +957,9 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                       "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
                       rtems_rfs_inode_ino (inode), *ino, *offset);
 
+            rtems_rfs_cache_dentry_add (fs, rtems_rfs_inode_ino (inode),
+                                        name, length, hash, *ino, *offset);
+
             rtems_rfs_buffer_handle_close (fs, &entries);
             rtems_rfs_block_map_close (fs, &map);
             return 0;
@@ -198,6 +970,9 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
         entry += elength;
       }
 
+      if ((rc == 0) && indexed)
+        rc = ENOENT;
+
       if (rc == 0)
       {
         rc = rtems_rfs_block_map_next_block (fs, &map, &block);
@@ -260,6 +1035,15 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  if (rtems_rfs_dir_indexed (fs, dir))
+  {
+    rc = rtems_rfs_dir_index_add_entry (fs, dir, &map, &buffer,
+                                        name, length, ino);
+    rtems_rfs_buffer_handle_close (fs, &buffer);
+    rtems_rfs_block_map_close (fs, &map);
+    return rc;
+  }
+
   /*
    * Search the map from the beginning to find any empty space.
    */
@@ -268,8 +1052,6 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   while (true)
   {
     rtems_rfs_block_no block;
-    uint8_t*           entry;
-    int                offset;
     bool               read = true;
 
     /*
@@ -289,6 +1071,20 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
         break;
       }
 
+      /*
+       * We have reached the end of the directory. If the first block is full
+       * and the file system supports the hashed directory index create the
+       * index and add the entry with the index.
+       */
+      if (rtems_rfs_fs_dir_index (fs) && (rtems_rfs_block_map_count (&map) == 1))
+      {
+        rc = rtems_rfs_dir_index_create (fs, dir, &map, &buffer);
+        if (rc == 0)
+          rc = rtems_rfs_dir_index_add_entry (fs, dir, &map, &buffer,
+                                              name, length, ino);
+        break;
+      }
+
       /*
        * We have reached the end of the directory so add a block.
        */
@@ -317,56 +1113,14 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
       break;
     }
 
-    entry  = rtems_rfs_buffer_data (&buffer);
-
     if (!read)
-      memset (entry, 0xff, rtems_rfs_fs_block_size (fs));
-
-    offset = 0;
-
-    while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
-    {
-      rtems_rfs_ino eino;
-      int           elength;
-
-      elength = rtems_rfs_dir_entry_length (entry);
-      eino    = rtems_rfs_dir_entry_ino (entry);
-
-      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
-      {
-        if ((length + RTEMS_RFS_DIR_ENTRY_SIZE) <
-            (rtems_rfs_fs_block_size (fs) - offset))
-        {
-          uint32_t hash;
-          hash = rtems_rfs_dir_hash (name, length);
-          rtems_rfs_dir_set_entry_hash (entry, hash);
-          rtems_rfs_dir_set_entry_ino (entry, ino);
-          rtems_rfs_dir_set_entry_length (entry,
-                                          RTEMS_RFS_DIR_ENTRY_SIZE + length);
-          memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
-          rtems_rfs_buffer_mark_dirty (&buffer);
-          rtems_rfs_buffer_handle_close (fs, &buffer);
-          rtems_rfs_block_map_close (fs, &map);
-          return 0;
-        }
-
-        break;
-      }
-
-      if (rtems_rfs_dir_entry_valid (fs, elength, eino))
-      {
-        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
-          printf ("rtems-rfs: dir-add-entry: "
-                  "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04x\n",
-                  rtems_rfs_inode_ino (dir), elength, eino, offset);
-        rtems_rfs_buffer_handle_close (fs, &buffer);
-        rtems_rfs_block_map_close (fs, &map);
-        return EIO;
-      }
+      memset (rtems_rfs_buffer_data (&buffer), 0xff,
+              rtems_rfs_fs_block_size (fs));
 
-      entry  += elength;
-      offset += elength;
-    }
+    rc = rtems_rfs_dir_insert_entry (fs, dir, &buffer, name, length, ino,
+                                     rtems_rfs_dir_hash (name, length));
+    if (rc != ENOSPC)
+      break;
   }
 
   rtems_rfs_buffer_handle_close (fs, &buffer);
@@ -384,12 +1138,19 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
   rtems_rfs_block_no      block;
   rtems_rfs_buffer_handle buffer;
   bool                    search;
+  bool                    indexed;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_DEL_ENTRY))
     printf ("rtems-rfs: dir-del-entry: dir=%" PRId32 ", entry=%" PRId32 " offset=%" PRIu32 "\n",
             rtems_rfs_inode_ino (dir), ino, offset);
 
+  /*
+   * The removal moves the entries after the entry in the block so the cached
+   * offsets of the directory entries are no longer valid.
+   */
+  rtems_rfs_cache_dentry_purge (fs, rtems_rfs_inode_ino (dir));
+
   rc = rtems_rfs_block_map_open (fs, dir, &map);
   if (rc > 0)
     return rc;
@@ -415,6 +1176,8 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
    */
   search = offset ? false : true;
 
+  indexed = rtems_rfs_dir_indexed (fs, dir);
+
   while (rc == 0)
   {
     uint8_t* entry;
@@ -472,7 +1235,8 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
         /*
          * If the remainder of the block is empty and this is the start of the
-         * block and it is the last block in the map shrink the map.
+         * block and it is the last block in the map shrink the map. The index
+         * references the blocks of an indexed directory so they are kept.
          *
          * @note We could check again to see if the new end block in the map is
          *       also empty. This way we could clean up an empty directory.
@@ -486,7 +1250,7 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                   ino, elength, block, eoffset,
                   rtems_rfs_block_map_last (&map) ? "yes" : "no");
 
-        if ((elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
+        if (!indexed && (elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
             (eoffset == 0) && rtems_rfs_block_map_last (&map))
         {
           rc = rtems_rfs_block_map_shrink (fs, &map, 1);
@@ -111,6 +111,54 @@
 #define rtems_rfs_dir_set_entry_length(_e, _l) \
   rtems_rfs_write_u16 (_e + RTEMS_RFS_DIR_ENTRY_LEN, _l)
 
+/**
+ * The hashed directory index. A directory with the index has the
+ * RTEMS_RFS_INODE_FLAG_DIR_INDEX inode flag set. The first block of the
+ * directory is the root of the index. An index block holds a table of entries
+ * sorted by hash. Each entry holds the lowest hash of the names in the block it
+ * references. The blocks are the logical block numbers in the directory. The
+ * root has a depth of 0 if its entries reference the leaf blocks which hold the
+ * directory entries or 1 if the entries reference index blocks of depth 0.
+ *
+ * The header of an index block has the length field of a directory entry set
+ * to RTEMS_RFS_DIR_ENTRY_EMPTY so a linear scan of the directory sees an index
+ * block as an empty block.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAGIC        (0x28092014) /**< The magic number in
+                                                       * the hash field. */
+#define RTEMS_RFS_DIR_INDEX_DEPTH        (10) /**< The depth offset in the
+                                               * header. */
+#define RTEMS_RFS_DIR_INDEX_COUNT        (12) /**< The entry count offset in
+                                               * the header. */
+#define RTEMS_RFS_DIR_INDEX_HEADER_SIZE  (16) /**< The size of the header. */
+#define RTEMS_RFS_DIR_INDEX_ENTRY_HASH   (0)  /**< The hash offset in an index
+                                               * entry. */
+#define RTEMS_RFS_DIR_INDEX_ENTRY_BLOCK  (4)  /**< The block offset in an index
+                                               * entry. */
+#define RTEMS_RFS_DIR_INDEX_ENTRY_SIZE   (8)  /**< The size of an index
+                                               * entry. */
+#define RTEMS_RFS_DIR_INDEX_MAX_DEPTH    (1)  /**< The maximum depth of the
+                                               * root. */
+
+/**
+ * Return the number of entries an index block can hold.
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_dir_index_limit(_fs) \
+  ((rtems_rfs_fs_block_size (_fs) - RTEMS_RFS_DIR_INDEX_HEADER_SIZE) / \
+   RTEMS_RFS_DIR_INDEX_ENTRY_SIZE)
+
+/**
+ * Does the directory have a hashed directory index ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ * @param[in] _h is the inode handle of the directory.
+ */
+#define rtems_rfs_dir_indexed(_fs, _h) \
+  (rtems_rfs_fs_dir_index (_fs) && \
+   (rtems_rfs_inode_get_flags (_h) & RTEMS_RFS_INODE_FLAG_DIR_INDEX))
+
 /**
  * Look up a directory entry in the directory pointed to by the inode. The look
  * up is local to this directory. No need to decend.
@@ -21,6 +21,7 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include <rtems/rfs/rtems-rfs-cache.h>
 #include <rtems/rfs/rtems-rfs-data.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
@@ -91,8 +92,9 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return EIO;
   }
 
-  if ((read_sb (RTEMS_RFS_SB_OFFSET_VERSION) & RTEMS_RFS_VERSION_MASK) !=
-      (RTEMS_RFS_VERSION * RTEMS_RFS_VERSION_MASK))
+  fs->version = read_sb (RTEMS_RFS_SB_OFFSET_VERSION);
+
+  if ((fs->version & RTEMS_RFS_VERSION_MASK & ~RTEMS_RFS_VERSION_FEATURES) != 0)
   {
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
       printf ("rtems-rfs: read-superblock: incompatible version: %08" PRIx32 " (%08" PRIx32 ")\n",
@@ -318,6 +320,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
 
   rtems_rfs_buffer_close (fs);
 
+  rtems_rfs_cache_close (fs);
+
   free (fs);
   return 0;
 }
@@ -45,9 +45,21 @@
 
 /**
  * RFS Version Number Mask. The mask determines which bits of the version
- * number indicate compatility issues.
+ * number indicate compatility issues. Each bit in the mask is a feature of the
+ * on-disk format a file system must support to mount the disk.
  */
-#define RTEMS_RFS_VERSION_MASK INT32_C(0x00000000)
+#define RTEMS_RFS_VERSION_MASK INT32_C(0xffff0000)
+
+/**
+ * RFS Version Feature: Directories can have a hashed directory index. The
+ * index is created when a directory grows beyond its first block.
+ */
+#define RTEMS_RFS_VERSION_DIR_INDEX (0x00010000)
+
+/**
+ * The version features this file system supports.
+ */
+#define RTEMS_RFS_VERSION_FEATURES (RTEMS_RFS_VERSION_DIR_INDEX)
 
 /**
  * The root inode number. Do not use 0 as this has special meaning in some
@@ -119,6 +131,12 @@ struct _rtems_rfs_file_system
    */
   uint32_t flags;
 
+  /**
+   * The version read from the superblock. The compatible bits determine the
+   * features of the on-disk format.
+   */
+  uint32_t version;
+
   /**
    * The number of blocks in the disk. The size of the disk is the number of
    * blocks by the block size. This should be within a block size of the size
@@ -253,6 +271,12 @@ struct _rtems_rfs_file_system
    */
   rtems_chain_control file_shares;
 
+  /**
+   * The directory entry and inode cache. NULL if the file system has no
+   * cache.
+   */
+  struct _rtems_rfs_cache* cache;
+
   /**
    * Pointer to user data supplied when opening.
    */
@@ -279,6 +303,13 @@ struct _rtems_rfs_file_system
  */
 #define rtems_rfs_fs_no_local_cache(_f) ((_f)->flags & RTEMS_RFS_FS_NO_LOCAL_CACHE)
 
+/**
+ * Does the file system support the hashed directory index ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_f) ((_f)->version & RTEMS_RFS_VERSION_DIR_INDEX)
+
 /**
  * The disk device number.
  *
@@ -421,7 +421,7 @@ rtems_rfs_write_superblock (rtems_rfs_file_system* fs)
   memset (sb, 0xff, rtems_rfs_fs_block_size (fs));
 
   write_sb (RTEMS_RFS_SB_OFFSET_MAGIC, RTEMS_RFS_SB_MAGIC);
-  write_sb (RTEMS_RFS_SB_OFFSET_VERSION, RTEMS_RFS_VERSION);
+  write_sb (RTEMS_RFS_SB_OFFSET_VERSION, fs->version);
   write_sb (RTEMS_RFS_SB_OFFSET_BLOCKS, rtems_rfs_fs_blocks (fs));
   write_sb (RTEMS_RFS_SB_OFFSET_BLOCK_SIZE, rtems_rfs_fs_block_size (fs));
   write_sb (RTEMS_RFS_SB_OFFSET_BAD_BLOCKS, fs->bad_blocks);
@@ -550,6 +550,10 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
 
   fs.flags = RTEMS_RFS_FS_NO_LOCAL_CACHE;
 
+  fs.version = RTEMS_RFS_VERSION;
+  if (config->dir_index)
+    fs.version |= RTEMS_RFS_VERSION_DIR_INDEX;
+
   /*
    * Open the buffer interface.
    */
@@ -601,6 +605,8 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
     printf ("rtems-rfs: format: groups = %u\n", fs.group_count);
     printf ("rtems-rfs: format: group blocks = %zu\n", fs.group_blocks);
     printf ("rtems-rfs: format: group inodes = %zu\n", fs.group_inodes);
+    printf ("rtems-rfs: format: directory index = %s\n",
+            rtems_rfs_fs_dir_index (&fs) ? "yes" : "no");
   }
 
   rc = rtems_rfs_buffer_setblksize (&fs, rtems_rfs_fs_block_size (&fs));
@@ -65,6 +65,12 @@ typedef struct _rtems_rfs_format_config
    */
   bool initialise_inodes;
 
+  /**
+   * Enable the hashed directory index. Directories larger than a block are
+   * indexed by the hash of the entry names.
+   */
+  bool dir_index;
+
   /**
    * Is the format verbose.
    */
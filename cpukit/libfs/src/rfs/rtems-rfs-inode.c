@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-cache.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
@@ -71,6 +72,7 @@ rtems_rfs_inode_open (rtems_rfs_file_system*  fs,
   handle->ino = ino;
   handle->node = NULL;
   handle->loads = 0;
+  handle->cache = NULL;
 
   gino  = ino - RTEMS_RFS_ROOT_INO;
   group = gino / fs->group_inodes;
@@ -86,6 +88,54 @@ rtems_rfs_inode_open (rtems_rfs_file_system*  fs,
   return rc;
 }
 
+int
+rtems_rfs_inode_open_cached (rtems_rfs_file_system*  fs,
+                             rtems_rfs_ino           ino,
+                             rtems_rfs_inode_handle* handle)
+{
+  rtems_rfs_cache_inode* entry;
+  int                    rc;
+
+  rc = rtems_rfs_inode_open (fs, ino, handle, false);
+  if (rc > 0)
+    return rc;
+
+  entry = rtems_rfs_cache_inode_get (fs, ino);
+  if (!entry)
+  {
+    rc = rtems_rfs_inode_load (fs, handle);
+    if (rc > 0)
+      return rc;
+
+    /*
+     * Copy the inode to the cache and release the block. If the cache has no
+     * free entry use the inode in the block.
+     */
+    entry = rtems_rfs_cache_inode_add (fs, ino, handle->node);
+    if (!entry)
+      return 0;
+
+    handle->loads = 0;
+    handle->node = NULL;
+
+    rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+    if (rc > 0)
+    {
+      rtems_rfs_cache_inode_release (fs, entry);
+      return rc;
+    }
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_INODE_LOAD))
+    printf ("rtems-rfs: inode-open-cached: ino=%" PRIu32 "\n", ino);
+
+  handle->cache = entry;
+  handle->node = &entry->node;
+  handle->loads = 1;
+
+  return 0;
+}
+
 int
 rtems_rfs_inode_close (rtems_rfs_file_system*  fs,
                        rtems_rfs_inode_handle* handle)
@@ -140,6 +190,29 @@ rtems_rfs_inode_load (rtems_rfs_file_system*  fs,
   return 0;
 }
 
+/**
+ * Write the inode loaded from the inode cache to the block holding the inode.
+ */
+static int
+rtems_rfs_inode_write_back (rtems_rfs_file_system*  fs,
+                            rtems_rfs_inode_handle* handle)
+{
+  rtems_rfs_inode* node;
+  int              rc;
+
+  rc = rtems_rfs_buffer_handle_request (fs, &handle->buffer,
+                                        handle->block, true);
+  if (rc > 0)
+    return rc;
+
+  node = (rtems_rfs_inode*) rtems_rfs_buffer_data (&handle->buffer);
+  node += handle->offset;
+  memcpy (node, handle->node, RTEMS_RFS_INODE_SIZE);
+  rtems_rfs_buffer_mark_dirty (&handle->buffer);
+
+  return 0;
+}
+
 int
 rtems_rfs_inode_unload (rtems_rfs_file_system*  fs,
                         rtems_rfs_inode_handle* handle,
@@ -161,12 +234,30 @@ rtems_rfs_inode_unload (rtems_rfs_file_system*  fs,
 
     if (handle->loads == 0)
     {
+      int brc;
+
       /*
        * If the buffer is dirty it will be release. Also set the ctime.
        */
       if (rtems_rfs_buffer_dirty (&handle->buffer) && update_ctime)
         rtems_rfs_inode_set_ctime (handle, time (NULL));
-      rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+
+      /*
+       * Keep the cached copy of the inode the same as the inode in the block.
+       */
+      if (handle->cache)
+      {
+        if (rtems_rfs_buffer_dirty (&handle->buffer))
+          rc = rtems_rfs_inode_write_back (fs, handle);
+        rtems_rfs_cache_inode_release (fs, handle->cache);
+        handle->cache = NULL;
+      }
+      else if (rtems_rfs_buffer_dirty (&handle->buffer))
+        rtems_rfs_cache_inode_update (fs, handle->ino, handle->node);
+
+      brc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+      if (rc == 0)
+        rc = brc;
       handle->node = NULL;
     }
   }
@@ -337,6 +428,8 @@ rtems_rfs_inode_delete (rtems_rfs_file_system*  fs,
     if (rc > 0)
       return rc;
 
+    rtems_rfs_cache_inode_purge (fs, handle->ino);
+
     /*
      * Free the blocks the inode may have attached.
      */
@@ -94,6 +94,12 @@ typedef uint32_t rtems_rfs_inode_block;
 #define RTEMS_RFS_INODE_DATA_NAME_SIZE \
   (RTEMS_RFS_INODE_BLOCKS * sizeof (rtems_rfs_inode_block))
 
+/**
+ * The inode flags.
+ */
+#define RTEMS_RFS_INODE_FLAG_DIR_INDEX (1 << 0) /**< The directory has a hashed
+                                                 * directory index. */
+
 /**
  * The inode.
  */
@@ -115,7 +121,7 @@ typedef struct _rtems_rfs_inode
   uint32_t owner;
 
   /**
-   * Reserved.
+   * The inode flags.
    */
   uint16_t flags;
 
@@ -215,6 +221,11 @@ typedef struct _rtems_rfs_inode_handle
    */
   int loads;
 
+  /**
+   * The inode cache entry holding the inode if loaded from the inode cache.
+   */
+  struct _rtems_rfs_cache_inode* cache;
+
 } rtems_rfs_inode_handle;
 
 /**
@@ -608,6 +619,23 @@ int rtems_rfs_inode_open (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* handle,
                           bool                    load);
 
+/**
+ * Open and load the inode handle to read the inode. The inode is loaded from
+ * the inode cache if the file system has one so the block holding the inode
+ * does not need to be requested. A change to the inode is written to the block
+ * when the inode is unloaded. The inode cannot be deleted with this handle.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] ino is the inode number.
+ * @param[in] handle is the handle to the inode we are opening.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_inode_open_cached (rtems_rfs_file_system*  fs,
+                                 rtems_rfs_ino           ino,
+                                 rtems_rfs_inode_handle* handle);
+
 /**
  * The close inode handle. All opened inodes need to be closed.
  *
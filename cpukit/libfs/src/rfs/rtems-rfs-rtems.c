@@ -33,6 +33,7 @@
 #error "unsupport size of mode_t"
 #endif
 
+#include <rtems/rfs/rtems-rfs-cache.h>
 #include <rtems/rfs/rtems-rfs-file.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-link.h>
@@ -164,7 +165,7 @@ rtems_rfs_rtems_eval_token(
       if (rc == 0) {
         rc = rtems_rfs_inode_close (fs, inode);
         if (rc == 0) {
-          rc = rtems_rfs_inode_open (fs, entry_ino, inode, true);
+          rc = rtems_rfs_inode_open_cached (fs, entry_ino, inode);
         }
 
         if (rc != 0) {
@@ -229,7 +230,7 @@ rtems_rfs_rtems_eval_path (rtems_filesystem_eval_path_context_t *ctx)
   rtems_rfs_inode_handle inode;
   int rc;
 
-  rc = rtems_rfs_inode_open (fs, ino, &inode, true);
+  rc = rtems_rfs_inode_open_cached (fs, ino, &inode);
   if (rc == 0) {
     rtems_filesystem_eval_path_generic (
       ctx,
@@ -692,10 +693,13 @@ rtems_rfs_rtems_rename(const rtems_filesystem_location_info_t* old_parent_loc,
                        size_t                                  new_name_len)
 {
   rtems_rfs_file_system*  fs = rtems_rfs_rtems_pathloc_dev (old_loc);
+  rtems_rfs_inode_handle  parent_inode;
   rtems_rfs_ino           old_parent;
   rtems_rfs_ino           new_parent;
   rtems_rfs_ino           ino;
   uint32_t                doff;
+  struct dirent           entry;
+  bool                    relookup = false;
   int                     rc;
 
   old_parent = rtems_rfs_rtems_get_pathloc_ino (old_parent_loc);
@@ -708,6 +712,28 @@ rtems_rfs_rtems_rename(const rtems_filesystem_location_info_t* old_parent_loc,
     printf ("rtems-rfs: rename: ino:%" PRId32 " doff:%" PRIu32 ", new parent:%" PRId32 "\n",
             ino, doff, new_parent);
 
+  /*
+   * Adding the new name to a directory with a hashed index can split a leaf of
+   * the index and move the entry of the old name. Read the old name so the
+   * entry can be found again after the link.
+   */
+  if (old_parent == new_parent)
+  {
+    rc = rtems_rfs_inode_open (fs, old_parent, &parent_inode, true);
+    if (rc == 0)
+    {
+      size_t length;
+      relookup = rtems_rfs_dir_indexed (fs, &parent_inode) &&
+        (rtems_rfs_dir_read (fs, &parent_inode, doff, &entry, &length) == 0) &&
+        (entry.d_ino == ino);
+      rc = rtems_rfs_inode_close (fs, &parent_inode);
+    }
+    if (rc)
+    {
+      return rtems_rfs_rtems_error ("rename: reading entry", rc);
+    }
+  }
+
   /*
    * Link to the inode before unlinking so the inode is not erased when
    * unlinked.
@@ -718,6 +744,25 @@ rtems_rfs_rtems_rename(const rtems_filesystem_location_info_t* old_parent_loc,
     return rtems_rfs_rtems_error ("rename: linking", rc);
   }
 
+  if (relookup)
+  {
+    rc = rtems_rfs_inode_open (fs, old_parent, &parent_inode, true);
+    if (rc == 0)
+    {
+      rtems_rfs_ino entry_ino;
+      rc = rtems_rfs_dir_lookup_ino (fs, &parent_inode,
+                                     entry.d_name, entry.d_namlen,
+                                     &entry_ino, &doff);
+      if ((rc == 0) && (entry_ino != ino))
+        rc = EIO;
+      rtems_rfs_inode_close (fs, &parent_inode);
+    }
+    if (rc)
+    {
+      return rtems_rfs_rtems_error ("rename: looking up entry", rc);
+    }
+  }
+
   /*
    * Unlink all inodes even directories with the dir option as false because a
    * directory may not be empty.
@@ -835,6 +880,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  size_t                   dentry_cache = 0;
+  size_t                   inode_cache = 0;
   const char*              options = data;
   int                      rc;
 
@@ -855,6 +902,16 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "dentry-cache",
+                      sizeof ("dentry-cache") - 1) == 0)
+    {
+      dentry_cache = strtoul (options + sizeof ("dentry-cache"), 0, 0);
+    }
+    else if (strncmp (options, "inode-cache",
+                      sizeof ("inode-cache") - 1) == 0)
+    {
+      inode_cache = strtoul (options + sizeof ("inode-cache"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -895,6 +952,16 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  rc = rtems_rfs_cache_open (fs, dentry_cache, inode_cache);
+  if (rc > 0)
+  {
+    rtems_rfs_fs_close (fs);
+    rtems_rfs_mutex_unlock (&rtems->access);
+    rtems_rfs_mutex_destroy (&rtems->access);
+    free (rtems);
+    return rtems_rfs_rtems_error ("initialise: cache", rc);
+  }
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
@@ -22,6 +22,7 @@
 
 #include <rtems/rfs/rtems-rfs-block.h>
 #include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-cache.h>
 #include <rtems/rfs/rtems-rfs-group.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
@@ -160,6 +161,56 @@ rtems_rfs_shell_data (rtems_rfs_file_system* fs, int argc, char *argv[])
   return 0;
 }
 
+static int
+rtems_rfs_shell_cache_hit_rate (const rtems_rfs_cache_stats* stats)
+{
+  uint32_t lookups = stats->hits + stats->misses;
+  if (lookups == 0)
+    return 0;
+  return (int) (((uint64_t) stats->hits * 1000) / lookups);
+}
+
+static int
+rtems_rfs_shell_cache (rtems_rfs_file_system* fs, int argc, char *argv[])
+{
+  rtems_rfs_cache_stats dentry;
+  rtems_rfs_cache_stats inode;
+  int                   dpcent;
+  int                   ipcent;
+
+  rtems_rfs_shell_lock_rfs (fs);
+
+  if (fs->cache)
+  {
+    dentry = fs->cache->dentry_stats;
+    inode = fs->cache->inode_stats;
+  }
+  else
+  {
+    memset (&dentry, 0, sizeof (dentry));
+    memset (&inode, 0, sizeof (inode));
+  }
+
+  rtems_rfs_shell_unlock_rfs (fs);
+
+  dpcent = rtems_rfs_shell_cache_hit_rate (&dentry);
+  ipcent = rtems_rfs_shell_cache_hit_rate (&inode);
+
+  printf ("RFS Directory Entry and Inode Cache\n");
+  printf ("    dentry entries: %zu\n",          dentry.entries);
+  printf ("       dentry used: %zu\n",          dentry.used);
+  printf ("       dentry hits: %" PRIu32 " (%d.%d%%)\n",
+          dentry.hits, dpcent / 10, dpcent % 10);
+  printf ("     dentry misses: %" PRIu32 "\n", dentry.misses);
+  printf ("     inode entries: %zu\n",          inode.entries);
+  printf ("        inode used: %zu\n",          inode.used);
+  printf ("        inode hits: %" PRIu32 " (%d.%d%%)\n",
+          inode.hits, ipcent / 10, ipcent % 10);
+  printf ("      inode misses: %" PRIu32 "\n", inode.misses);
+
+  return 0;
+}
+
 static int
 rtems_rfs_shell_block (rtems_rfs_file_system* fs, int argc, char *argv[])
 {
@@ -607,6 +658,8 @@ rtems_shell_debugrfs (int argc, char *argv[])
   {
     { "block", rtems_rfs_shell_block,
       "Display the contents of a block, block <bno>, block <bno>..<bno>" },
+    { "cache", rtems_rfs_shell_cache,
+      "Display the directory entry and inode cache usage, cache" },
     { "data", rtems_rfs_shell_data,
       "Display file system data, data" },
     { "dir", rtems_rfs_shell_dir,
@@ -711,6 +764,10 @@ rtems_shell_rfs_format (int argc, char* argv[])
           config.initialise_inodes = true;
           break;
 
+        case 'x':
+          config.dir_index = true;
+          break;
+
         case 'o':
           arg++;
           if (arg >= argc)
@@ -90,7 +90,9 @@ rtems_rfs_trace_shell_command (int argc, char *argv[])
     "file-open",
     "file-close",
     "file-io",
-    "file-set"
+    "file-set",
+    "dir-index",
+    "cache"
   };
 
   rtems_rfs_trace_mask set_value = 0;
@@ -83,6 +83,8 @@ typedef uint64_t rtems_rfs_trace_mask;
 #define RTEMS_RFS_TRACE_FILE_CLOSE             (1ULL << 36)
 #define RTEMS_RFS_TRACE_FILE_IO                (1ULL << 37)
 #define RTEMS_RFS_TRACE_FILE_SET               (1ULL << 38)
+#define RTEMS_RFS_TRACE_DIR_INDEX              (1ULL << 39)
+#define RTEMS_RFS_TRACE_CACHE                  (1ULL << 40)
 
 /**
  * Call to check if this part is bring traced. If RTEMS_RFS_TRACE is defined to
@@ -361,12 +361,12 @@ void
 rtems_bsdnet_semaphore_obtain (void)
 {
 #ifdef RTEMS_FAST_MUTEX
-	ISR_Level level;
+	ISR_lock_Context lock_context;
 	Thread_Control *executing;
 #ifdef RTEMS_SMP
 	_Thread_Disable_dispatch();
 #endif
-	_ISR_Disable (level);
+	_ISR_lock_ISR_disable (&lock_context);
 	executing = _Thread_Executing;
 	_CORE_mutex_Seize (
 		&the_networkSemaphore->Core_control.mutex,
@@ -374,7 +374,7 @@ rtems_bsdnet_semaphore_obtain (void)
 		networkSemaphore,
 		1,		/* wait */
 		0,		/* forever */
-		level
+		&lock_context
 		);
 #ifdef RTEMS_SMP
 	_Thread_Enable_dispatch();
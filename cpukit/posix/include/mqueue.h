@@ -206,6 +206,102 @@ int mq_getattr(
   struct mq_attr *mqstat
 );
 
+/**
+ * @brief Obtain a message buffer on loan from a message queue.
+ *
+ * This is an RTEMS extension to send messages without a copy operation.  The
+ * message is filled in place and sent via mq_send_buffer_np().  A message
+ * buffer which is not sent must be returned via mq_release_buffer_np().
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred, errno is set to EBADF, EINVAL or EAGAIN in
+ * case no message buffer is available.
+ */
+int mq_obtain_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_ptr
+);
+
+/**
+ * @brief Send a message buffer on loan to a message queue.
+ *
+ * On success the message buffer is no longer on loan.  In case of an error
+ * the message buffer remains on loan.
+ *
+ * @see mq_obtain_buffer_np().
+ */
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_ptr,
+  size_t        msg_len,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receive a message buffer on loan from a message queue.
+ *
+ * This works like mq_receive(), however, the message is not copied.
+ * Instead, the message buffer itself is lent to the caller, who must return
+ * it via mq_release_buffer_np().  Threads waiting to send to a full message
+ * queue fail with EAGAIN if a message buffer is lent.
+ *
+ * @return The length of the message or -1 in case of an error.
+ */
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **msg_ptr,
+  unsigned int  *msg_prio
+);
+
+/**
+ * @brief Return a message buffer on loan to a message queue.
+ *
+ * @see mq_obtain_buffer_np() and mq_receive_buffer_np().
+ */
+int mq_release_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_ptr
+);
+
+/**
+ * @brief Send a batch of messages to a message queue.
+ *
+ * This is an RTEMS extension.  Up to @a count messages are sent with the
+ * priority @a msg_prio under a single object lookup.  The message with
+ * index i starts at @a msg_ptr plus i times the mq_msgsize attribute of the
+ * message queue and its length is @a msg_lens[i].  This function never
+ * blocks.
+ *
+ * @return The count of messages sent or -1 in case no message was sent.
+ */
+ssize_t mq_send_many_np(
+  mqd_t         mqdes,
+  const char   *msg_ptr,
+  const size_t *msg_lens,
+  unsigned int  count,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receive a batch of messages from a message queue.
+ *
+ * This is an RTEMS extension.  Up to @a max_count pending messages are
+ * received under a single object lookup.  The message with index i is
+ * stored at @a msg_ptr plus i times the mq_msgsize attribute of the message
+ * queue and its length is returned in @a msg_lens[i].  In case the message
+ * queue is empty and O_NONBLOCK is not set, the caller waits for one
+ * message.  The messages are received in priority order, however, their
+ * priorities are not returned.
+ *
+ * @return The count of messages received or -1 in case of an error.
+ */
+ssize_t mq_receive_many_np(
+  mqd_t         mqdes,
+  char         *msg_ptr,
+  size_t       *msg_lens,
+  unsigned int  max_count
+);
+
 /** @} */
 
 #ifdef __cplusplus
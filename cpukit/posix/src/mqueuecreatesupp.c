@@ -114,6 +114,7 @@ int _POSIX_Message_queue_Create_support(
    */
   the_mq_attr = &the_mq->Message_queue.Attributes;
   the_mq_attr->discipline = CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO;
+  the_mq_attr->single_producer_single_consumer = false;
 
   if ( !_CORE_message_queue_Initialize(
            &the_mq->Message_queue,
@@ -0,0 +1,68 @@
+/**
+ * @file
+ *
+ * @brief Obtains a Message Buffer on Loan from a Message Queue
+ * @ingroup POSIXAPI
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueueimpl.h>
+
+int mq_obtain_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_ptr
+)
+{
+  POSIX_Message_queue_Control_fd    *the_mq_fd;
+  Objects_Locations                  location;
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( msg_ptr == NULL )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_RDONLY ) {
+        _Objects_Put( &the_mq_fd->Object );
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      the_message = _CORE_message_queue_Obtain_buffer(
+        &the_mq_fd->Queue->Message_queue
+      );
+      _Objects_Put( &the_mq_fd->Object );
+
+      if ( the_message == NULL )
+        rtems_set_errno_and_return_minus_one( EAGAIN );
+
+      *msg_ptr = the_message->Contents.buffer;
+      return 0;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
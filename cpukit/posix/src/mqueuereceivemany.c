@@ -0,0 +1,87 @@
+/**
+ * @file
+ *
+ * @brief Receives a Batch of Messages from a Message Queue
+ * @ingroup POSIXAPI
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueueimpl.h>
+
+ssize_t mq_receive_many_np(
+  mqd_t         mqdes,
+  char         *msg_ptr,
+  size_t       *msg_lens,
+  unsigned int  max_count
+)
+{
+  POSIX_Message_queue_Control_fd *the_mq_fd;
+  Objects_Locations               location;
+  bool                            do_wait;
+  Thread_Control                 *executing;
+  uint32_t                        count;
+
+  if ( msg_ptr == NULL || msg_lens == NULL || max_count == 0 )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_WRONLY ) {
+        _Objects_Put( &the_mq_fd->Object );
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      do_wait = (the_mq_fd->oflag & O_NONBLOCK) ? false : true;
+
+      executing = _Thread_Executing;
+      _CORE_message_queue_Seize_many(
+        &the_mq_fd->Queue->Message_queue,
+        executing,
+        mqdes,
+        msg_ptr,
+        msg_lens,
+        max_count,
+        &count,
+        do_wait,
+        THREAD_QUEUE_WAIT_FOREVER
+      );
+      _Objects_Put( &the_mq_fd->Object );
+
+      if ( executing->Wait.return_code ) {
+        rtems_set_errno_and_return_minus_one(
+          _POSIX_Message_queue_Translate_core_message_queue_return_code(
+            executing->Wait.return_code
+          )
+        );
+      }
+
+      return (ssize_t) count;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
@@ -0,0 +1,89 @@
+/**
+ * @file
+ *
+ * @brief Sends a Batch of Messages to a Message Queue
+ * @ingroup POSIXAPI
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueueimpl.h>
+
+ssize_t mq_send_many_np(
+  mqd_t         mqdes,
+  const char   *msg_ptr,
+  const size_t *msg_lens,
+  unsigned int  count,
+  unsigned int  msg_prio
+)
+{
+  POSIX_Message_queue_Control_fd *the_mq_fd;
+  Objects_Locations               location;
+  CORE_message_queue_Status       msg_status;
+  uint32_t                        sent;
+
+  if ( msg_prio > MQ_PRIO_MAX )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  if ( msg_ptr == NULL || msg_lens == NULL || count == 0 )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_RDONLY ) {
+        _Objects_Put( &the_mq_fd->Object );
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      msg_status = _CORE_message_queue_Submit_many(
+        &the_mq_fd->Queue->Message_queue,
+        msg_ptr,
+        msg_lens,
+        count,
+        &sent,
+        mqdes,      /* mqd_t is an object id */
+        NULL,
+        _POSIX_Message_queue_Priority_to_core( msg_prio )
+      );
+      _Objects_Put( &the_mq_fd->Object );
+
+      /*
+       *  A partially sent batch is a success, the caller sees the count of
+       *  messages actually sent.
+       */
+      if ( sent > 0 )
+        return (ssize_t) sent;
+
+      rtems_set_errno_and_return_minus_one(
+        _POSIX_Message_queue_Translate_core_message_queue_return_code(
+          msg_status
+        )
+      );
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
@@ -75,7 +75,7 @@ POSIX_Mutex_Control *_POSIX_Mutex_Get (
 POSIX_Mutex_Control *_POSIX_Mutex_Get_interrupt_disable (
   pthread_mutex_t   *mutex,
   Objects_Locations *location,
-  ISR_Level         *level
+  ISR_lock_Context  *lock_context
 )
 {
   ___POSIX_Mutex_Get_support_error_check( mutex, location );
@@ -86,6 +86,6 @@ POSIX_Mutex_Control *_POSIX_Mutex_Get_interrupt_disable (
     &_POSIX_Mutex_Information,
     (Objects_Id) *mutex,
     location,
-    level
+    lock_context
   );
 }
@@ -167,6 +167,23 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_BARRIER_MANUAL_RELEASE    0x00000000
 
+/***************** RTEMS Message Queue Specific Attributes *****************/
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created may be used by any number of senders and receivers.
+ */
+#define RTEMS_MULTIPLE_PRODUCER_MULTIPLE_CONSUMER 0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Message Queue
+ *  instance created is used by exactly one sender and exactly one receiver.
+ *  The messages are passed through a lock-free ring buffer in this case.
+ *
+ *  @note The message queue instance must be local.
+ */
+#define RTEMS_SINGLE_PRODUCER_SINGLE_CONSUMER     0x00000200
+
 /**************** RTEMS Internal Task Specific Attributes ****************/
 
 /**
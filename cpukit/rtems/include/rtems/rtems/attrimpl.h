@@ -229,6 +229,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_multiprocessor_resource_sharing(
   return ( attribute_set & RTEMS_MULTIPROCESSOR_RESOURCE_SHARING ) != 0;
 }
 
+/**
+ *  @brief Checks if the single producer single consumer attribute
+ *  is enabled in the attribute_set
+ *
+ *  This function returns TRUE if the single producer single consumer
+ *  attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_single_producer_single_consumer(
+  rtems_attribute attribute_set
+)
+{
+  return ( attribute_set & RTEMS_SINGLE_PRODUCER_SINGLE_CONSUMER ) != 0;
+}
+
 /**
  *  @brief Checks if the barrier automatic release
  *  attribute is enabled in the attribute_set
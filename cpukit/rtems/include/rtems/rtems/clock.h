@@ -204,6 +204,24 @@ rtems_status_code rtems_clock_set(
  */
 rtems_status_code rtems_clock_tick( void );
 
+/**
+ * @brief Announce a Clock Tick to the Executing Processor
+ *
+ * This routine implements the rtems_clock_tick_processor directive.  On SMP
+ * configurations with a clock interrupt on each processor it is invoked by
+ * the clock interrupt of each processor other than the one which invokes
+ * rtems_clock_tick().  The executing processor then processes the expiration
+ * of its ticks based watchdogs itself and rtems_clock_tick() no longer
+ * processes them.  On uni-processor configurations this directive does
+ * nothing.
+ *
+ * @retval This directive always returns RTEMS_SUCCESSFUL.
+ *
+ * @note This method must be called from the clock interrupt of the
+ *       executing processor.
+ */
+rtems_status_code rtems_clock_tick_processor( void );
+
 /**
  * @brief Set the BSP specific Nanoseconds Extension
  *
@@ -260,6 +260,184 @@ rtems_status_code rtems_message_queue_get_number_pending(
   uint32_t *count
 );
 
+/**
+ *  @brief Obtains a message buffer on loan from a message queue.
+ *
+ *  This directive obtains a message buffer from the message buffer pool of
+ *  the message queue indicated by ID.  The message can be filled in place
+ *  and sent via rtems_message_queue_send_buffer() without a copy operation.
+ *  A message buffer which is not sent must be returned via
+ *  rtems_message_queue_release_buffer().
+ *
+ *  @param[in] id is the queue id
+ *  @param[out] buffer is the pointer to the message buffer on loan
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The buffer pointer is NULL.
+ *  @retval RTEMS_INVALID_ID Invalid message queue id.
+ *  @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ *  @retval RTEMS_NOT_DEFINED Not supported for single producer single
+ *          consumer message queues.
+ *  @retval RTEMS_TOO_MANY No message buffer is available.
+ */
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ *  @brief Sends a message buffer on loan to a message queue.
+ *
+ *  This directive sends the message buffer obtained via
+ *  rtems_message_queue_obtain_buffer() to the rear of the message queue
+ *  indicated by ID.  On success the message buffer is no longer on loan.
+ *  In case of an error the message buffer remains on loan.
+ *
+ *  @param[in] id is the queue id
+ *  @param[in] buffer is the message buffer on loan
+ *  @param[in] size is the size of the message
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer on loan
+ *          from this message queue.
+ *  @retval RTEMS_INVALID_SIZE The message size is too big.
+ *  @retval RTEMS_INVALID_ID Invalid message queue id.
+ *  @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ *  @retval RTEMS_NOT_DEFINED Not supported for single producer single
+ *          consumer message queues.
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ *  @brief Receives a message buffer on loan from a message queue.
+ *
+ *  This directive works like rtems_message_queue_receive(), however, the
+ *  message is not copied.  Instead, the message buffer itself is lent to the
+ *  caller, who must return it via rtems_message_queue_release_buffer().
+ *  Tasks waiting to send to a full message queue are unblocked with an error
+ *  status if a message buffer is lent.
+ *
+ *  @param[in] id is the queue id
+ *  @param[out] buffer is the pointer to the message buffer on loan
+ *  @param[out] size is the size of the received message
+ *  @param[in] option_set is the options on receive
+ *  @param[in] timeout is the number of ticks to wait
+ *
+ *  @retval This method returns RTEMS_SUCCESSFUL if there was not an
+ *          error. Otherwise, a status code is returned indicating the
+ *          source of the error.
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id        id,
+  void          **buffer,
+  size_t         *size,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+
+/**
+ *  @brief Returns a message buffer on loan to a message queue.
+ *
+ *  This directive returns a message buffer obtained via
+ *  rtems_message_queue_obtain_buffer() or
+ *  rtems_message_queue_receive_buffer() to the message buffer pool of the
+ *  message queue indicated by ID.
+ *
+ *  @param[in] id is the queue id
+ *  @param[in] buffer is the message buffer on loan
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer on loan
+ *          from this message queue.
+ *  @retval RTEMS_INVALID_ID Invalid message queue id.
+ *  @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ *  @retval RTEMS_NOT_DEFINED Not supported for single producer single
+ *          consumer message queues.
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
+/**
+ *  @brief Sends a batch of messages to a message queue.
+ *
+ *  This directive sends up to COUNT messages to the rear of the message
+ *  queue indicated by ID.  The message with index i starts at BUFFER plus i
+ *  times the maximum message size of the message queue and its size is
+ *  SIZES[i].  The object lookup and thread dispatch disable are done once
+ *  for the whole batch.  The caller never blocks.
+ *
+ *  @param[in] id is the queue id
+ *  @param[in] buffer is the start address of the messages
+ *  @param[in] sizes is the array of message sizes
+ *  @param[in] count is the count of messages to send
+ *  @param[out] sent is the count of messages actually sent
+ *
+ *  @retval RTEMS_SUCCESSFUL All messages were sent.
+ *  @retval RTEMS_TOO_MANY The message queue is full, only the first SENT
+ *          messages were sent.
+ *  @retval RTEMS_INVALID_ADDRESS A pointer parameter is NULL.
+ *  @retval RTEMS_INVALID_NUMBER The count is zero.
+ *  @retval RTEMS_INVALID_SIZE At least one message size is too big, no
+ *          message was sent.
+ *  @retval RTEMS_INVALID_ID Invalid message queue id.
+ *  @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ *  @retval RTEMS_NOT_DEFINED Not supported for single producer single
+ *          consumer message queues.
+ */
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+);
+
+/**
+ *  @brief Receives a batch of messages from a message queue.
+ *
+ *  This directive receives up to MAX_COUNT pending messages from the
+ *  message queue indicated by ID.  The message with index i is stored at
+ *  BUFFER plus i times the maximum message size of the message queue and
+ *  its size is returned in SIZES[i].  The object lookup, thread dispatch
+ *  disable and message removal are done once for the whole batch.  In case
+ *  the message queue is empty, the caller may wait for a single message
+ *  like in rtems_message_queue_receive().
+ *
+ *  @param[in] id is the queue id
+ *  @param[out] buffer is the start address of the message area
+ *  @param[out] sizes is the array of message sizes
+ *  @param[in] max_count is the maximum count of messages to receive
+ *  @param[out] count is the count of messages received
+ *  @param[in] option_set is the option set
+ *  @param[in] timeout is the number of ticks to wait if the queue is empty
+ *
+ *  @retval RTEMS_SUCCESSFUL At least one message was received.
+ *  @retval RTEMS_UNSATISFIED The queue is empty.
+ *  @retval RTEMS_TIMEOUT Timed out waiting for a message.
+ *  @retval RTEMS_OBJECT_WAS_DELETED The queue was deleted while waiting.
+ *  @retval RTEMS_INVALID_ADDRESS A pointer parameter is NULL.
+ *  @retval RTEMS_INVALID_NUMBER The maximum count is zero.
+ *  @retval RTEMS_INVALID_ID Invalid message queue id.
+ *  @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote queues.
+ *  @retval RTEMS_NOT_DEFINED Not supported for single producer single
+ *          consumer message queues.
+ */
+rtems_status_code rtems_message_queue_receive_many(
+  rtems_id        id,
+  void           *buffer,
+  size_t         *sizes,
+  uint32_t        max_count,
+  uint32_t       *count,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+
 /**@}*/
 
 #ifdef __cplusplus
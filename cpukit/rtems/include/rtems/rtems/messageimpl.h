@@ -17,7 +17,10 @@
 #define _RTEMS_RTEMS_MESSAGEIMPL_H
 
 #include <rtems/rtems/message.h>
+#include <rtems/rtems/attrimpl.h>
+#include <rtems/score/coremsgimpl.h>
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/threadimpl.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -152,6 +155,147 @@ RTEMS_INLINE_ROUTINE Message_queue_Control *_Message_queue_Get (
      _Objects_Get( &_Message_queue_Information, id, location );
 }
 
+/**
+ *  @brief Maps message queue IDs to message queue control blocks with
+ *  interrupts disabled.
+ *
+ *  In contrast to _Message_queue_Get() thread dispatching is not disabled.
+ *  In case location is OBJECTS_LOCAL, then interrupts are disabled and the
+ *  caller must restore the interrupt state via the lock context.
+ */
+RTEMS_INLINE_ROUTINE Message_queue_Control *
+_Message_queue_Get_interrupt_disable(
+  Objects_Id         id,
+  Objects_Locations *location,
+  ISR_lock_Context  *lock_context
+)
+{
+  return (Message_queue_Control *) _Objects_Get_local(
+    &_Message_queue_Information,
+    id,
+    location,
+    lock_context
+  );
+}
+
+/**
+ *  @brief Returns true if the_message_queue no longer is the message queue of
+ *  identifier id, otherwise false.
+ *
+ *  The message queue is closed by rtems_message_queue_delete() under
+ *  protection of the Giant lock and the thread queue lock.  The Giant lock or
+ *  the thread queue lock must be acquired.
+ */
+RTEMS_INLINE_ROUTINE bool _Message_queue_Is_deleted(
+  const Message_queue_Control *the_message_queue,
+  Objects_Id                   id
+)
+{
+  return the_message_queue->Object.id != id
+    || _Objects_Get_local_object(
+      &_Message_queue_Information,
+      _Objects_Get_index( id )
+    ) != &the_message_queue->Object;
+}
+
+/**
+ *  @brief Maps message queue IDs to message queue control blocks for the
+ *  send and receive directives.
+ *
+ *  The message queue is looked up once with interrupts disabled and
+ *  validated under protection of its thread queue lock.
+ *
+ *  In case location is OBJECTS_LOCAL and the message queue is a single
+ *  producer single consumer message queue, then the transfer operation is
+ *  registered via _CORE_message_queue_SPSC_Enter_critical() and interrupts
+ *  are enabled.  The caller must unregister the operation via
+ *  _CORE_message_queue_SPSC_Leave().
+ *
+ *  In case location is OBJECTS_LOCAL and the message queue is another
+ *  message queue, then thread dispatching is disabled and the caller must
+ *  enable it via _Objects_Put().
+ */
+RTEMS_INLINE_ROUTINE Message_queue_Control *_Message_queue_Get_for_transfer(
+  Objects_Id         id,
+  Objects_Locations *location
+)
+{
+  Message_queue_Control *the_message_queue;
+  ISR_lock_Context       lock_context;
+
+  the_message_queue = _Message_queue_Get_interrupt_disable(
+    id,
+    location,
+    &lock_context
+  );
+
+  if ( *location != OBJECTS_LOCAL ) {
+    return the_message_queue;
+  }
+
+  _Thread_queue_Acquire_critical(
+    &the_message_queue->message_queue.Wait_queue,
+    &lock_context
+  );
+
+  if ( _Message_queue_Is_deleted( the_message_queue, id ) ) {
+    _Thread_queue_Release(
+      &the_message_queue->message_queue.Wait_queue,
+      &lock_context
+    );
+    *location = OBJECTS_ERROR;
+    return NULL;
+  }
+
+  if (
+    _Attributes_Is_single_producer_single_consumer(
+      the_message_queue->attribute_set
+    )
+  ) {
+    bool entered;
+
+    entered = _CORE_message_queue_SPSC_Enter_critical(
+      &the_message_queue->message_queue
+    );
+    _Thread_queue_Release(
+      &the_message_queue->message_queue.Wait_queue,
+      &lock_context
+    );
+
+    if ( !entered ) {
+      *location = OBJECTS_ERROR;
+      the_message_queue = NULL;
+    }
+
+    return the_message_queue;
+  }
+
+  _Thread_queue_Release_critical(
+    &the_message_queue->message_queue.Wait_queue,
+    &lock_context
+  );
+  _Thread_Disable_dispatch();
+  _ISR_lock_ISR_enable( &lock_context );
+
+  /*
+   *  The message queue may be deleted and a single producer single consumer
+   *  message queue with the same identifier may be created in the meantime.
+   *  The Giant lock protects it against a concurrent deletion from now on.
+   */
+  if (
+    _Message_queue_Is_deleted( the_message_queue, id )
+      || _Attributes_Is_single_producer_single_consumer(
+        the_message_queue->attribute_set
+      )
+  ) {
+    _Objects_Put( &the_message_queue->Object );
+    *location = OBJECTS_ERROR;
+    the_message_queue = NULL;
+  }
+
+  return the_message_queue;
+}
+
 RTEMS_INLINE_ROUTINE Message_queue_Control *_Message_queue_Allocate( void )
 {
   return (Message_queue_Control *)
@@ -34,6 +34,7 @@
 #include <rtems/rtems/attr.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/types.h>
+#include <rtems/score/isrlock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,19 @@ extern "C" {
  */
 /**@{*/
 
+/**
+ *  The following defines a per-processor cache of free buffers of a
+ *  partition.
+ */
+typedef struct {
+  /** This field protects the cache against the flush during deletion. */
+  ISR_lock_Control    Lock;
+  /** This field is the chain of free buffers in the cache. */
+  Chain_Control       Buffers;
+  /** This field is the count of free buffers in the cache. */
+  uint32_t            count;
+}   Partition_Cache;
+
 /**
  *  The following defines the control block used to manage each partition.
  */
@@ -63,12 +77,32 @@ typedef struct {
   uint32_t            buffer_size;
   /** This field is the attribute set provided at create time. */
   rtems_attribute     attribute_set;
-  /** This field is the of allocated buffers. */
+  /**
+   * This field is the of allocated buffers.  Free buffers in the
+   * per-processor caches are counted as allocated.
+   */
   uint32_t            number_of_used_blocks;
   /** This field is the chain used to manage unallocated buffers. */
   Chain_Control       Memory;
+  /**
+   * This field protects the chain of unallocated buffers and the count of
+   * allocated buffers.
+   */
+  ISR_lock_Control    Lock;
+  /**
+   * This field is the table of per-processor buffer caches indexed by the
+   * processor index.  It is NULL in case the caches are disabled.
+   */
+  Partition_Cache    *caches;
 }   Partition_Control;
 
+/**
+ *  The following is the maximum count of free buffers in each per-processor
+ *  cache of a partition.  A value of zero disables the caches.  It is
+ *  defined by <rtems/confdefs.h> via CONFIGURE_PARTITION_CACHE_BUFFERS.
+ */
+extern const uint32_t rtems_partition_cache_buffers;
+
 /**
  *  @brief RTEMS Partition Create
  *
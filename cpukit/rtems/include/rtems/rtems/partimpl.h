@@ -63,28 +63,160 @@ void _Partition_Manager_initialization(void);
  *
  *  This function attempts to allocate a buffer from the_partition.
  *  If successful, it returns the address of the allocated buffer.
- *  Otherwise, it returns NULL.
+ *  Otherwise, it returns NULL.  The partition lock must be acquired.
  */
 RTEMS_INLINE_ROUTINE void *_Partition_Allocate_buffer (
    Partition_Control *the_partition
 )
 {
-  return _Chain_Get( &the_partition->Memory );
+  return _Chain_Get_unprotected( &the_partition->Memory );
 }
 
 /**
  *  @brief Frees the_buffer to the_partition.
  *
- *  This routine frees the_buffer to the_partition.
+ *  This routine frees the_buffer to the_partition.  The partition lock must
+ *  be acquired.
  */
 RTEMS_INLINE_ROUTINE void _Partition_Free_buffer (
   Partition_Control *the_partition,
   Chain_Node        *the_buffer
 )
 {
-  _Chain_Append( &the_partition->Memory, the_buffer );
+  _Chain_Append_unprotected( &the_partition->Memory, the_buffer );
 }
 
+/**
+ *  @brief Acquires the lock of the_partition.
+ *
+ *  Interrupts must be disabled, for example by
+ *  _Partition_Get_interrupt_disable().
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Acquire_critical(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  _ISR_lock_Acquire( &the_partition->Lock, lock_context );
+}
+
+/**
+ *  @brief Releases the lock of the_partition and restores the interrupt
+ *  state.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Release(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &the_partition->Lock, lock_context );
+}
+
+/**
+ *  @brief Returns true if the per-processor buffer caches of the_partition
+ *  are enabled, otherwise false.
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Has_caches(
+  const Partition_Control *the_partition
+)
+{
+  return the_partition->caches != NULL;
+}
+
+/**
+ *  @brief Returns true if the_partition no longer is the partition of
+ *  identifier id, otherwise false.
+ *
+ *  The partition lock or a cache lock of the_partition must be acquired.
+ *  The partition is closed under protection of the partition lock by
+ *  rtems_partition_delete() after the caches were flushed under protection
+ *  of the cache locks.  It is opened under protection of the partition lock
+ *  by rtems_partition_create().
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Is_deleted(
+  const Partition_Control *the_partition,
+  Objects_Id               id
+)
+{
+  return the_partition->Object.id != id
+    || _Objects_Get_local_object(
+      &_Partition_Information,
+      _Objects_Get_index( id )
+    ) != &the_partition->Object;
+}
+
+/**
+ *  @brief Initializes the locks of the inactive partition control blocks.
+ *
+ *  The lock of a partition control block is initialized once.  It stays
+ *  initialized across the deletion and creation of partitions using this
+ *  control block, since a get or return buffer directive may acquire the
+ *  lock after the look up of a concurrently deleted partition.
+ */
+void _Partition_Initialize_locks( void );
+
+/**
+ *  @brief Allocates the per-processor buffer caches of all partitions.
+ *
+ *  The caches are only allocated if rtems_partition_cache_buffers is
+ *  positive.  They are never freed, so that they stay valid for the
+ *  lifetime of the partition objects.
+ *
+ *  @param[in] maximum is the count of partition objects which have caches.
+ */
+void _Partition_Cache_Initialize_table( Objects_Maximum maximum );
+
+/**
+ *  @brief Assigns the per-processor buffer caches to the_partition.
+ *
+ *  Partitions of objects allocated beyond the initial maximum in unlimited
+ *  allocation mode have no caches.
+ */
+void _Partition_Cache_initialize( Partition_Control *the_partition );
+
+/**
+ *  @brief Gets a buffer from the cache of the current processor.
+ *
+ *  The cache is refilled with a batch of buffers from the partition in
+ *  case it is empty.  Interrupts must be disabled via the lock context.
+ *  They are restored before this function returns.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_UNSATISFIED No buffer is available.
+ *  @retval RTEMS_INVALID_ID The partition was deleted after its look up.
+ */
+rtems_status_code _Partition_Cache_get(
+  Partition_Control  *the_partition,
+  Objects_Id          id,
+  void              **the_buffer,
+  ISR_lock_Context   *lock_context
+);
+
+/**
+ *  @brief Puts a buffer to the cache of the current processor.
+ *
+ *  A batch of buffers is returned to the partition in case the cache is
+ *  full.  Interrupts must be disabled via the lock context.  They are
+ *  restored before this function returns.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The buffer is not a buffer of the partition.
+ *  @retval RTEMS_INVALID_ID The partition was deleted after its look up.
+ */
+rtems_status_code _Partition_Cache_put(
+  Partition_Control *the_partition,
+  Objects_Id         id,
+  Chain_Node        *the_buffer,
+  ISR_lock_Context  *lock_context
+);
+
+/**
+ *  @brief Returns the free buffers of all caches to the_partition.
+ *
+ *  Interrupts must be disabled.
+ */
+void _Partition_Cache_flush( Partition_Control *the_partition );
+
 /**
  *  @brief Checks whether is on a valid buffer boundary for the_partition.
  *
@@ -152,7 +284,23 @@ RTEMS_INLINE_ROUTINE bool _Partition_Is_buffer_size_aligned (
  */
 RTEMS_INLINE_ROUTINE Partition_Control *_Partition_Allocate ( void )
 {
-  return (Partition_Control *) _Objects_Allocate( &_Partition_Information );
+  bool               extend;
+  Partition_Control *the_partition;
+
+  /*
+   *  The control blocks of an extension of the object information need an
+   *  initialized lock.  All other inactive control blocks have one.
+   */
+  extend = _Chain_Is_empty( &_Partition_Information.Inactive );
+  the_partition =
+    (Partition_Control *) _Objects_Allocate( &_Partition_Information );
+
+  if ( extend && the_partition != NULL ) {
+    _ISR_lock_Initialize( &the_partition->Lock, "Partition" );
+    _Partition_Initialize_locks();
+  }
+
+  return the_partition;
 }
 
 /**
@@ -189,6 +337,29 @@ RTEMS_INLINE_ROUTINE Partition_Control *_Partition_Get (
     _Objects_Get( &_Partition_Information, id, location );
 }
 
+/**
+ *  @brief Maps partition IDs to partition control blocks with interrupts
+ *  disabled.
+ *
+ *  In contrast to _Partition_Get() thread dispatching is not disabled, so
+ *  that the Giant lock is not acquired on SMP configurations.  In case the
+ *  location is OBJECTS_LOCAL, then interrupts are disabled and the interrupt
+ *  state is stored in lock_context.
+ */
+RTEMS_INLINE_ROUTINE Partition_Control *_Partition_Get_interrupt_disable(
+  Objects_Id         id,
+  Objects_Locations *location,
+  ISR_lock_Context  *lock_context
+)
+{
+  return (Partition_Control *) _Objects_Get_local(
+    &_Partition_Information,
+    id,
+    location,
+    lock_context
+  );
+}
+
 /**
  *  @brief Checks if the_partition is NULL.
  *
@@ -186,15 +186,44 @@ RTEMS_INLINE_ROUTINE Semaphore_Control *_Semaphore_Get (
  *  resides on a remote node, then location is set to OBJECTS_REMOTE,
  *  and the_semaphore is undefined.  Otherwise, location is set
  *  to OBJECTS_ERROR and the_semaphore is undefined.
+ *
+ *  For local semaphores interrupts are disabled, but thread dispatching is
+ *  not, so on SMP configurations the Giant lock is not acquired.  The
+ *  semaphore state is protected by the lock of its thread queue.  The
+ *  semaphore may be deleted after its look up, see _Semaphore_Is_deleted().
  */
 RTEMS_INLINE_ROUTINE Semaphore_Control *_Semaphore_Get_interrupt_disable (
   Objects_Id         id,
   Objects_Locations *location,
-  ISR_Level         *level
+  ISR_lock_Context  *lock_context
 )
 {
-  return (Semaphore_Control *)
-    _Objects_Get_isr_disable( &_Semaphore_Information, id, location, level );
+  return (Semaphore_Control *) _Objects_Get_local(
+    &_Semaphore_Information,
+    id,
+    location,
+    lock_context
+  );
+}
+
+/**
+ *  @brief Returns true if the_semaphore no longer is the semaphore of
+ *  identifier id, otherwise false.
+ *
+ *  The semaphore is closed by rtems_semaphore_delete() under protection of
+ *  the Giant lock and, in case it has a thread queue, the thread queue lock.
+ *  The Giant lock or the thread queue lock must be acquired.
+ */
+RTEMS_INLINE_ROUTINE bool _Semaphore_Is_deleted(
+  const Semaphore_Control *the_semaphore,
+  Objects_Id               id
+)
+{
+  return the_semaphore->Object.id != id
+    || _Objects_Get_local_object(
+      &_Semaphore_Information,
+      _Objects_Get_index( id )
+    ) != &the_semaphore->Object;
 }
 
 #ifdef __cplusplus
@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <rtems/rtems/status.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +70,51 @@ uint32_t rtems_get_processor_count(void);
  */
 uint32_t rtems_get_current_processor(void);
 
+/**
+ * @brief Inter-processor interrupt statistics of a processor.
+ *
+ * All counters may overflow.
+ *
+ * @see rtems_get_processor_ipi_statistics().
+ */
+typedef struct {
+  /**
+   * @brief Count of thread dispatch requests and SMP messages posted by this
+   * processor to other processors.
+   */
+  uint32_t request_count;
+
+  /**
+   * @brief Count of inter-processor interrupts sent by this processor.
+   *
+   * Requests to a processor with an outstanding inter-processor interrupt are
+   * batched, so this count is less than or equal to the request count.
+   */
+  uint32_t send_count;
+
+  /**
+   * @brief Count of inter-processor interrupts received by this processor.
+   */
+  uint32_t receive_count;
+} rtems_processor_ipi_statistics;
+
+/**
+ * @brief Returns the inter-processor interrupt statistics of a processor.
+ *
+ * On uni-processor configurations all counters are zero.
+ *
+ * @param[in] cpu_index The index of the processor.
+ * @param[out] statistics The inter-processor interrupt statistics.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The statistics pointer is @c NULL.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor index.
+ */
+rtems_status_code rtems_get_processor_ipi_statistics(
+  uint32_t                        cpu_index,
+  rtems_processor_ipi_statistics *statistics
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -28,17 +28,25 @@ rtems_status_code rtems_clock_tick( void )
 {
 #if defined( RTEMS_SMP )
   _Thread_Disable_dispatch();
-#endif
 
   _TOD_Tickle_ticks();
 
-  _Watchdog_Tickle_ticks();
-
   _Scheduler_Tick();
 
-#if defined( RTEMS_SMP )
   _Thread_Enable_dispatch();
+
+  /*
+   * The ticks based watchdogs of each processor have their own lock, so
+   * they are processed without the Giant lock.
+   */
+  _Watchdog_Tickle_ticks();
 #else
+  _TOD_Tickle_ticks();
+
+  _Watchdog_Tickle_ticks();
+
+  _Scheduler_Tick();
+
   if ( _Thread_Is_context_switch_necessary() &&
        _Thread_Dispatch_is_enabled() )
     _Thread_Dispatch();
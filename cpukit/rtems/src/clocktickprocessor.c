@@ -0,0 +1,44 @@
+/**
+ *  @file
+ *
+ *  @brief Announce a Clock Tick to the Executing Processor
+ *  @ingroup ClassicClock
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/clock.h>
+#include <rtems/score/watchdogimpl.h>
+
+rtems_status_code rtems_clock_tick_processor( void )
+{
+#if defined( RTEMS_SMP )
+  Watchdog_Ticks_control *ticks;
+  ISR_Level               level;
+
+  _ISR_Disable_without_giant( level );
+  ticks = _Per_CPU_Get()->Watchdog_ticks;
+  _ISR_Enable_without_giant( level );
+
+  /*
+   * From now on rtems_clock_tick() leaves the watchdogs of this processor
+   * alone.
+   */
+  ticks->local_tick = true;
+
+  _Watchdog_Ticks_tickle( ticks );
+#endif
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file
+ *
+ * @brief Get Inter-Processor Interrupt Statistics of a Processor
+ *
+ * @ingroup ClassicSMP
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/rtems/smp.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smp.h>
+
+#include <stddef.h>
+
+rtems_status_code rtems_get_processor_ipi_statistics(
+  uint32_t                        cpu_index,
+  rtems_processor_ipi_statistics *statistics
+)
+{
+#if defined(RTEMS_SMP)
+  const Per_CPU_Control *cpu;
+#endif
+
+  if ( statistics == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cpu_index >= _SMP_Get_processor_count() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+#if defined(RTEMS_SMP)
+  cpu = _Per_CPU_Get_by_index( cpu_index );
+
+  statistics->request_count = _Atomic_Load_uint(
+    &cpu->Stats.ipi_request_count,
+    ATOMIC_ORDER_RELAXED
+  );
+  statistics->send_count = _Atomic_Load_uint(
+    &cpu->Stats.ipi_send_count,
+    ATOMIC_ORDER_RELAXED
+  );
+  statistics->receive_count = _Atomic_Load_uint(
+    &cpu->Stats.ipi_receive_count,
+    ATOMIC_ORDER_RELAXED
+  );
+#else
+  statistics->request_count = 0;
+  statistics->send_count = 0;
+  statistics->receive_count = 0;
+#endif
+
+  return RTEMS_SUCCESSFUL;
+}
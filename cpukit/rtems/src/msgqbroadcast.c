@@ -51,6 +51,15 @@ rtems_status_code rtems_message_queue_broadcast(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        _Objects_Put( &the_message_queue->Object );
+        return RTEMS_NOT_DEFINED;
+      }
+
       core_status = _CORE_message_queue_Broadcast(
                       &the_message_queue->message_queue,
                       buffer,
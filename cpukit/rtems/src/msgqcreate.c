@@ -23,7 +23,7 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/coremsgimpl.h>
-#include <rtems/score/thread.h>
+#include <rtems/score/threadimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/attrimpl.h>
@@ -41,6 +41,7 @@ rtems_status_code rtems_message_queue_create(
 {
   Message_queue_Control          *the_message_queue;
   CORE_message_queue_Attributes   the_msgq_attributes;
+  ISR_lock_Context                lock_context;
 #if defined(RTEMS_MULTIPROCESSING)
   bool                            is_global;
 #endif
@@ -57,6 +58,12 @@ rtems_status_code rtems_message_queue_create(
     return RTEMS_MP_NOT_CONFIGURED;
 #endif
 
+#if defined(RTEMS_MULTIPROCESSING)
+  if ( is_global &&
+       _Attributes_Is_single_producer_single_consumer( attribute_set ) )
+    return RTEMS_NOT_DEFINED;
+#endif
+
   if ( count == 0 )
       return RTEMS_INVALID_NUMBER;
 
@@ -105,6 +112,9 @@ rtems_status_code rtems_message_queue_create(
   else
     the_msgq_attributes.discipline = CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO;
 
+  the_msgq_attributes.single_producer_single_consumer =
+    _Attributes_Is_single_producer_single_consumer( attribute_set );
+
   if ( ! _CORE_message_queue_Initialize(
            &the_message_queue->message_queue,
            &the_msgq_attributes,
@@ -122,11 +132,23 @@ rtems_status_code rtems_message_queue_create(
     return RTEMS_UNSATISFIED;
   }
 
+  /*
+   *  The send and receive directives validate the message queue under
+   *  protection of its thread queue lock.
+   */
+  _Thread_queue_Acquire(
+    &the_message_queue->message_queue.Wait_queue,
+    &lock_context
+  );
   _Objects_Open(
     &_Message_queue_Information,
     &the_message_queue->Object,
     (Objects_Name) name
   );
+  _Thread_queue_Release(
+    &the_message_queue->message_queue.Wait_queue,
+    &lock_context
+  );
 
   *id = the_message_queue->Object.id;
 
@@ -22,13 +22,14 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/coremsgimpl.h>
-#include <rtems/score/thread.h>
+#include <rtems/score/threadimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/attrimpl.h>
 #include <rtems/rtems/messageimpl.h>
 #include <rtems/rtems/options.h>
 #include <rtems/rtems/support.h>
+#include <rtems/rtems/tasks.h>
 
 rtems_status_code rtems_message_queue_delete(
   rtems_id id
@@ -36,15 +37,65 @@ rtems_status_code rtems_message_queue_delete(
 {
   Message_queue_Control          *the_message_queue;
   Objects_Locations               location;
+  ISR_lock_Context                lock_context;
+  bool                            is_spsc;
 
   _Objects_Allocator_lock();
   the_message_queue = _Message_queue_Get( id, &location );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      /*
+       *  The send and receive directives look up and validate the message
+       *  queue under protection of the thread queue lock, so we have to
+       *  close it under this lock as well.
+       */
+      _Thread_queue_Acquire(
+        &the_message_queue->message_queue.Wait_queue,
+        &lock_context
+      );
       _Objects_Close( &_Message_queue_Information,
                       &the_message_queue->Object );
 
+      is_spsc = _Attributes_Is_single_producer_single_consumer(
+        the_message_queue->attribute_set
+      );
+      if ( is_spsc ) {
+        _CORE_message_queue_SPSC_Close_critical(
+          &the_message_queue->message_queue
+        );
+      }
+
+      _Thread_queue_Release(
+        &the_message_queue->message_queue.Wait_queue,
+        &lock_context
+      );
+
+      if ( is_spsc ) {
+        /*
+         *  Transfer operations on single producer single consumer message
+         *  queues do not use the Giant lock.  Unblock a waiting consumer and
+         *  wait for the end of all registered operations before the message
+         *  buffers are freed.
+         */
+        _Thread_queue_Flush(
+          &the_message_queue->message_queue.Wait_queue,
+          NULL,
+          CORE_MESSAGE_QUEUE_STATUS_WAS_DELETED
+        );
+        _Objects_Put( &the_message_queue->Object );
+
+        while (
+          _CORE_message_queue_SPSC_Has_users(
+            &the_message_queue->message_queue
+          )
+        ) {
+          (void) rtems_task_wake_after( 1 );
+        }
+
+        _Thread_Disable_dispatch();
+      }
+
       _CORE_message_queue_Close(
         &the_message_queue->message_queue,
         #if defined(RTEMS_MULTIPROCESSING)
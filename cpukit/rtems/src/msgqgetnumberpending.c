@@ -60,7 +60,9 @@ rtems_status_code rtems_message_queue_get_number_pending(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      *count = the_message_queue->message_queue.number_of_pending_messages;
+      *count = _CORE_message_queue_Get_number_of_pending_messages(
+        &the_message_queue->message_queue
+      );
       _Objects_Put( &the_message_queue->Object );
       return RTEMS_SUCCESSFUL;
 
@@ -0,0 +1,72 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_obtain_buffer
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/rtems/attrimpl.h>
+#include <rtems/rtems/messageimpl.h>
+
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id   id,
+  void     **buffer
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Objects_Locations                  location;
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        _Objects_Put( &the_message_queue->Object );
+        return RTEMS_NOT_DEFINED;
+      }
+
+      the_message = _CORE_message_queue_Obtain_buffer(
+        &the_message_queue->message_queue
+      );
+      _Objects_Put( &the_message_queue->Object );
+
+      if ( the_message == NULL )
+        return RTEMS_TOO_MANY;
+
+      *buffer = the_message->Contents.buffer;
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
@@ -22,7 +22,7 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/coremsgimpl.h>
-#include <rtems/score/thread.h>
+#include <rtems/score/threadimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/attrimpl.h>
@@ -49,7 +49,7 @@ rtems_status_code rtems_message_queue_receive(
   if ( !size )
     return RTEMS_INVALID_ADDRESS;
 
-  the_message_queue = _Message_queue_Get( id, &location );
+  the_message_queue = _Message_queue_Get_for_transfer( id, &location );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
@@ -58,17 +58,34 @@ rtems_status_code rtems_message_queue_receive(
       else
         wait = true;
 
-      executing = _Thread_Executing;
-      _CORE_message_queue_Seize(
-        &the_message_queue->message_queue,
-        executing,
-        the_message_queue->Object.id,
-        buffer,
-        size,
-        wait,
-        timeout
-      );
-      _Objects_Put( &the_message_queue->Object );
+      executing = _Thread_Get_executing();
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        _CORE_message_queue_SPSC_Seize(
+          &the_message_queue->message_queue,
+          executing,
+          the_message_queue->Object.id,
+          buffer,
+          size,
+          wait,
+          timeout
+        );
+        _CORE_message_queue_SPSC_Leave( &the_message_queue->message_queue );
+      } else {
+        _CORE_message_queue_Seize(
+          &the_message_queue->message_queue,
+          executing,
+          the_message_queue->Object.id,
+          buffer,
+          size,
+          wait,
+          timeout
+        );
+        _Objects_Put( &the_message_queue->Object );
+      }
       return _Message_queue_Translate_core_message_queue_return_code(
         executing->Wait.return_code
       );
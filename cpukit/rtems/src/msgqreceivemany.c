@@ -0,0 +1,100 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_receive_many
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/rtems/attrimpl.h>
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/optionsimpl.h>
+
+rtems_status_code rtems_message_queue_receive_many(
+  rtems_id        id,
+  void           *buffer,
+  size_t         *sizes,
+  uint32_t        max_count,
+  uint32_t       *count,
+  rtems_option    option_set,
+  rtems_interval  timeout
+)
+{
+  Message_queue_Control *the_message_queue;
+  Objects_Locations      location;
+  Thread_Control        *executing;
+  rtems_status_code      sc;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !sizes )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !count )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( max_count == 0 )
+    return RTEMS_INVALID_NUMBER;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        _Objects_Put( &the_message_queue->Object );
+        return RTEMS_NOT_DEFINED;
+      }
+
+      executing = _Thread_Executing;
+      _CORE_message_queue_Seize_many(
+        &the_message_queue->message_queue,
+        executing,
+        the_message_queue->Object.id,
+        buffer,
+        sizes,
+        max_count,
+        count,
+        !_Options_Is_no_wait( option_set ),
+        timeout
+      );
+      _Objects_Put( &the_message_queue->Object );
+
+      sc = _Message_queue_Translate_core_message_queue_return_code(
+        executing->Wait.return_code
+      );
+      if ( sc != RTEMS_SUCCESSFUL ) {
+        *count = 0;
+      }
+
+      return sc;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
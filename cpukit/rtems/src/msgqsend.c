@@ -22,7 +22,7 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/coremsgimpl.h>
-#include <rtems/score/thread.h>
+#include <rtems/score/threadimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/rtems/status.h>
 #include <rtems/rtems/attrimpl.h>
@@ -66,21 +66,33 @@ rtems_status_code rtems_message_queue_send(
   if ( !buffer )
     return RTEMS_INVALID_ADDRESS;
 
-  the_message_queue = _Message_queue_Get( id, &location );
+  the_message_queue = _Message_queue_Get_for_transfer( id, &location );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      status = _CORE_message_queue_Send(
-        &the_message_queue->message_queue,
-        buffer,
-        size,
-        id,
-        MESSAGE_QUEUE_MP_HANDLER,
-        false,   /* sender does not block */
-        0        /* no timeout */
-      );
-
-      _Objects_Put( &the_message_queue->Object );
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        status = _CORE_message_queue_SPSC_Submit(
+          &the_message_queue->message_queue,
+          buffer,
+          size
+        );
+        _CORE_message_queue_SPSC_Leave( &the_message_queue->message_queue );
+      } else {
+        status = _CORE_message_queue_Send(
+          &the_message_queue->message_queue,
+          buffer,
+          size,
+          id,
+          MESSAGE_QUEUE_MP_HANDLER,
+          false,   /* sender does not block */
+          0        /* no timeout */
+        );
+        _Objects_Put( &the_message_queue->Object );
+      }
 
       /*
        *  Since this API does not allow for blocking sends, we can directly
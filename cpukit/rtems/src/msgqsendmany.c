@@ -0,0 +1,93 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_send_many
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/rtems/attrimpl.h>
+#include <rtems/rtems/messageimpl.h>
+
+#if defined(RTEMS_MULTIPROCESSING)
+#define MESSAGE_QUEUE_MP_HANDLER _Message_queue_Core_message_queue_mp_support
+#else
+#define MESSAGE_QUEUE_MP_HANDLER NULL
+#endif
+
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+)
+{
+  Message_queue_Control     *the_message_queue;
+  Objects_Locations          location;
+  CORE_message_queue_Status  status;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !sizes )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !sent )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( count == 0 )
+    return RTEMS_INVALID_NUMBER;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if (
+        _Attributes_Is_single_producer_single_consumer(
+          the_message_queue->attribute_set
+        )
+      ) {
+        _Objects_Put( &the_message_queue->Object );
+        return RTEMS_NOT_DEFINED;
+      }
+
+      status = _CORE_message_queue_Submit_many(
+        &the_message_queue->message_queue,
+        buffer,
+        sizes,
+        count,
+        sent,
+        id,
+        MESSAGE_QUEUE_MP_HANDLER,
+        CORE_MESSAGE_QUEUE_SEND_REQUEST
+      );
+      _Objects_Put( &the_message_queue->Object );
+
+      return _Message_queue_Translate_core_message_queue_return_code(status);
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
@@ -26,6 +26,19 @@
 #include <rtems/rtems/partimpl.h>
 #include <rtems/score/thread.h>
 
+void _Partition_Initialize_locks( void )
+{
+  Chain_Control *inactive = &_Partition_Information.Inactive;
+  Chain_Node    *node = _Chain_First( inactive );
+
+  while ( node != _Chain_Immutable_tail( inactive ) ) {
+    Partition_Control *the_partition = (Partition_Control *) node;
+
+    _ISR_lock_Initialize( &the_partition->Lock, "Partition" );
+    node = _Chain_Next( node );
+  }
+}
+
 void _Partition_Manager_initialization(void)
 {
   _Objects_Initialize_information(
@@ -44,6 +57,9 @@ void _Partition_Manager_initialization(void)
 #endif
   );
 
+  _Partition_Initialize_locks();
+  _Partition_Cache_Initialize_table( _Partition_Information.maximum );
+
   /*
    *  Register the MP Process Packet routine.
    */
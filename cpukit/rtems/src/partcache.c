@@ -0,0 +1,242 @@
+/**
+ * @file
+ *
+ * @brief Partition Per-Processor Buffer Caches
+ * @ingroup ClassicPart
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/partimpl.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/wkspace.h>
+#include <rtems/config.h>
+
+/*
+ *  The caches of all partitions which exist at system initialization time
+ *  are allocated once and are never freed.  A get or return buffer directive
+ *  may use the caches of a partition which is concurrently deleted, so the
+ *  caches must stay valid for the lifetime of the partition object.
+ */
+static Partition_Cache *_Partition_Cache_table;
+
+static Objects_Maximum _Partition_Cache_objects;
+
+/*
+ *  The buffers move in batches of half the cache size between the caches
+ *  and the partition, so that a processor which alternately gets and
+ *  returns buffers does not touch the partition lock each time.
+ */
+static uint32_t _Partition_Cache_batch_size( void )
+{
+  return ( rtems_partition_cache_buffers + 1 ) / 2;
+}
+
+static Partition_Cache *_Partition_Cache_acquire(
+  Partition_Control *the_partition,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Cache *cache;
+
+  cache = &the_partition->caches[ _SMP_Get_current_processor() ];
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+/*
+ *  The caller must hold the cache lock.
+ */
+static void _Partition_Cache_to_partition(
+  Partition_Control *the_partition,
+  Partition_Cache   *cache,
+  uint32_t           count
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t         i;
+
+  _Partition_Acquire_critical( the_partition, &lock_context );
+
+  for ( i = 0 ; i < count ; ++i ) {
+    _Partition_Free_buffer(
+      the_partition,
+      _Chain_Get_first_unprotected( &cache->Buffers )
+    );
+  }
+
+  the_partition->number_of_used_blocks -= count;
+
+  _ISR_lock_Release( &the_partition->Lock, &lock_context );
+
+  cache->count -= count;
+}
+
+void _Partition_Cache_Initialize_table( Objects_Maximum maximum )
+{
+  uint32_t cache_count = rtems_configuration_get_maximum_processors();
+  uint32_t n = maximum * cache_count;
+  uint32_t i;
+
+  if ( rtems_partition_cache_buffers == 0 || maximum == 0 ) {
+    return;
+  }
+
+  _Partition_Cache_table =
+    _Workspace_Allocate_or_fatal_error( n * sizeof( *_Partition_Cache_table ) );
+
+  for ( i = 0 ; i < n ; ++i ) {
+    Partition_Cache *cache = &_Partition_Cache_table[ i ];
+
+    _ISR_lock_Initialize( &cache->Lock, "Partition Cache" );
+    _Chain_Initialize_empty( &cache->Buffers );
+    cache->count = 0;
+  }
+
+  _Partition_Cache_objects = maximum;
+}
+
+void _Partition_Cache_initialize( Partition_Control *the_partition )
+{
+  Objects_Maximum index = _Objects_Get_index( the_partition->Object.id );
+
+  if ( index <= _Partition_Cache_objects ) {
+    the_partition->caches = &_Partition_Cache_table[
+      ( index - 1 ) * rtems_configuration_get_maximum_processors()
+    ];
+  } else {
+    the_partition->caches = NULL;
+  }
+}
+
+rtems_status_code _Partition_Cache_get(
+  Partition_Control  *the_partition,
+  Objects_Id          id,
+  void              **the_buffer,
+  ISR_lock_Context   *lock_context
+)
+{
+  Partition_Cache   *cache;
+  rtems_status_code  status = RTEMS_SUCCESSFUL;
+
+  cache = _Partition_Cache_acquire( the_partition, lock_context );
+
+  /*
+   *  The partition may be deleted after its look up.  A buffer of the cache
+   *  must not be handed out in this case.
+   */
+  if ( _Partition_Is_deleted( the_partition, id ) ) {
+    *the_buffer = NULL;
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+    return RTEMS_INVALID_ID;
+  }
+
+  *the_buffer = _Chain_Get_unprotected( &cache->Buffers );
+
+  if ( *the_buffer != NULL ) {
+    --cache->count;
+  } else {
+    ISR_lock_Context partition_lock_context;
+    uint32_t         n = _Partition_Cache_batch_size();
+
+    _Partition_Acquire_critical( the_partition, &partition_lock_context );
+
+    if ( _Partition_Is_deleted( the_partition, id ) ) {
+      status = RTEMS_INVALID_ID;
+    } else {
+      *the_buffer = _Partition_Allocate_buffer( the_partition );
+    }
+
+    if ( *the_buffer != NULL ) {
+      ++the_partition->number_of_used_blocks;
+
+      while ( --n > 0 ) {
+        Chain_Node *node = _Partition_Allocate_buffer( the_partition );
+
+        if ( node == NULL ) {
+          break;
+        }
+
+        ++the_partition->number_of_used_blocks;
+        _Chain_Prepend_unprotected( &cache->Buffers, node );
+        ++cache->count;
+      }
+    } else if ( status == RTEMS_SUCCESSFUL ) {
+      status = RTEMS_UNSATISFIED;
+    }
+
+    _ISR_lock_Release( &the_partition->Lock, &partition_lock_context );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+
+  return status;
+}
+
+rtems_status_code _Partition_Cache_put(
+  Partition_Control *the_partition,
+  Objects_Id         id,
+  Chain_Node        *the_buffer,
+  ISR_lock_Context  *lock_context
+)
+{
+  Partition_Cache *cache;
+
+  cache = _Partition_Cache_acquire( the_partition, lock_context );
+
+  if ( _Partition_Is_deleted( the_partition, id ) ) {
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+    return RTEMS_INVALID_ID;
+  }
+
+  if ( !_Partition_Is_buffer_valid( the_buffer, the_partition ) ) {
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( cache->count >= rtems_partition_cache_buffers ) {
+    _Partition_Cache_to_partition(
+      the_partition,
+      cache,
+      _Partition_Cache_batch_size()
+    );
+  }
+
+  _Chain_Prepend_unprotected( &cache->Buffers, the_buffer );
+  ++cache->count;
+
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void _Partition_Cache_flush( Partition_Control *the_partition )
+{
+  uint32_t cache_count = rtems_configuration_get_maximum_processors();
+  uint32_t i;
+
+  if ( the_partition->caches == NULL ) {
+    return;
+  }
+
+  for ( i = 0 ; i < cache_count ; ++i ) {
+    Partition_Cache  *cache = &the_partition->caches[ i ];
+    ISR_lock_Context  lock_context;
+
+    _ISR_lock_Acquire( &cache->Lock, &lock_context );
+    _Partition_Cache_to_partition( the_partition, cache, cache->count );
+    _ISR_lock_Release( &cache->Lock, &lock_context );
+  }
+}
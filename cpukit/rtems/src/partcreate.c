@@ -54,6 +54,7 @@ rtems_status_code rtems_partition_create(
 )
 {
   Partition_Control *the_partition;
+  ISR_lock_Context   lock_context;
 
   if ( !rtems_is_name_valid( name ) )
     return RTEMS_INVALID_NAME;
@@ -103,11 +104,19 @@ rtems_status_code rtems_partition_create(
   _Chain_Initialize( &the_partition->Memory, starting_address,
                         length / buffer_size, buffer_size );
 
+  _Partition_Cache_initialize( the_partition );
+
+  /*
+   *  The lock was initialized by _Partition_Allocate() and may be acquired by
+   *  a get or return buffer directive for a previously deleted partition.
+   */
+  _ISR_lock_ISR_disable_and_acquire( &the_partition->Lock, &lock_context );
   _Objects_Open(
     &_Partition_Information,
     &the_partition->Object,
     (Objects_Name) name
   );
+  _Partition_Release( the_partition, &lock_context );
 
   *id = the_partition->Object.id;
 #if defined(RTEMS_MULTIPROCESSING)
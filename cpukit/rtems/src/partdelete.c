@@ -26,16 +26,29 @@ rtems_status_code rtems_partition_delete(
   rtems_id id
 )
 {
-   Partition_Control           *the_partition;
+  Partition_Control           *the_partition;
   Objects_Locations           location;
+  ISR_lock_Context            lock_context;
 
   _Objects_Allocator_lock();
-  the_partition = _Partition_Get( id, &location );
+  the_partition = _Partition_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      _Partition_Cache_flush( the_partition );
+      /*
+       *  A concurrent get or return buffer directive checks under the
+       *  partition or cache lock that the partition is not closed.  The
+       *  caches and the partition lock stay valid after the deletion.
+       */
+      _Partition_Acquire_critical( the_partition, &lock_context );
       if ( the_partition->number_of_used_blocks == 0 ) {
         _Objects_Close( &_Partition_Information, &the_partition->Object );
+        _Partition_Release( the_partition, &lock_context );
 #if defined(RTEMS_MULTIPROCESSING)
         if ( _Attributes_Is_global( the_partition->attribute_set ) ) {
 
@@ -53,12 +66,11 @@ rtems_status_code rtems_partition_delete(
         }
 #endif
 
-        _Objects_Put( &the_partition->Object );
         _Partition_Free( the_partition );
         _Objects_Allocator_unlock();
         return RTEMS_SUCCESSFUL;
       }
-      _Objects_Put( &the_partition->Object );
+      _Partition_Release( the_partition, &lock_context );
       _Objects_Allocator_unlock();
       return RTEMS_RESOURCE_IN_USE;
 
@@ -30,26 +30,50 @@ rtems_status_code rtems_partition_get_buffer(
   void     **buffer
 )
 {
-   Partition_Control           *the_partition;
+  Partition_Control           *the_partition;
   Objects_Locations           location;
+  ISR_lock_Context            lock_context;
   void                       *the_buffer;
+  rtems_status_code           status;
 
   if ( !buffer )
     return RTEMS_INVALID_ADDRESS;
 
-  the_partition = _Partition_Get( id, &location );
+  the_partition = _Partition_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      the_buffer = _Partition_Allocate_buffer( the_partition );
-      if ( the_buffer ) {
-        the_partition->number_of_used_blocks += 1;
-        _Objects_Put( &the_partition->Object );
+      if ( _Partition_Has_caches( the_partition ) ) {
+        status = _Partition_Cache_get(
+          the_partition,
+          id,
+          &the_buffer,
+          &lock_context
+        );
+      } else {
+        _Partition_Acquire_critical( the_partition, &lock_context );
+        if ( _Partition_Is_deleted( the_partition, id ) ) {
+          the_buffer = NULL;
+          status = RTEMS_INVALID_ID;
+        } else {
+          the_buffer = _Partition_Allocate_buffer( the_partition );
+          if ( the_buffer ) {
+            the_partition->number_of_used_blocks += 1;
+            status = RTEMS_SUCCESSFUL;
+          } else {
+            status = RTEMS_UNSATISFIED;
+          }
+        }
+        _Partition_Release( the_partition, &lock_context );
+      }
+      if ( status == RTEMS_SUCCESSFUL ) {
         *buffer = the_buffer;
-        return RTEMS_SUCCESSFUL;
       }
-      _Objects_Put( &the_partition->Object );
-      return RTEMS_UNSATISFIED;
+      return status;
 
 #if defined(RTEMS_MULTIPROCESSING)
     case OBJECTS_REMOTE:
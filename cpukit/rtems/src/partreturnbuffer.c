@@ -41,21 +41,40 @@ rtems_status_code rtems_partition_return_buffer(
   void     *buffer
 )
 {
-   Partition_Control           *the_partition;
+  Partition_Control           *the_partition;
   Objects_Locations           location;
+  ISR_lock_Context            lock_context;
+  rtems_status_code           status;
 
-  the_partition = _Partition_Get( id, &location );
+  the_partition = _Partition_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      if ( _Partition_Is_buffer_valid( buffer, the_partition ) ) {
-        _Partition_Free_buffer( the_partition, buffer );
-        the_partition->number_of_used_blocks -= 1;
-        _Objects_Put( &the_partition->Object );
-        return RTEMS_SUCCESSFUL;
+      if ( _Partition_Has_caches( the_partition ) ) {
+        status = _Partition_Cache_put(
+          the_partition,
+          id,
+          buffer,
+          &lock_context
+        );
+      } else {
+        _Partition_Acquire_critical( the_partition, &lock_context );
+        if ( _Partition_Is_deleted( the_partition, id ) ) {
+          status = RTEMS_INVALID_ID;
+        } else if ( _Partition_Is_buffer_valid( buffer, the_partition ) ) {
+          _Partition_Free_buffer( the_partition, buffer );
+          the_partition->number_of_used_blocks -= 1;
+          status = RTEMS_SUCCESSFUL;
+        } else {
+          status = RTEMS_INVALID_ADDRESS;
+        }
+        _Partition_Release( the_partition, &lock_context );
       }
-      _Objects_Put( &the_partition->Object );
-      return RTEMS_INVALID_ADDRESS;
+      return status;
 
 #if defined(RTEMS_MULTIPROCESSING)
     case OBJECTS_REMOTE:
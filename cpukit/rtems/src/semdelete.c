@@ -43,48 +43,84 @@ rtems_status_code rtems_semaphore_delete(
 {
   Semaphore_Control          *the_semaphore;
   Objects_Locations           location;
+  ISR_lock_Context            lock_context;
   rtems_attribute             attribute_set;
 
   _Objects_Allocator_lock();
 
-  the_semaphore = _Semaphore_Get( id, &location );
+  the_semaphore = _Semaphore_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
       attribute_set = the_semaphore->attribute_set;
 #if defined(RTEMS_SMP)
       if ( _Attributes_Is_multiprocessor_resource_sharing( attribute_set ) ) {
-        MRSP_Status mrsp_status = _MRSP_Destroy(
-          &the_semaphore->Core_control.mrsp
-        );
+        MRSP_Status mrsp_status;
+
+        _Thread_Disable_dispatch();
+        _ISR_lock_ISR_enable( &lock_context );
+        mrsp_status = _MRSP_Destroy( &the_semaphore->Core_control.mrsp );
         if ( mrsp_status != MRSP_SUCCESSFUL ) {
-          _Objects_Put( &the_semaphore->Object );
+          _Thread_Enable_dispatch();
           _Objects_Allocator_unlock();
           return _Semaphore_Translate_MRSP_status_code( mrsp_status );
         }
+
+        _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
       } else
 #endif
-      if ( !_Attributes_Is_counting_semaphore( attribute_set ) ) {
-        if ( _CORE_mutex_Is_locked( &the_semaphore->Core_control.mutex ) &&
+      {
+        Thread_queue_Control *wait_queue;
+        bool                  is_mutex;
+
+        is_mutex = !_Attributes_Is_counting_semaphore( attribute_set );
+        if ( is_mutex ) {
+          wait_queue = &the_semaphore->Core_control.mutex.Wait_queue;
+        } else {
+          wait_queue = &the_semaphore->Core_control.semaphore.Wait_queue;
+        }
+
+        /*
+         *  The obtain and release directives may change the mutex state
+         *  without the Giant lock, so check it under protection of the thread
+         *  queue lock.  They check that the semaphore is not deleted under
+         *  protection of the Giant lock or the thread queue lock, so close
+         *  the object under protection of both.
+         */
+        _Thread_Disable_dispatch();
+        _Thread_queue_Acquire_critical( wait_queue, &lock_context );
+
+        if ( is_mutex &&
+             _CORE_mutex_Is_locked( &the_semaphore->Core_control.mutex ) &&
              !_Attributes_Is_simple_binary_semaphore( attribute_set ) ) {
-          _Objects_Put( &the_semaphore->Object );
+          _Thread_queue_Release( wait_queue, &lock_context );
+          _Thread_Enable_dispatch();
           _Objects_Allocator_unlock();
           return RTEMS_RESOURCE_IN_USE;
         }
-        _CORE_mutex_Flush(
-          &the_semaphore->Core_control.mutex,
-          SEMAPHORE_MP_OBJECT_WAS_DELETED,
-          CORE_MUTEX_WAS_DELETED
-        );
-      } else {
-        _CORE_semaphore_Flush(
-          &the_semaphore->Core_control.semaphore,
-          SEMAPHORE_MP_OBJECT_WAS_DELETED,
-          CORE_SEMAPHORE_WAS_DELETED
-        );
-     }
 
-      _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
+        _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
+
+        _Thread_queue_Release( wait_queue, &lock_context );
+
+        if ( is_mutex ) {
+          _CORE_mutex_Flush(
+            &the_semaphore->Core_control.mutex,
+            SEMAPHORE_MP_OBJECT_WAS_DELETED,
+            CORE_MUTEX_WAS_DELETED
+          );
+        } else {
+          _CORE_semaphore_Flush(
+            &the_semaphore->Core_control.semaphore,
+            SEMAPHORE_MP_OBJECT_WAS_DELETED,
+            CORE_SEMAPHORE_WAS_DELETED
+          );
+        }
+      }
 
 #if defined(RTEMS_MULTIPROCESSING)
       if ( _Attributes_Is_global( attribute_set ) ) {
@@ -100,7 +136,7 @@ rtems_status_code rtems_semaphore_delete(
       }
 #endif
 
-      _Objects_Put( &the_semaphore->Object );
+      _Thread_Enable_dispatch();
       _Semaphore_Free( the_semaphore );
       _Objects_Allocator_unlock();
       return RTEMS_SUCCESSFUL;
@@ -39,12 +39,17 @@ rtems_status_code rtems_semaphore_obtain(
 {
   Semaphore_Control              *the_semaphore;
   Objects_Locations               location;
-  ISR_Level                       level;
+  ISR_lock_Context                lock_context;
   Thread_Control                 *executing;
   rtems_attribute                 attribute_set;
   bool                            wait;
+  CORE_semaphore_Control         *the_core_semaphore;
 
-  the_semaphore = _Semaphore_Get_interrupt_disable( id, &location, &level );
+  the_semaphore = _Semaphore_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
@@ -55,41 +60,105 @@ rtems_status_code rtems_semaphore_obtain(
       if ( _Attributes_Is_multiprocessor_resource_sharing( attribute_set ) ) {
         MRSP_Status mrsp_status;
 
-        _ISR_Enable( level );
+        _Thread_Disable_dispatch();
+        _ISR_lock_ISR_enable( &lock_context );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_Enable_dispatch();
+          return RTEMS_INVALID_ID;
+        }
         mrsp_status = _MRSP_Obtain(
           &the_semaphore->Core_control.mrsp,
           executing,
           wait,
           timeout
         );
-        _Objects_Put_for_get_isr_disable( &the_semaphore->Object );
+        _Thread_Enable_dispatch();
         return _Semaphore_Translate_MRSP_status_code( mrsp_status );
       } else
 #endif
       if ( !_Attributes_Is_counting_semaphore( attribute_set ) ) {
-        _CORE_mutex_Seize(
-          &the_semaphore->Core_control.mutex,
-          executing,
-          id,
-          wait,
-          timeout,
-          level
+        CORE_mutex_Control *the_mutex = &the_semaphore->Core_control.mutex;
+
+        _Thread_queue_Acquire_critical(
+          &the_mutex->Wait_queue,
+          &lock_context
         );
-        _Objects_Put_for_get_isr_disable( &the_semaphore->Object );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
+          return RTEMS_INVALID_ID;
+        }
+
+        if (
+          !_CORE_mutex_Seize_isr_disable(
+            the_mutex,
+            executing,
+            wait,
+            &lock_context
+          )
+        ) {
+#if defined(RTEMS_SMP)
+          _Thread_Disable_dispatch();
+          if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+            _ISR_lock_ISR_enable( &lock_context );
+            _Thread_Enable_dispatch();
+            return RTEMS_INVALID_ID;
+          }
+#endif
+          _CORE_mutex_Seize(
+            the_mutex,
+            executing,
+            id,
+            wait,
+            timeout,
+            &lock_context
+          );
+#if defined(RTEMS_SMP)
+          _Thread_Enable_dispatch();
+#endif
+        }
+
         return _Semaphore_Translate_core_mutex_return_code(
                   executing->Wait.return_code );
       }
 
       /* must be a counting semaphore */
-      _CORE_semaphore_Seize_isr_disable(
-        &the_semaphore->Core_control.semaphore,
-        executing,
-        id,
-        wait,
-        timeout,
-        level
+      the_core_semaphore = &the_semaphore->Core_control.semaphore;
+      _Thread_queue_Acquire_critical(
+        &the_core_semaphore->Wait_queue,
+        &lock_context
       );
-      _Objects_Put_for_get_isr_disable( &the_semaphore->Object );
+      if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+        _Thread_queue_Release(
+          &the_core_semaphore->Wait_queue,
+          &lock_context
+        );
+        return RTEMS_INVALID_ID;
+      }
+
+      if (
+        !_CORE_semaphore_Seize_isr_disable(
+          the_core_semaphore,
+          executing,
+          wait,
+          &lock_context
+        )
+      ) {
+        _Thread_Disable_dispatch();
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _ISR_lock_ISR_enable( &lock_context );
+          _Thread_Enable_dispatch();
+          return RTEMS_INVALID_ID;
+        }
+        _CORE_semaphore_Seize_blocking(
+          the_core_semaphore,
+          executing,
+          id,
+          timeout,
+          &lock_context
+        );
+        _Thread_Enable_dispatch();
+      }
+
       return _Semaphore_Translate_core_semaphore_return_code(
                   executing->Wait.return_code );
 
@@ -71,40 +71,104 @@ rtems_status_code rtems_semaphore_release(
 {
   Semaphore_Control          *the_semaphore;
   Objects_Locations           location;
+  ISR_lock_Context            lock_context;
   CORE_mutex_Status           mutex_status;
   CORE_semaphore_Status       semaphore_status;
   rtems_attribute             attribute_set;
 
-  the_semaphore = _Semaphore_Get( id, &location );
+  the_semaphore = _Semaphore_Get_interrupt_disable(
+    id,
+    &location,
+    &lock_context
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
       attribute_set = the_semaphore->attribute_set;
 #if defined(RTEMS_SMP)
       if ( _Attributes_Is_multiprocessor_resource_sharing( attribute_set ) ) {
-        MRSP_Status mrsp_status = _MRSP_Release(
+        MRSP_Status mrsp_status;
+
+        _Thread_Disable_dispatch();
+        _ISR_lock_ISR_enable( &lock_context );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_Enable_dispatch();
+          return RTEMS_INVALID_ID;
+        }
+        mrsp_status = _MRSP_Release(
           &the_semaphore->Core_control.mrsp,
           _Thread_Get_executing()
         );
-        _Objects_Put( &the_semaphore->Object );
+        _Thread_Enable_dispatch();
         return _Semaphore_Translate_MRSP_status_code( mrsp_status );
       } else
 #endif
       if ( !_Attributes_Is_counting_semaphore( attribute_set ) ) {
+        CORE_mutex_Control *the_mutex = &the_semaphore->Core_control.mutex;
+
+        _Thread_queue_Acquire_critical(
+          &the_mutex->Wait_queue,
+          &lock_context
+        );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
+          return RTEMS_INVALID_ID;
+        }
+
+        if ( _CORE_mutex_Surrender_isr_disable( the_mutex, &lock_context ) ) {
+          return RTEMS_SUCCESSFUL;
+        }
+
+        _Thread_Disable_dispatch();
+        _ISR_lock_ISR_enable( &lock_context );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_Enable_dispatch();
+          return RTEMS_INVALID_ID;
+        }
         mutex_status = _CORE_mutex_Surrender(
-          &the_semaphore->Core_control.mutex,
+          the_mutex,
           id,
           MUTEX_MP_SUPPORT
         );
-        _Objects_Put( &the_semaphore->Object );
+        _Thread_Enable_dispatch();
         return _Semaphore_Translate_core_mutex_return_code( mutex_status );
       } else {
-        semaphore_status = _CORE_semaphore_Surrender(
-          &the_semaphore->Core_control.semaphore,
-          id,
-          MUTEX_MP_SUPPORT
+        CORE_semaphore_Control *the_core_semaphore =
+          &the_semaphore->Core_control.semaphore;
+
+        _Thread_queue_Acquire_critical(
+          &the_core_semaphore->Wait_queue,
+          &lock_context
         );
-        _Objects_Put( &the_semaphore->Object );
+        if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+          _Thread_queue_Release(
+            &the_core_semaphore->Wait_queue,
+            &lock_context
+          );
+          return RTEMS_INVALID_ID;
+        }
+
+        if (
+          !_CORE_semaphore_Surrender_isr_disable(
+            the_core_semaphore,
+            &lock_context,
+            &semaphore_status
+          )
+        ) {
+          _Thread_Disable_dispatch();
+          _ISR_lock_ISR_enable( &lock_context );
+          if ( _Semaphore_Is_deleted( the_semaphore, id ) ) {
+            _Thread_Enable_dispatch();
+            return RTEMS_INVALID_ID;
+          }
+          semaphore_status = _CORE_semaphore_Surrender(
+            the_core_semaphore,
+            id,
+            MUTEX_MP_SUPPORT
+          );
+          _Thread_Enable_dispatch();
+        }
+
         return
           _Semaphore_Translate_core_semaphore_return_code( semaphore_status );
       }
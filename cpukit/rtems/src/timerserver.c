@@ -107,9 +107,17 @@ static void _Timer_server_Insert_timer(
 )
 {
   if ( timer->the_class == TIMER_INTERVAL_ON_TASK ) {
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert(
+      &_Watchdog_Sync,
+      &ts->Interval_watchdogs.Chain,
+      &timer->Ticker
+    );
   } else if ( timer->the_class == TIMER_TIME_OF_DAY_ON_TASK ) {
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert(
+      &_Watchdog_Sync,
+      &ts->TOD_watchdogs.Chain,
+      &timer->Ticker
+    );
   }
 }
 
@@ -163,7 +171,11 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     ts->Interval_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert(
+      &_Watchdog_Sync,
+      &ts->Interval_watchdogs.Chain,
+      &timer->Ticker
+    );
 
     if ( !ts->active ) {
       _Timer_server_Reset_interval_system_watchdog( ts );
@@ -201,7 +213,11 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     ts->TOD_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert(
+      &_Watchdog_Sync,
+      &ts->TOD_watchdogs.Chain,
+      &timer->Ticker
+    );
 
     if ( !ts->active ) {
       _Timer_server_Reset_tod_system_watchdog( ts );
@@ -244,7 +260,12 @@ static void _Timer_server_Process_interval_watchdogs(
 
   watchdogs->last_snapshot = snapshot;
 
-  _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+  _Watchdog_Adjust_to_chain(
+    &_Watchdog_Sync,
+    &watchdogs->Chain,
+    delta,
+    fire_chain
+  );
 }
 
 static void _Timer_server_Process_tod_watchdogs(
@@ -267,7 +288,12 @@ static void _Timer_server_Process_tod_watchdogs(
      *  TOD has been set forward.
      */
     delta = snapshot - last_snapshot;
-    _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+    _Watchdog_Adjust_to_chain(
+      &_Watchdog_Sync,
+      &watchdogs->Chain,
+      delta,
+      fire_chain
+    );
 
   } else if ( snapshot < last_snapshot ) {
      /*
@@ -275,7 +301,12 @@ static void _Timer_server_Process_tod_watchdogs(
       *  TOD has been set backwards.
       */
      delta = last_snapshot - snapshot;
-     _Watchdog_Adjust( &watchdogs->Chain, WATCHDOG_BACKWARD, delta );
+     _Watchdog_Adjust(
+       &_Watchdog_Sync,
+       &watchdogs->Chain,
+       WATCHDOG_BACKWARD,
+       delta
+     );
   }
 
   watchdogs->last_snapshot = snapshot;
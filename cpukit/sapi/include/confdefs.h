@@ -330,6 +330,29 @@ const rtems_libio_helper rtems_fs_init_helper =
                     IMFS_MEMFILE_DEFAULT_BYTES_PER_BLOCK
 #endif
 
+/**
+ * If this is defined, then the IMFS directories maintain a red-black tree of
+ * their entries ordered by name.  This speeds up the path evaluation in large
+ * directories at the cost of a slightly more expensive node creation and
+ * removal.
+ */
+#ifdef CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+  #define CONFIGURE_IMFS_DIRECTORY_INDEX true
+#else
+  #define CONFIGURE_IMFS_DIRECTORY_INDEX false
+#endif
+
+/**
+ * If this is defined, then the regular files of the IMFS store their content
+ * in extents which grow geometrically instead of blocks of
+ * CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK bytes.
+ */
+#ifdef CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS
+  #define CONFIGURE_IMFS_MEMFILE_NODE_CONTROL &IMFS_node_control_extfile
+#else
+  #define CONFIGURE_IMFS_MEMFILE_NODE_CONTROL &IMFS_node_control_memfile
+#endif
+
 /**
  * This defines the miniIMFS file system table entry.
  */
@@ -515,6 +538,9 @@ const rtems_libio_helper rtems_fs_init_helper =
   #if defined(CONFIGURE_FILESYSTEM_IMFS) || \
       defined(CONFIGURE_FILESYSTEM_MINIIMFS)
     int imfs_rq_memfile_bytes_per_block = CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK;
+    bool imfs_rq_directory_index = CONFIGURE_IMFS_DIRECTORY_INDEX;
+    const IMFS_node_control *const imfs_rq_memfile_node_control =
+      CONFIGURE_IMFS_MEMFILE_NODE_CONTROL;
   #endif
 #endif
 
@@ -663,7 +689,9 @@ const rtems_libio_helper rtems_fs_init_helper =
  *  CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP - Deterministic Priority SMP Affinity Scheduler
  *  CONFIGURE_SCHEDULER_SIMPLE     - Light-weight Priority Scheduler
  *  CONFIGURE_SCHEDULER_SIMPLE_SMP - Simple SMP Priority Scheduler
+ *  CONFIGURE_SCHEDULER_WORK_STEALING_SMP - Work Stealing SMP Scheduler
  *  CONFIGURE_SCHEDULER_EDF        - EDF Scheduler
+ *  CONFIGURE_SCHEDULER_EDF_SMP    - Global EDF SMP Scheduler
  *  CONFIGURE_SCHEDULER_CBS        - CBS Scheduler
  *
  * If no configuration is specified by the application, then
@@ -683,7 +711,9 @@ const rtems_libio_helper rtems_fs_init_helper =
     !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) && \
+    !defined(CONFIGURE_SCHEDULER_WORK_STEALING_SMP) && \
     !defined(CONFIGURE_SCHEDULER_EDF) && \
+    !defined(CONFIGURE_SCHEDULER_EDF_SMP) && \
     !defined(CONFIGURE_SCHEDULER_CBS)
   #if defined(RTEMS_SMP) && defined(CONFIGURE_SMP_APPLICATION)
     #define CONFIGURE_SCHEDULER_PRIORITY_SMP
@@ -792,6 +822,26 @@ const rtems_libio_helper rtems_fs_init_helper =
   #endif
 #endif
 
+/*
+ * If the Work Stealing SMP Scheduler is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_WORK_STEALING_SMP)
+  #if !defined(CONFIGURE_SCHEDULER_NAME)
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name('M', 'P', 'W', ' ')
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_CONTROLS)
+    #define CONFIGURE_SCHEDULER_CONTEXT \
+      RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_SMP_MAXIMUM_PROCESSORS \
+      )
+
+    #define CONFIGURE_SCHEDULER_CONTROLS \
+      RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(dflt, CONFIGURE_SCHEDULER_NAME)
+  #endif
+#endif
+
 /*
  * If the EDF Scheduler is selected, then configure for it.
  */
@@ -808,6 +858,22 @@ const rtems_libio_helper rtems_fs_init_helper =
   #endif
 #endif
 
+/*
+ * If the EDF SMP Scheduler is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_EDF_SMP)
+  #if !defined(CONFIGURE_SCHEDULER_NAME)
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name('M', 'E', 'D', 'F')
+  #endif
+
+  #if !defined(CONFIGURE_SCHEDULER_CONTROLS)
+    #define CONFIGURE_SCHEDULER_CONTEXT RTEMS_SCHEDULER_CONTEXT_EDF_SMP(dflt)
+
+    #define CONFIGURE_SCHEDULER_CONTROLS \
+      RTEMS_SCHEDULER_CONTROL_EDF_SMP(dflt, CONFIGURE_SCHEDULER_NAME)
+  #endif
+#endif
+
 /*
  * If the CBS Scheduler is selected, then configure for it.
  */
@@ -967,7 +1033,7 @@ const rtems_libio_helper rtems_fs_init_helper =
     );
   #endif
 
-  #if defined(CONFIGURE_SCHEDULER_EDF)
+  #if defined(CONFIGURE_SCHEDULER_EDF) || defined(CONFIGURE_SCHEDULER_EDF_SMP)
     const bool _Scheduler_FIXME_thread_priority_queues_are_broken = true;
   #else
     const bool _Scheduler_FIXME_thread_priority_queues_are_broken = false;
@@ -1161,6 +1227,48 @@ const rtems_libio_helper rtems_fs_init_helper =
     #endif
 #endif
 
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the malloc heap to use the two-level segregated fit
+   * allocation policy.  The free block for an allocation request is then
+   * found in constant time.
+   */
+  const bool rtems_malloc_segregated_fit =
+    #if defined(CONFIGURE_MALLOC_SEGREGATED_FIT)
+      true;
+    #else
+      false;
+    #endif
+#endif
+
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the maximum count of blocks of one size class in the
+   * per-processor caches of small blocks of the malloc family.  By default
+   * the caches are disabled.
+   */
+  const uint32_t rtems_malloc_cache_blocks =
+    #if defined(CONFIGURE_MALLOC_CACHE_BLOCKS)
+      CONFIGURE_MALLOC_CACHE_BLOCKS;
+    #else
+      0;
+    #endif
+#endif
+
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the maximum count of free buffers in each per-processor
+   * cache of the Classic API partitions.  By default the caches are
+   * disabled.
+   */
+  const uint32_t rtems_partition_cache_buffers =
+    #if defined(CONFIGURE_PARTITION_CACHE_BUFFERS)
+      CONFIGURE_PARTITION_CACHE_BUFFERS;
+    #else
+      0;
+    #endif
+#endif
+
 /**
  * Zero of one returns 0 if the parameter is 0 else 1 is returned.
  */
@@ -1199,6 +1307,17 @@ const rtems_libio_helper rtems_fs_init_helper =
 #define _Configure_Max_Objects(_max) \
   (_Configure_Zero_or_One(_max) * rtems_resource_maximum_per_allocation(_max))
 
+/**
+ * This macro accounts for the memory of the optional object name index.  The
+ * bucket count is at most two times the maximum object count.
+ */
+#ifdef CONFIGURE_OBJECT_NAME_INDEX
+  #define _Configure_Object_name_index_RAM(_number) \
+    (3 * (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Maximum))
+#else
+  #define _Configure_Object_name_index_RAM(_number) 0
+#endif
+
 /**
  * This macro accounts for how memory for a set of configured objects is
  * allocated from the Executive Workspace.
@@ -1212,7 +1331,8 @@ const rtems_libio_helper rtems_fs_init_helper =
       _Configure_Zero_or_One(_number) * ( \
         (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Control *) + \
         _Configure_Align_up(sizeof(void *), CPU_ALIGNMENT) + \
-        _Configure_Align_up(sizeof(uint32_t), CPU_ALIGNMENT) \
+        _Configure_Align_up(sizeof(uint32_t), CPU_ALIGNMENT) + \
+        _Configure_Object_name_index_RAM(_number) \
       ) \
     ) \
   )
@@ -1494,6 +1614,22 @@ const rtems_libio_helper rtems_fs_init_helper =
     #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY \
                               RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
   #endif
+  #ifndef CONFIGURE_BDBUF_LOOKUP
+    #define CONFIGURE_BDBUF_LOOKUP \
+                              RTEMS_BDBUF_LOOKUP_DEFAULT
+  #endif
+  #ifndef CONFIGURE_BDBUF_SHARDS
+    #define CONFIGURE_BDBUF_SHARDS \
+                              RTEMS_BDBUF_SHARDS_DEFAULT
+  #endif
+  #ifndef CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS
+    #define CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS \
+                              RTEMS_BDBUF_INITIAL_READ_AHEAD_BLOCKS_DEFAULT
+  #endif
+  #ifndef CONFIGURE_SWAPOUT_WRITE_COALESCING
+    #define CONFIGURE_SWAPOUT_WRITE_COALESCING \
+                              RTEMS_BDBUF_SWAPOUT_WRITE_COALESCING_DEFAULT
+  #endif
   #ifdef CONFIGURE_INIT
     const rtems_bdbuf_config rtems_bdbuf_configuration = {
       CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS,
@@ -1507,7 +1643,11 @@ const rtems_libio_helper rtems_fs_init_helper =
       CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
       CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
       CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+      CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+      CONFIGURE_BDBUF_LOOKUP,
+      CONFIGURE_BDBUF_SHARDS,
+      CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS,
+      CONFIGURE_SWAPOUT_WRITE_COALESCING
     };
   #endif
 
@@ -1528,30 +1668,31 @@ const rtems_libio_helper rtems_fs_init_helper =
     #define CONFIGURE_LIBBLOCK_SEMAPHORES 1
 
     /*
-     * POSIX Mutexes:
+     * POSIX Mutexes (per cache shard):
      *  o bdbuf lock
      *  o bdbuf sync lock
      */
-    #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES 2
+    #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES (2 * CONFIGURE_BDBUF_SHARDS)
 
     /*
-     * POSIX Condition Variables:
+     * POSIX Condition Variables (per cache shard):
      *  o bdbuf access condition
      *  o bdbuf transfer condition
      *  o bdbuf buffer condition
      */
-    #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES 3
+    #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES \
+      (3 * CONFIGURE_BDBUF_SHARDS)
   #else
     /*
      * Semaphores:
      *   o disk lock
-     *   o bdbuf lock
-     *   o bdbuf sync lock
-     *   o bdbuf access condition
-     *   o bdbuf transfer condition
-     *   o bdbuf buffer condition
+     *   o bdbuf lock (per cache shard)
+     *   o bdbuf sync lock (per cache shard)
+     *   o bdbuf access condition (per cache shard)
+     *   o bdbuf transfer condition (per cache shard)
+     *   o bdbuf buffer condition (per cache shard)
      */
-    #define CONFIGURE_LIBBLOCK_SEMAPHORES 6
+    #define CONFIGURE_LIBBLOCK_SEMAPHORES (1 + 5 * CONFIGURE_BDBUF_SHARDS)
 
     #define CONFIGURE_LIBBLOCK_POSIX_MUTEXES 0
     #define CONFIGURE_LIBBLOCK_POSIX_CONDITION_VARIABLES 0
@@ -1855,8 +1996,21 @@ const rtems_libio_helper rtems_fs_init_helper =
     #define CONFIGURE_MAXIMUM_PARTITIONS                 0
     #define CONFIGURE_MEMORY_FOR_PARTITIONS(_partitions) 0
   #else
+    #if !defined(CONFIGURE_PARTITION_CACHE_BUFFERS) || \
+      CONFIGURE_PARTITION_CACHE_BUFFERS == 0
+      #define CONFIGURE_MEMORY_FOR_PARTITION_CACHES(_partitions) 0
+    #elif defined(RTEMS_SMP)
+      #define CONFIGURE_MEMORY_FOR_PARTITION_CACHES(_partitions) \
+        _Configure_From_workspace(_Configure_Max_Objects(_partitions) * \
+          CONFIGURE_SMP_MAXIMUM_PROCESSORS * sizeof(Partition_Cache))
+    #else
+      #define CONFIGURE_MEMORY_FOR_PARTITION_CACHES(_partitions) \
+        _Configure_From_workspace(_Configure_Max_Objects(_partitions) * \
+          sizeof(Partition_Cache))
+    #endif
     #define CONFIGURE_MEMORY_FOR_PARTITIONS(_partitions) \
-      _Configure_Object_RAM(_partitions, sizeof(Partition_Control) )
+      (_Configure_Object_RAM(_partitions, sizeof(Partition_Control) ) + \
+        CONFIGURE_MEMORY_FOR_PARTITION_CACHES(_partitions))
   #endif
 
   #ifndef CONFIGURE_MAXIMUM_REGIONS
@@ -2557,6 +2711,12 @@ const rtems_libio_helper rtems_fs_init_helper =
       #ifdef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
         Scheduler_priority_affinity_SMP_Node Priority_affinity_SMP;
       #endif
+      #ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+        Scheduler_work_stealing_SMP_Node Work_stealing_SMP;
+      #endif
+      #ifdef CONFIGURE_SCHEDULER_EDF_SMP
+        Scheduler_EDF_SMP_Node EDF_SMP;
+      #endif
       #ifdef CONFIGURE_SCHEDULER_USER_PER_THREAD
         CONFIGURE_SCHEDULER_USER_PER_THREAD User;
       #endif
@@ -2703,6 +2863,12 @@ const rtems_libio_helper rtems_fs_init_helper =
     #else
       false,
     #endif
+    #ifdef CONFIGURE_OBJECT_NAME_INDEX        /* true to use the object
+                                                 name index */
+      true,
+    #else
+      false,
+    #endif
     #ifdef RTEMS_SMP
       #ifdef CONFIGURE_SMP_APPLICATION
         true,
@@ -2729,6 +2895,8 @@ const rtems_libio_helper rtems_fs_init_helper =
   */
  #if defined(CONFIGURE_INIT)
    Per_CPU_Control_envelope _Per_CPU_Information[CONFIGURE_SMP_MAXIMUM_PROCESSORS];
+
+   Watchdog_Ticks_control _Watchdog_Ticks_per_CPU[CONFIGURE_SMP_MAXIMUM_PROCESSORS];
  #endif
 
 #endif
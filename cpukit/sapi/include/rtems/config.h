@@ -237,6 +237,15 @@ typedef struct {
    */
   bool                           stack_allocator_avoids_work_space;
 
+  /**
+   * @brief Specifies if the object name index is used or not.
+   *
+   * If this element is @a true, then each object class maintains a hash
+   * index of the object names to speed up the object name to identifier
+   * translation, otherwise the object tables are searched linearly.
+   */
+  bool                           object_name_index;
+
   #ifdef RTEMS_SMP
     bool                         smp_enabled;
   #endif
@@ -285,6 +294,9 @@ extern const rtems_configuration_table Configuration;
 #define rtems_configuration_get_stack_allocator_avoids_work_space() \
         (Configuration.stack_allocator_avoids_work_space)
 
+#define rtems_configuration_get_object_name_index() \
+        (Configuration.object_name_index)
+
 #define rtems_configuration_get_stack_space_size() \
         (Configuration.stack_space_size)
 
@@ -0,0 +1,284 @@
+/**
+ * @file
+ *
+ * @brief Fixed-Size Object Pool API
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_POOL_H
+#define _RTEMS_POOL_H
+
+#include <rtems.h>
+#include <rtems/chain.h>
+#include <rtems/score/freechain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup Pool Fixed-Size Object Pool
+ *
+ * @ingroup ClassicRTEMS
+ *
+ * @brief Fixed-Size Object Pool API.
+ *
+ * The object pool provides objects of one size with a constant time get and
+ * put operation.  It is intended for drivers and protocol stacks which
+ * allocate and free many small objects of the same type, for example buffer
+ * descriptors.  In contrast to the partition manager the pool does not need
+ * an object identifier lookup and may grow on demand.
+ *
+ * The free objects are kept in a depot protected by an interrupt lock.
+ * Optionally each processor has a magazine of free objects.  The magazines
+ * are used without a lock contention with other processors.  Objects are
+ * moved in batches of half the magazine size between the magazines and the
+ * depot.
+ *
+ * The initial objects may be provided by a user supplied memory area.  In
+ * case the depot is empty and the pool was configured with a positive extend
+ * count, then the pool is extended by this count of objects allocated from
+ * the RTEMS Workspace.  This is only possible in a thread context with thread
+ * dispatching enabled or during system initialization.  Objects are never
+ * given back to the Workspace before the pool is destroyed.
+ */
+/**@{*/
+
+/**
+ * @brief Object pool configuration.
+ */
+typedef struct {
+  /**
+   * Object size in bytes.  It is rounded up to satisfy the CPU alignment and
+   * to be at least the size of a chain node.
+   */
+  size_t object_size;
+
+  /**
+   * Begin of a memory area for the initial objects.  May be @c NULL.
+   */
+  void *area_begin;
+
+  /**
+   * Size of the memory area for the initial objects in bytes.
+   */
+  size_t area_size;
+
+  /**
+   * Count of objects allocated from the RTEMS Workspace in case the pool is
+   * empty.  A value of zero disables the extension of the pool.
+   */
+  uint32_t extend_count;
+
+  /**
+   * Maximum count of objects of the pool.  A value of zero means that there
+   * is no limit.
+   */
+  uint32_t maximum_objects;
+
+  /**
+   * Maximum count of free objects in each per-processor magazine.  A value of
+   * zero disables the magazines.
+   */
+  uint32_t magazine_size;
+} rtems_pool_config;
+
+/**
+ * @brief Object pool statistics.
+ */
+typedef struct {
+  /**
+   * Count of objects managed by the pool.
+   */
+  uint32_t objects;
+
+  /**
+   * Count of free objects in the depot and the magazines.
+   */
+  uint32_t free_objects;
+
+  /**
+   * Count of successful get operations.
+   */
+  uint32_t gets;
+
+  /**
+   * Count of get operations satisfied by a magazine without access to the
+   * depot.
+   */
+  uint32_t magazine_hits;
+
+  /**
+   * Count of put operations.
+   */
+  uint32_t puts;
+
+  /**
+   * Count of pool extensions with memory from the RTEMS Workspace.
+   */
+  uint32_t extends;
+
+  /**
+   * Count of failed get operations.
+   */
+  uint32_t failed_gets;
+} rtems_pool_statistics;
+
+typedef struct rtems_pool_magazine rtems_pool_magazine;
+
+/**
+ * @brief Object pool control.
+ *
+ * The members are private to the implementation.
+ */
+typedef struct {
+  /**
+   * Free objects not contained in a magazine.
+   */
+  Freechain_Control depot;
+
+  /**
+   * Protects the depot, the chain of extension blocks and the counters of
+   * the pool.
+   */
+  rtems_interrupt_lock lock;
+
+  /**
+   * Chain of memory blocks allocated from the RTEMS Workspace.
+   */
+  rtems_chain_control blocks;
+
+  /**
+   * Table of per-processor magazines.  It is @c NULL in case the magazines
+   * are disabled.
+   */
+  rtems_pool_magazine *magazines;
+
+  uint32_t magazine_count;
+
+  uint32_t magazine_size;
+
+  size_t object_size;
+
+  uint32_t extend_count;
+
+  uint32_t maximum_objects;
+
+  uint32_t objects;
+
+  uint32_t depot_objects;
+
+  uint32_t gets;
+
+  uint32_t puts;
+
+  uint32_t extends;
+
+  uint32_t failed_gets;
+} rtems_pool_control;
+
+/**
+ * @brief Initializes the object pool @a pool.
+ *
+ * @param[out] pool The object pool.
+ * @param[in] config The object pool configuration.  It is not referenced
+ * after this call.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The pool or configuration is @c NULL.
+ * @retval RTEMS_INVALID_SIZE The object size is zero or the memory area of
+ * the configuration wraps around the end of the address space.
+ * @retval RTEMS_INVALID_NUMBER The size of an extension block is not
+ * representable.
+ * @retval RTEMS_NO_MEMORY Not enough memory for the magazines in the RTEMS
+ * Workspace.
+ */
+rtems_status_code rtems_pool_initialize(
+  rtems_pool_control *pool,
+  const rtems_pool_config *config
+);
+
+/**
+ * @brief Destroys the object pool @a pool.
+ *
+ * All objects must be returned to the pool before.  The memory allocated
+ * from the RTEMS Workspace is freed.  The memory area of the configuration
+ * is no longer in use by the pool.
+ *
+ * @param[in, out] pool The object pool.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_RESOURCE_IN_USE Some objects are still in use.
+ */
+rtems_status_code rtems_pool_destroy(rtems_pool_control *pool);
+
+/**
+ * @brief Gets an object from the object pool @a pool.
+ *
+ * This function may be called from interrupt context.
+ *
+ * @param[in, out] pool The object pool.
+ *
+ * @retval NULL No free object is available and the pool cannot be extended.
+ * @retval otherwise Pointer to the object.
+ */
+void *rtems_pool_get(rtems_pool_control *pool);
+
+/**
+ * @brief Puts an object back to the object pool @a pool.
+ *
+ * This function may be called from interrupt context.
+ *
+ * @param[in, out] pool The object pool.
+ * @param[in] object The object obtained by rtems_pool_get() of this pool.
+ */
+void rtems_pool_put(rtems_pool_control *pool, void *object);
+
+/**
+ * @brief Moves the free objects of all magazines to the depot of the object
+ * pool @a pool.
+ *
+ * @param[in, out] pool The object pool.
+ */
+void rtems_pool_flush(rtems_pool_control *pool);
+
+/**
+ * @brief Gets the statistics of the object pool @a pool.
+ *
+ * @param[in, out] pool The object pool.
+ * @param[out] statistics The statistics.
+ */
+void rtems_pool_get_statistics(
+  rtems_pool_control *pool,
+  rtems_pool_statistics *statistics
+);
+
+/**
+ * @brief Returns the object size of the object pool @a pool.
+ *
+ * @param[in] pool The object pool.
+ *
+ * @return The object size in bytes after alignment adjustments.
+ */
+static inline size_t rtems_pool_get_object_size(
+  const rtems_pool_control *pool
+)
+{
+  return pool->object_size;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_POOL_H */
@@ -187,4 +187,42 @@
     }
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+  #include <rtems/score/schedulerworkstealingsmp.h>
+
+  #define RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name ) \
+    RTEMS_SCHEDULER_CONTEXT_NAME( work_stealing_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP( name, cpu_count ) \
+    static struct { \
+      Scheduler_work_stealing_SMP_Context Base; \
+      Scheduler_work_stealing_SMP_Queue   Queues[ ( cpu_count ) ]; \
+    } RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name )
+
+  #define RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP( name, obj_name ) \
+    { \
+      &RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP_NAME( name ).Base.Base.Base, \
+      SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS, \
+      ( obj_name ) \
+    }
+#endif
+
+#ifdef CONFIGURE_SCHEDULER_EDF_SMP
+  #include <rtems/score/scheduleredfsmp.h>
+
+  #define RTEMS_SCHEDULER_CONTEXT_EDF_SMP_NAME( name ) \
+    RTEMS_SCHEDULER_CONTEXT_NAME( EDF_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_CONTEXT_EDF_SMP( name ) \
+    static Scheduler_EDF_SMP_Context \
+      RTEMS_SCHEDULER_CONTEXT_EDF_SMP_NAME( name )
+
+  #define RTEMS_SCHEDULER_CONTROL_EDF_SMP( name, obj_name ) \
+    { \
+      &RTEMS_SCHEDULER_CONTEXT_EDF_SMP_NAME( name ).Base.Base, \
+      SCHEDULER_EDF_SMP_ENTRY_POINTS, \
+      ( obj_name ) \
+    }
+#endif
+
 #endif /* _RTEMS_SAPI_SCHEDULER_H */
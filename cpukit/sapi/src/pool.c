@@ -0,0 +1,530 @@
+/**
+ * @file
+ *
+ * @ingroup Pool
+ *
+ * @brief Fixed-Size Object Pool Implementation
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/pool.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/wkspace.h>
+
+#include <stdint.h>
+#include <string.h>
+
+struct rtems_pool_magazine {
+  ISR_lock_Control lock;
+  Chain_Control objects;
+  uint32_t count;
+  uint32_t gets;
+  uint32_t hits;
+  uint32_t puts;
+};
+
+static uintptr_t align_up(uintptr_t alignment, uintptr_t value)
+{
+  uintptr_t excess = value % alignment;
+
+  if (excess > 0) {
+    value += alignment - excess;
+  }
+
+  return value;
+}
+
+/*
+ * The depot never extends itself since the memory allocation from the RTEMS
+ * Workspace must not happen with the pool lock held.
+ */
+static bool pool_depot_extend_never(Freechain_Control *freechain)
+{
+  (void) freechain;
+
+  return false;
+}
+
+static size_t pool_block_header_size(void)
+{
+  return align_up(CPU_ALIGNMENT, sizeof(Chain_Node));
+}
+
+static uint32_t pool_batch_size(const rtems_pool_control *pool)
+{
+  return (pool->magazine_size + 1) / 2;
+}
+
+static void pool_depot_add(
+  rtems_pool_control *pool,
+  char *begin,
+  uint32_t count
+)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; ++i) {
+    _Freechain_Put(&pool->depot, begin + i * pool->object_size);
+  }
+
+  pool->depot_objects += count;
+}
+
+static void *pool_depot_get(rtems_pool_control *pool)
+{
+  void *object = _Freechain_Get(&pool->depot);
+
+  if (object != NULL) {
+    --pool->depot_objects;
+  }
+
+  return object;
+}
+
+static void pool_depot_put(rtems_pool_control *pool, void *object)
+{
+  _Freechain_Put(&pool->depot, object);
+  ++pool->depot_objects;
+}
+
+/*
+ * Interrupts are disabled to pin the executing thread to its processor.  The
+ * magazine lock is only contended by rtems_pool_flush() and the statistics
+ * and destroy functions.  The pool lock nests inside the magazine lock.
+ */
+static rtems_pool_magazine *pool_magazine_acquire(
+  rtems_pool_control *pool,
+  ISR_Level *level,
+  ISR_lock_Context *lock_context
+)
+{
+  rtems_pool_magazine *magazine;
+
+  _ISR_Disable_without_giant(*level);
+  magazine = &pool->magazines[_SMP_Get_current_processor()];
+  _ISR_lock_Acquire(&magazine->lock, lock_context);
+
+  return magazine;
+}
+
+static void pool_magazine_release(
+  rtems_pool_magazine *magazine,
+  ISR_Level level,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release(&magazine->lock, lock_context);
+  _ISR_Enable_without_giant(level);
+}
+
+/*
+ * The caller must hold the magazine and the pool lock.
+ */
+static void pool_magazine_to_depot(
+  rtems_pool_control *pool,
+  rtems_pool_magazine *magazine,
+  uint32_t count
+)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; ++i) {
+    pool_depot_put(pool, _Chain_Get_first_unprotected(&magazine->objects));
+  }
+
+  magazine->count -= count;
+}
+
+static void *pool_magazine_get(rtems_pool_control *pool)
+{
+  rtems_pool_magazine *magazine;
+  ISR_Level level;
+  ISR_lock_Context lock_context;
+  void *object;
+
+  magazine = pool_magazine_acquire(pool, &level, &lock_context);
+  object = _Chain_Get_unprotected(&magazine->objects);
+
+  if (object != NULL) {
+    --magazine->count;
+    ++magazine->hits;
+  } else {
+    ISR_lock_Context depot_lock_context;
+
+    _ISR_lock_Acquire(&pool->lock, &depot_lock_context);
+
+    object = pool_depot_get(pool);
+
+    if (object != NULL) {
+      uint32_t n = pool_batch_size(pool);
+
+      while (--n > 0 && pool->depot_objects > 0) {
+        _Chain_Prepend_unprotected(&magazine->objects, pool_depot_get(pool));
+        ++magazine->count;
+      }
+    }
+
+    _ISR_lock_Release(&pool->lock, &depot_lock_context);
+  }
+
+  if (object != NULL) {
+    ++magazine->gets;
+  }
+
+  pool_magazine_release(magazine, level, &lock_context);
+
+  return object;
+}
+
+static bool pool_may_allocate_from_workspace(void)
+{
+  return !_System_state_Is_up(_System_state_Get())
+    || _Thread_Dispatch_is_enabled();
+}
+
+/*
+ * The RTEMS Workspace is protected by the allocator lock.  Before the system
+ * is up there is no executing thread to own it and no other thread to
+ * contend for it.
+ */
+static void *pool_workspace_allocate(size_t size)
+{
+  bool is_up = _System_state_Is_up(_System_state_Get());
+  void *p;
+
+  if (is_up) {
+    _RTEMS_Lock_allocator();
+  }
+
+  p = _Workspace_Allocate(size);
+
+  if (is_up) {
+    _RTEMS_Unlock_allocator();
+  }
+
+  return p;
+}
+
+static void pool_workspace_free(void *p)
+{
+  bool is_up = _System_state_Is_up(_System_state_Get());
+
+  if (is_up) {
+    _RTEMS_Lock_allocator();
+  }
+
+  _Workspace_Free(p);
+
+  if (is_up) {
+    _RTEMS_Unlock_allocator();
+  }
+}
+
+/*
+ * The objects of the extension are reserved under the pool lock before the
+ * allocation, so that concurrent extensions cannot exceed the maximum object
+ * count.  The first object of the extension is returned to the caller.
+ */
+static void *pool_extend(rtems_pool_control *pool)
+{
+  uint32_t n = pool->extend_count;
+  size_t header_size = pool_block_header_size();
+  ISR_lock_Context lock_context;
+  Chain_Node *block;
+  char *begin;
+
+  if (n == 0 || !pool_may_allocate_from_workspace()) {
+    return NULL;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+
+  if (pool->maximum_objects != 0) {
+    uint32_t available = pool->maximum_objects - pool->objects;
+
+    if (n > available) {
+      n = available;
+    }
+  }
+
+  pool->objects += n;
+
+  _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+
+  if (n == 0) {
+    return NULL;
+  }
+
+  block = pool_workspace_allocate(header_size + n * pool->object_size);
+
+  _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+
+  if (block != NULL) {
+    begin = (char *) block + header_size;
+
+    _Chain_Append_unprotected(&pool->blocks, block);
+    pool_depot_add(pool, begin + pool->object_size, n - 1);
+    ++pool->extends;
+    ++pool->gets;
+  } else {
+    begin = NULL;
+    pool->objects -= n;
+  }
+
+  _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+
+  return begin;
+}
+
+rtems_status_code rtems_pool_initialize(
+  rtems_pool_control *pool,
+  const rtems_pool_config *config
+)
+{
+  size_t object_size;
+  uint32_t count;
+
+  if (pool == NULL || config == NULL) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if (config->object_size == 0) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  object_size = config->object_size;
+
+  if (object_size < sizeof(Chain_Node)) {
+    object_size = sizeof(Chain_Node);
+  }
+
+  object_size = align_up(CPU_ALIGNMENT, object_size);
+
+  if (
+    config->extend_count > (SIZE_MAX - pool_block_header_size()) / object_size
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if (
+    config->area_begin != NULL
+      && config->area_size > UINTPTR_MAX - (uintptr_t) config->area_begin
+  ) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  memset(pool, 0, sizeof(*pool));
+  pool->object_size = object_size;
+  pool->extend_count = config->extend_count;
+  pool->maximum_objects = config->maximum_objects;
+  pool->magazine_size = config->magazine_size;
+
+  if (pool->magazine_size > 0) {
+    uint32_t magazine_count = rtems_configuration_get_maximum_processors();
+    uint32_t i;
+
+    pool->magazines =
+      pool_workspace_allocate(magazine_count * sizeof(*pool->magazines));
+    if (pool->magazines == NULL) {
+      return RTEMS_NO_MEMORY;
+    }
+
+    memset(pool->magazines, 0, magazine_count * sizeof(*pool->magazines));
+
+    for (i = 0; i < magazine_count; ++i) {
+      rtems_pool_magazine *magazine = &pool->magazines[i];
+
+      _ISR_lock_Initialize(&magazine->lock, "Pool Magazine");
+      _Chain_Initialize_empty(&magazine->objects);
+    }
+
+    pool->magazine_count = magazine_count;
+  }
+
+  _Freechain_Initialize(&pool->depot, pool_depot_extend_never);
+  _ISR_lock_Initialize(&pool->lock, "Pool");
+  _Chain_Initialize_empty(&pool->blocks);
+
+  if (config->area_begin != NULL) {
+    uintptr_t area_begin = (uintptr_t) config->area_begin;
+    uintptr_t area_end = area_begin + config->area_size;
+    uintptr_t begin = align_up(CPU_ALIGNMENT, area_begin);
+
+    if (begin < area_end && begin >= area_begin) {
+      count = (uint32_t) ((area_end - begin) / object_size);
+
+      if (pool->maximum_objects != 0 && count > pool->maximum_objects) {
+        count = pool->maximum_objects;
+      }
+
+      pool_depot_add(pool, (char *) begin, count);
+      pool->objects = count;
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_pool_destroy(rtems_pool_control *pool)
+{
+  ISR_lock_Context lock_context;
+  bool in_use;
+  uint32_t i;
+
+  rtems_pool_flush(pool);
+
+  _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+  in_use = pool->depot_objects != pool->objects;
+  _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+
+  if (in_use) {
+    return RTEMS_RESOURCE_IN_USE;
+  }
+
+  while (!_Chain_Is_empty(&pool->blocks)) {
+    pool_workspace_free(_Chain_Get_first_unprotected(&pool->blocks));
+  }
+
+  for (i = 0; i < pool->magazine_count; ++i) {
+    _ISR_lock_Destroy(&pool->magazines[i].lock);
+  }
+
+  pool_workspace_free(pool->magazines);
+  _ISR_lock_Destroy(&pool->lock);
+  memset(pool, 0, sizeof(*pool));
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void *rtems_pool_get(rtems_pool_control *pool)
+{
+  ISR_lock_Context lock_context;
+  void *object;
+
+  if (pool->magazines != NULL) {
+    object = pool_magazine_get(pool);
+  } else {
+    _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+
+    object = pool_depot_get(pool);
+
+    if (object != NULL) {
+      ++pool->gets;
+    }
+
+    _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+  }
+
+  if (object == NULL) {
+    object = pool_extend(pool);
+
+    if (object == NULL) {
+      _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+      ++pool->failed_gets;
+      _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+    }
+  }
+
+  return object;
+}
+
+void rtems_pool_put(rtems_pool_control *pool, void *object)
+{
+  if (pool->magazines != NULL) {
+    rtems_pool_magazine *magazine;
+    ISR_Level level;
+    ISR_lock_Context lock_context;
+
+    magazine = pool_magazine_acquire(pool, &level, &lock_context);
+
+    if (magazine->count >= pool->magazine_size) {
+      ISR_lock_Context depot_lock_context;
+
+      _ISR_lock_Acquire(&pool->lock, &depot_lock_context);
+      pool_magazine_to_depot(pool, magazine, pool_batch_size(pool));
+      _ISR_lock_Release(&pool->lock, &depot_lock_context);
+    }
+
+    _Chain_Prepend_unprotected(&magazine->objects, object);
+    ++magazine->count;
+    ++magazine->puts;
+
+    pool_magazine_release(magazine, level, &lock_context);
+  } else {
+    ISR_lock_Context lock_context;
+
+    _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+    pool_depot_put(pool, object);
+    ++pool->puts;
+    _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+  }
+}
+
+void rtems_pool_flush(rtems_pool_control *pool)
+{
+  uint32_t i;
+
+  for (i = 0; i < pool->magazine_count; ++i) {
+    rtems_pool_magazine *magazine = &pool->magazines[i];
+    ISR_lock_Context lock_context;
+    ISR_lock_Context depot_lock_context;
+
+    _ISR_lock_ISR_disable_and_acquire(&magazine->lock, &lock_context);
+    _ISR_lock_Acquire(&pool->lock, &depot_lock_context);
+    pool_magazine_to_depot(pool, magazine, magazine->count);
+    _ISR_lock_Release(&pool->lock, &depot_lock_context);
+    _ISR_lock_Release_and_ISR_enable(&magazine->lock, &lock_context);
+  }
+}
+
+void rtems_pool_get_statistics(
+  rtems_pool_control *pool,
+  rtems_pool_statistics *statistics
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t i;
+
+  memset(statistics, 0, sizeof(*statistics));
+
+  for (i = 0; i < pool->magazine_count; ++i) {
+    rtems_pool_magazine *magazine = &pool->magazines[i];
+
+    _ISR_lock_ISR_disable_and_acquire(&magazine->lock, &lock_context);
+
+    statistics->free_objects += magazine->count;
+    statistics->gets += magazine->gets;
+    statistics->magazine_hits += magazine->hits;
+    statistics->puts += magazine->puts;
+
+    _ISR_lock_Release_and_ISR_enable(&magazine->lock, &lock_context);
+  }
+
+  _ISR_lock_ISR_disable_and_acquire(&pool->lock, &lock_context);
+
+  statistics->objects = pool->objects;
+  statistics->free_objects += pool->depot_objects;
+  statistics->gets += pool->gets;
+  statistics->puts += pool->puts;
+  statistics->extends = pool->extends;
+  statistics->failed_gets = pool->failed_gets;
+
+  _ISR_lock_Release_and_ISR_enable(&pool->lock, &lock_context);
+}
@@ -19,6 +19,7 @@
 #ifndef _RTEMS_SCORE_COREMSG_H
 #define _RTEMS_SCORE_COREMSG_H
 
+#include <rtems/score/atomic.h>
 #include <rtems/score/chain.h>
 #include <rtems/score/threadq.h>
 #include <rtems/score/watchdog.h>
@@ -118,8 +119,50 @@ typedef enum {
 typedef struct {
   /** This field specifies the order in which blocking tasks will be ordered. */
   CORE_message_queue_Disciplines  discipline;
+  /** This field indicates that the message queue has exactly one sender and
+   *  exactly one receiver.  The messages are passed through a lock-free
+   *  ring buffer in this case, see @ref CORE_message_queue_Ring.
+   */
+  bool                            single_producer_single_consumer;
 }   CORE_message_queue_Attributes;
 
+/**
+ *  @brief Lock-free ring buffer of a single producer single consumer
+ *  message queue.
+ *
+ *  The producer owns the tail index and the consumer owns the head index.
+ *  The ring has one slot more than the maximum count of pending messages to
+ *  distinguish a full from an empty ring.  The slots are the message buffers
+ *  of the message queue in array order.
+ *
+ *  The thread queue of the message queue is only used in case the consumer
+ *  blocks on an empty ring.  It announces this via the consumer waiting
+ *  indicator, so that the producer must use the thread queue only in this
+ *  case.
+ *
+ *  Producer and consumer operations register themselves under protection of
+ *  the thread queue lock, so that the message buffers are not freed while
+ *  they access the ring with interrupts enabled.
+ */
+typedef struct {
+  /** This field is the index of the next slot to receive from. */
+  Atomic_Uint head;
+  /** This field is the index of the next slot to send to. */
+  Atomic_Uint tail;
+  /** This field indicates that the consumer is about to block or blocked. */
+  Atomic_Uint consumer_waiting;
+  /** This field is the count of slots of the ring. */
+  uint32_t    slot_count;
+  /** This field is the count of registered producer and consumer
+   *  operations.
+   */
+  Atomic_Uint users;
+  /** This field indicates that the message queue is closed.  It is protected
+   *  by the thread queue lock.
+   */
+  bool        closed;
+}   CORE_message_queue_Ring;
+
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
   /**
    *  @brief Type for a notification handler.
@@ -153,6 +196,11 @@ typedef struct {
   /** This element is the number of messages which are currently pending.
    */
   uint32_t                           number_of_pending_messages;
+  /** This element is the number of message buffers which are currently
+   *  on loan to the application, see _CORE_message_queue_Obtain_buffer() and
+   *  _CORE_message_queue_Seize_buffer().
+   */
+  uint32_t                           number_of_loaned_messages;
   /** This is the size in bytes of the largest message which may be
    *  sent via this queue.
    */
@@ -166,6 +214,10 @@ typedef struct {
    *  as part of destroying it.
    */
   CORE_message_queue_Buffer         *message_buffers;
+  /** This is the size in bytes of one message buffer including its
+   *  control.  The message buffers are contiguous in memory.
+   */
+  size_t                             message_buffer_size;
   #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
     /** This is the routine invoked when the message queue transitions
      *  from zero (0) messages pending to one (1) message pending.
@@ -178,6 +230,10 @@ typedef struct {
    *  when it does not contain a pending message.
    */
   Chain_Control                      Inactive_messages;
+  /** This is the ring buffer used by single producer single consumer
+   *  message queues.  It is unused otherwise.
+   */
+  CORE_message_queue_Ring            Ring;
 }   CORE_message_queue_Control;
 
 /**@}*/
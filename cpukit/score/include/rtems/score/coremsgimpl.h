@@ -24,6 +24,7 @@
 #include <rtems/score/threadqimpl.h>
 
 #include <limits.h>
+#include <stddef.h>
 #include <string.h>
 
 #ifdef __cplusplus
@@ -352,6 +353,326 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ *  @brief Obtains a message buffer on loan from the message queue.
+ *
+ *  The message buffer is taken from the pool of inactive messages of the
+ *  message queue.  The caller may fill in the message contents in place and
+ *  either send the buffer via _CORE_message_queue_Submit_buffer() or return
+ *  it via _CORE_message_queue_Release_buffer().  This routine may be used in
+ *  interrupt context.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *
+ *  @retval NULL No message buffer is available.
+ *  @retval buffer The message buffer on loan.
+ */
+CORE_message_queue_Buffer_control *_CORE_message_queue_Obtain_buffer(
+  CORE_message_queue_Control *the_message_queue
+);
+
+/**
+ *  @brief Sends a message buffer on loan to the message queue.
+ *
+ *  In case a thread waits to receive a message buffer on loan, then the
+ *  message buffer is handed over to this thread.  In case a thread waits
+ *  to receive a copy of the message, then the message is copied to this
+ *  thread and the message buffer is returned to the pool.  Otherwise, the
+ *  message buffer is placed on the queue of pending messages without a copy
+ *  operation.  In case of an error the message buffer remains on loan.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is a message buffer on loan from this message
+ *         queue
+ *  @param[in] size is the size of the message contents
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *         It is used when unblocking a remote thread.
+ *  @param[in] api_message_queue_mp_support is the routine to invoke if
+ *         a thread that is unblocked is actually a remote thread.
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ *
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL The message was sent.
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE The message is too big.
+ */
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  Objects_Id                                 id,
+  CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  CORE_message_queue_Submit_types            submit_type
+);
+
+/**
+ *  @brief Receives a message buffer on loan from the message queue.
+ *
+ *  This routine works like _CORE_message_queue_Seize(), however, the
+ *  message is not copied.  Instead, the message buffer itself is lent to
+ *  the caller, who must return it via _CORE_message_queue_Release_buffer().
+ *
+ *  Since a message buffer on loan may stay away from the pool for an
+ *  unbounded time, threads blocked on a full message queue waiting to send
+ *  are unblocked with CORE_MESSAGE_QUEUE_STATUS_TOO_MANY.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing is the executing thread
+ *  @param[in] id is the RTEMS object Id associated with this message queue
+ *  @param[out] message_p is a pointer to the message buffer on loan.  In
+ *         case the thread blocks, then the message buffer is delivered
+ *         through this pointer by the thread which sends the message.
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] timeout is the maximum number of clock ticks that the calling
+ *         thread is willing to block if the message queue is empty.
+ *
+ *  @note The status is returned via the executing thread's
+ *        Wait.return_code like in _CORE_message_queue_Seize().
+ */
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  Objects_Id                          id,
+  CORE_message_queue_Buffer_control **message_p,
+  bool                                wait,
+  Watchdog_Interval                   timeout
+);
+
+/**
+ *  @brief Returns a message buffer on loan to the pool of the message queue.
+ *
+ *  This routine may be used in interrupt context.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is a message buffer on loan from this message
+ *         queue
+ */
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+);
+
+/**
+ *  @brief Sends a batch of messages to the message queue.
+ *
+ *  The messages are handed over to waiting receivers first.  The remaining
+ *  messages are copied into message buffers allocated from the pool of
+ *  inactive messages in one critical section and placed on the queue of
+ *  pending messages in another one.  The sender never blocks.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] buffer is the starting address of the messages to send.  The
+ *         message with index i starts at @a buffer plus i times the maximum
+ *         message size of the message queue.
+ *  @param[in] sizes is the array of message sizes
+ *  @param[in] count is the count of messages to send
+ *  @param[out] sent_p is the count of messages actually sent
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *         It is used when unblocking a remote thread.
+ *  @param[in] api_message_queue_mp_support is the routine to invoke if
+ *         a thread that is unblocked is actually a remote thread.
+ *  @param[in] submit_type determines whether the messages are prepended,
+ *         appended, or enqueued in priority order.
+ *
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL All messages were sent.
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE At least one message is
+ *          too big, no message was sent.
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_TOO_MANY Not all messages were sent.
+ */
+CORE_message_queue_Status _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control                *the_message_queue,
+  const void                                *buffer,
+  const size_t                              *sizes,
+  uint32_t                                   count,
+  uint32_t                                  *sent_p,
+  Objects_Id                                 id,
+  CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  CORE_message_queue_Submit_types            submit_type
+);
+
+/**
+ *  @brief Receives a batch of messages from the message queue.
+ *
+ *  Up to @a max_count pending messages are removed from the message queue
+ *  in one critical section, copied to the destination buffer and returned
+ *  to the pool of inactive messages.  In case the message queue is empty
+ *  and @a wait is true, then the thread blocks until a single message
+ *  arrives, like in _CORE_message_queue_Seize().
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing is the executing thread
+ *  @param[in] id is the RTEMS object Id associated with this message queue
+ *  @param[in] buffer is the starting address of the destination buffer.  The
+ *         message with index i is stored at @a buffer plus i times the
+ *         maximum message size of the message queue.
+ *  @param[out] sizes is the array of received message sizes
+ *  @param[in] max_count is the maximum count of messages to receive
+ *  @param[out] count_p is the count of received messages.  In case the
+ *         thread blocks, it is set to one in advance.
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] timeout is the maximum number of clock ticks that the calling
+ *         thread is willing to block if the message queue is empty.
+ *
+ *  @note The status is returned via the executing thread's
+ *        Wait.return_code like in _CORE_message_queue_Seize().
+ */
+void _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control      *the_message_queue,
+  Thread_Control                  *executing,
+  Objects_Id                       id,
+  void                            *buffer,
+  size_t                          *sizes,
+  uint32_t                         max_count,
+  uint32_t                        *count_p,
+  bool                             wait,
+  Watchdog_Interval                timeout
+);
+
+/**
+ *  @brief Sends a message to a single producer single consumer message queue.
+ *
+ *  The message is copied into the next free slot of the ring buffer without
+ *  the Giant lock, without thread queue operations and with interrupts
+ *  enabled.  Only in case the consumer announced that it is about to block,
+ *  thread dispatching is disabled and the consumer is unblocked via the
+ *  thread queue.  This routine may be used in interrupt context.
+ *
+ *  The caller must register the operation via
+ *  _CORE_message_queue_SPSC_Enter_critical() before.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] buffer is the starting address of the message to send
+ *  @param[in] size is the size of the message being send
+ *
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL The message was sent.
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE The message is too big.
+ *  @retval CORE_MESSAGE_QUEUE_STATUS_TOO_MANY The ring buffer is full.
+ */
+CORE_message_queue_Status _CORE_message_queue_SPSC_Submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size
+);
+
+/**
+ *  @brief Receives a message from a single producer single consumer message
+ *  queue.
+ *
+ *  In case a message is available, then it is copied out of the ring buffer
+ *  without the Giant lock, without thread queue operations and with
+ *  interrupts enabled.  Otherwise, the executing thread blocks on the thread
+ *  queue of the message queue if wait is true.  In case the executing thread
+ *  is unblocked and the ring buffer is still empty, then it blocks again for
+ *  the remaining timeout.
+ *
+ *  The caller must register the operation via
+ *  _CORE_message_queue_SPSC_Enter_critical() before.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing is the executing thread
+ *  @param[in] id is the RTEMS object Id associated with this message queue
+ *  @param[in] buffer is the starting address of the message buffer to
+ *         to be filled in with a message
+ *  @param[out] size_p is a pointer to the size of the received message
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] timeout is the maximum number of clock ticks that the calling
+ *         thread is willing to block if the message queue is empty.
+ *
+ *  @note The status is returned via the executing thread's
+ *        Wait.return_code like in _CORE_message_queue_Seize().
+ */
+void _CORE_message_queue_SPSC_Seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  Objects_Id                  id,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Watchdog_Interval           timeout
+);
+
+/**
+ *  @brief Registers a producer or consumer operation on a single producer
+ *  single consumer message queue.
+ *
+ *  The thread queue lock must be acquired.  The message buffers stay valid
+ *  until the operation is unregistered via _CORE_message_queue_SPSC_Leave().
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *
+ *  @retval true The operation is registered.
+ *  @retval false The message queue is closed.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_SPSC_Enter_critical(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Ring *ring = &the_message_queue->Ring;
+
+  if ( ring->closed ) {
+    return false;
+  }
+
+  _Atomic_Fetch_add_uint( &ring->users, 1U, ATOMIC_ORDER_RELAXED );
+
+  return true;
+}
+
+/**
+ *  @brief Unregisters a producer or consumer operation on a single producer
+ *  single consumer message queue.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_SPSC_Leave(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  /*
+   *  The release order pairs with the acquire load in
+   *  _CORE_message_queue_SPSC_Has_users(), so that all accesses to the ring
+   *  are done before the message buffers are freed.
+   */
+  _Atomic_Fetch_sub_uint(
+    &the_message_queue->Ring.users,
+    1U,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/**
+ *  @brief Closes a single producer single consumer message queue.
+ *
+ *  The thread queue lock must be acquired.  No further operations can be
+ *  registered afterwards and a consumer will no longer block.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_SPSC_Close_critical(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  the_message_queue->Ring.closed = true;
+}
+
+/**
+ *  @brief Returns true if producer or consumer operations are registered on
+ *  a single producer single consumer message queue, otherwise false.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_SPSC_Has_users(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  return _Atomic_Load_uint(
+    &the_message_queue->Ring.users,
+    ATOMIC_ORDER_ACQUIRE
+  ) != 0U;
+}
+
 /**
  * This routine sends a message to the end of the specified message queue.
  */
@@ -442,6 +763,85 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * This function returns the message buffer on loan which contains the
+ * message contents at @a buffer.  It returns NULL in case @a buffer is not
+ * the contents of a message buffer of the_message_queue or in case this
+ * message buffer is not on loan.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_loaned_message(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  uintptr_t                          offset;
+
+  offset = (uintptr_t) buffer
+    - offsetof( CORE_message_queue_Buffer_control, Contents.buffer )
+    - (uintptr_t) the_message_queue->message_buffers;
+
+  if (
+    offset >= the_message_queue->maximum_pending_messages
+      * the_message_queue->message_buffer_size
+      || offset % the_message_queue->message_buffer_size != 0
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer_control *)
+    ( (char *) the_message_queue->message_buffers + offset );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
+/**
+ * This function delivers a message to a thread waiting to receive.  In case
+ * the thread waits for a message buffer on loan, then a message buffer is
+ * obtained from the pool and the message is copied to it.  It returns false
+ * in case no message buffer is available.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Copy_to_receiver(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *the_thread,
+  const void                 *buffer,
+  size_t                      size
+)
+{
+  void                              *destination;
+  CORE_message_queue_Buffer_control *the_message;
+
+  destination = the_thread->Wait.return_argument_second.mutable_object;
+
+  if ( destination != NULL ) {
+    _CORE_message_queue_Copy_buffer( buffer, destination, size );
+    *(size_t *) the_thread->Wait.return_argument = size;
+    return true;
+  }
+
+  the_message = _CORE_message_queue_Obtain_buffer( the_message_queue );
+  *(CORE_message_queue_Buffer_control **) the_thread->Wait.return_argument =
+    the_message;
+
+  if ( the_message == NULL ) {
+    the_thread->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED;
+    return false;
+  }
+
+  the_message->Contents.size = size;
+  _CORE_message_queue_Copy_buffer(
+    buffer,
+    the_message->Contents.buffer,
+    size
+  );
+  return true;
+}
+
 /**
  * This function returns the priority of @a the_message.
  *
@@ -500,6 +900,69 @@ RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_priority(
     (the_attribute->discipline == CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY);
 }
 
+/**
+ * This function returns true if the_message_queue uses the lock-free
+ * ring buffer for a single producer and a single consumer.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_single_producer_single_consumer(
+  const CORE_message_queue_Attributes *the_attribute
+)
+{
+  return the_attribute->single_producer_single_consumer;
+}
+
+/**
+ * This function returns the slot of the ring buffer with the given index.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Ring_slot(
+  const CORE_message_queue_Control *the_message_queue,
+  unsigned int                      index
+)
+{
+  return (CORE_message_queue_Buffer_control *)
+    ( (char *) the_message_queue->message_buffers
+      + index * the_message_queue->message_buffer_size );
+}
+
+/**
+ * This function returns the ring buffer index following the given index.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _CORE_message_queue_Ring_next(
+  const CORE_message_queue_Control *the_message_queue,
+  unsigned int                      index
+)
+{
+  ++index;
+
+  return index != the_message_queue->Ring.slot_count ? index : 0;
+}
+
+/**
+ * This function returns the count of messages pending on the_message_queue.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _CORE_message_queue_Get_number_of_pending_messages(
+  const CORE_message_queue_Control *the_message_queue
+)
+{
+  const CORE_message_queue_Ring *ring = &the_message_queue->Ring;
+  unsigned int head;
+  unsigned int tail;
+
+  if (
+    !_CORE_message_queue_Is_single_producer_single_consumer(
+      &the_message_queue->Attributes
+    )
+  ) {
+    return the_message_queue->number_of_pending_messages;
+  }
+
+  head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+  tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+
+  return tail >= head ? tail - head : tail + ring->slot_count - head;
+}
+
 /**
  * This routine places the_message at the rear of the outstanding
  * messages on the_message_queue.
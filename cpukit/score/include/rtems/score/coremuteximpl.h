@@ -129,12 +129,16 @@ CORE_mutex_Status _CORE_mutex_Initialize(
  *
  *  @param[in,out] executing The currently executing thread.
  *  @param[in,out] the_mutex is the mutex to attempt to lock
- *  @param[in] level is the interrupt level
+ *  @param[in,out] lock_context is the lock context of the thread queue
+ *         lock.  The thread queue lock must be acquired with this lock
+ *         context.
  *
  *  @retval This routine returns 0 if "trylock" can resolve whether or not
  *  the mutex is immediately obtained or there was an error attempting to
- *  get it.  It returns 1 to indicate that the caller cannot obtain
- *  the mutex and will have to block to do so.
+ *  get it.  In this case the interrupt state is restored.  It returns 1 to
+ *  indicate that the caller cannot obtain the mutex and will have to block
+ *  to do so.  In this case the thread queue lock is still held and
+ *  interrupts are still disabled.
  *
  *  @note  For performance reasons, this routine is implemented as
  *         a macro that uses two support routines.
@@ -143,7 +147,7 @@ CORE_mutex_Status _CORE_mutex_Initialize(
 RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
   CORE_mutex_Control  *the_mutex,
   Thread_Control      *executing,
-  ISR_Level            level
+  ISR_lock_Context    *lock_context
 );
 
 #if defined(__RTEMS_DO_NOT_INLINE_CORE_MUTEX_SEIZE__)
@@ -156,12 +160,12 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
    *  which makes it harder to get full binary test coverage.
    *
    *  @param[in] the_mutex will attempt to lock
-   *  @param[in] level_p is the interrupt level
+   *  @param[in] lock_context is the lock context of the thread queue lock
    */
   int _CORE_mutex_Seize_interrupt_trylock(
     CORE_mutex_Control  *the_mutex,
     Thread_Control      *executing,
-    ISR_Level            level
+    ISR_lock_Context    *lock_context
   );
 #else
   /**
@@ -169,10 +173,12 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
    *  a few instructions.  This is very important for mutex performance.
    *
    *  @param[in] _mutex will attempt to lock
-   *  @param[in] _level is the interrupt level
+   *  @param[in] _lock_context is the lock context of the thread queue lock
    */
-  #define _CORE_mutex_Seize_interrupt_trylock( _mutex, _executing, _level ) \
-     _CORE_mutex_Seize_interrupt_trylock_body( _mutex, _executing, _level )
+  #define _CORE_mutex_Seize_interrupt_trylock( \
+    _mutex, _executing, _lock_context ) \
+     _CORE_mutex_Seize_interrupt_trylock_body( \
+       _mutex, _executing, _lock_context )
 #endif
 
 /**
@@ -223,8 +229,7 @@ void _CORE_mutex_Seize_interrupt_blocking(
  *  @param[in] _id is the Id of the owning API level Semaphore object
  *  @param[in] _wait is true if the thread is willing to wait
  *  @param[in] _timeout is the maximum number of ticks to block
- *  @param[in] _level is a temporary variable used to contain the ISR
- *         disable level cookie
+ *  @param[in] _lock_context is the lock context used to disable interrupts
  *
  *  @note If the mutex is called from an interrupt service routine,
  *        with context switching disabled, or before multitasking,
@@ -245,7 +250,7 @@ RTEMS_INLINE_ROUTINE void _CORE_mutex_Seize_body(
   Objects_Id           id,
   bool                 wait,
   Watchdog_Interval    timeout,
-  ISR_Level            level
+  ISR_lock_Context    *lock_context
 )
 {
   if ( _CORE_mutex_Check_dispatch_for_seize( wait ) ) {
@@ -255,17 +260,21 @@ RTEMS_INLINE_ROUTINE void _CORE_mutex_Seize_body(
       INTERNAL_ERROR_MUTEX_OBTAIN_FROM_BAD_STATE
     );
   }
-  if ( _CORE_mutex_Seize_interrupt_trylock( the_mutex, executing, level ) ) {
+  _Thread_queue_Acquire_critical( &the_mutex->Wait_queue, lock_context );
+  if (
+    _CORE_mutex_Seize_interrupt_trylock( the_mutex, executing, lock_context )
+  ) {
     if ( !wait ) {
-      _ISR_Enable( level );
+      _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
       executing->Wait.return_code =
         CORE_MUTEX_STATUS_UNSATISFIED_NOWAIT;
     } else {
       _Thread_queue_Enter_critical_section( &the_mutex->Wait_queue );
       executing->Wait.queue = &the_mutex->Wait_queue;
       executing->Wait.id = id;
+      _Thread_queue_Release_critical( &the_mutex->Wait_queue, lock_context );
       _Thread_Disable_dispatch();
-      _ISR_Enable( level );
+      _ISR_lock_ISR_enable( lock_context );
       _CORE_mutex_Seize_interrupt_blocking( the_mutex, executing, timeout );
     }
   }
@@ -278,8 +287,7 @@ RTEMS_INLINE_ROUTINE void _CORE_mutex_Seize_body(
  *  @param[in] _id is the Id of the owning API level Semaphore object
  *  @param[in] _wait is true if the thread is willing to wait
  *  @param[in] _timeout is the maximum number of ticks to block
- *  @param[in] _level is a temporary variable used to contain the ISR
- *         disable level cookie
+ *  @param[in] _lock_context is the lock context used to disable interrupts
  */
 #if defined(__RTEMS_DO_NOT_INLINE_CORE_MUTEX_SEIZE__)
   void _CORE_mutex_Seize(
@@ -288,11 +296,13 @@ RTEMS_INLINE_ROUTINE void _CORE_mutex_Seize_body(
     Objects_Id           _id,
     bool                 _wait,
     Watchdog_Interval    _timeout,
-    ISR_Level            _level
+    ISR_lock_Context    *_lock_context
   );
 #else
-  #define _CORE_mutex_Seize( _executing, _mtx, _id, _wait, _timeout, _level ) \
-     _CORE_mutex_Seize_body( _executing, _mtx, _id, _wait, _timeout, _level )
+  #define _CORE_mutex_Seize( \
+      _executing, _mtx, _id, _wait, _timeout, _lock_context ) \
+     _CORE_mutex_Seize_body( \
+       _executing, _mtx, _id, _wait, _timeout, _lock_context )
 #endif
 
 /**
@@ -436,10 +446,10 @@ RTEMS_INLINE_ROUTINE bool _CORE_mutex_Is_priority_ceiling(
 RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
   CORE_mutex_Control  *the_mutex,
   Thread_Control      *executing,
-  ISR_Level            level
+  ISR_lock_Context    *lock_context
 )
 {
-  /* disabled when you get here */
+  /* disabled and thread queue lock acquired when you get here */
 
   executing->Wait.return_code = CORE_MUTEX_STATUS_SUCCESSFUL;
   if ( !_CORE_mutex_Is_locked( the_mutex ) ) {
@@ -458,7 +468,7 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
     }
 
     if ( !_CORE_mutex_Is_priority_ceiling( &the_mutex->Attributes ) ) {
-      _ISR_Enable( level );
+      _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
       return 0;
     } /* else must be CORE_MUTEX_DISCIPLINES_PRIORITY_CEILING
        *
@@ -472,13 +482,14 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
       ceiling = the_mutex->Attributes.priority_ceiling;
       current = executing->current_priority;
       if ( current == ceiling ) {
-        _ISR_Enable( level );
+        _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
         return 0;
       }
 
       if ( current > ceiling ) {
+        _Thread_queue_Release_critical( &the_mutex->Wait_queue, lock_context );
         _Thread_Disable_dispatch();
-        _ISR_Enable( level );
+        _ISR_lock_ISR_enable( lock_context );
         _Thread_Change_priority(
           executing,
           ceiling,
@@ -492,7 +503,7 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
         the_mutex->holder = NULL;
         the_mutex->nest_count = 0;     /* undo locking above */
         executing->resource_count--;   /* undo locking above */
-        _ISR_Enable( level );
+        _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
         return 0;
       }
     }
@@ -508,12 +519,12 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
     switch ( the_mutex->Attributes.lock_nesting_behavior ) {
       case CORE_MUTEX_NESTING_ACQUIRES:
         the_mutex->nest_count++;
-        _ISR_Enable( level );
+        _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
         return 0;
       #if defined(RTEMS_POSIX_API)
         case CORE_MUTEX_NESTING_IS_ERROR:
           executing->Wait.return_code = CORE_MUTEX_STATUS_NESTING_NOT_ALLOWED;
-          _ISR_Enable( level );
+          _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
           return 0;
       #endif
       case CORE_MUTEX_NESTING_BLOCKS:
@@ -523,11 +534,129 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
 
   /*
    *  The mutex is not available and the caller must deal with the possibility
-   *  of blocking.
+   *  of blocking.  The thread queue lock is still held.
    */
   return 1;
 }
 
+/**
+ *  @brief Attempts to obtain the mutex without the Giant lock.
+ *
+ *  In case the mutex is available or the executing thread may nest its
+ *  access, then the mutex is obtained under protection of the thread queue
+ *  lock only.  The caller must acquire the thread queue lock and check that
+ *  the owner object of the mutex was not deleted after its look up.
+ *
+ *  @param[in,out] the_mutex is the mutex to attempt to lock
+ *  @param[in,out] executing The currently executing thread.
+ *  @param[in] wait is true if the thread is willing to wait
+ *  @param[in,out] lock_context is the lock context used to disable interrupts
+ *         without thread dispatching disabled, e.g. by _Objects_Get_local(),
+ *         and to acquire the thread queue lock.
+ *
+ *  @retval true The seize operation is done.  The thread queue lock is
+ *          released and the interrupt state is restored.
+ *  @retval false The executing thread must block.  The thread queue lock
+ *          is released and interrupts are still disabled.  The caller must
+ *          carry out the seize operation with _CORE_mutex_Seize().  On SMP
+ *          configurations it must disable thread dispatching and check again
+ *          that the owner object was not deleted before.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_mutex_Seize_isr_disable(
+  CORE_mutex_Control  *the_mutex,
+  Thread_Control      *executing,
+  bool                 wait,
+  ISR_lock_Context    *lock_context
+)
+{
+  if (
+    !_Thread_Dispatch_is_enabled()
+      && wait
+      && _System_state_Get() >= SYSTEM_STATE_UP
+  ) {
+    _Terminate(
+      INTERNAL_ERROR_CORE,
+      false,
+      INTERNAL_ERROR_MUTEX_OBTAIN_FROM_BAD_STATE
+    );
+  }
+
+  if (
+    !_CORE_mutex_Seize_interrupt_trylock( the_mutex, executing, lock_context )
+  ) {
+    return true;
+  }
+
+  if ( !wait ) {
+    _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
+    executing->Wait.return_code = CORE_MUTEX_STATUS_UNSATISFIED_NOWAIT;
+    return true;
+  }
+
+  _Thread_queue_Release_critical( &the_mutex->Wait_queue, lock_context );
+  return false;
+}
+
+/**
+ *  @brief Surrenders the mutex without the Giant lock if possible.
+ *
+ *  In case the executing thread holds the mutex, no other thread may wait
+ *  for it and the mutex uses neither priority inheritance nor a priority
+ *  ceiling, then the mutex is surrendered under protection of the thread
+ *  queue lock only.  The caller must acquire the thread queue lock and check
+ *  that the owner object of the mutex was not deleted after its look up.
+ *
+ *  @param[in,out] the_mutex is the mutex to surrender
+ *  @param[in,out] lock_context is the lock context used to disable interrupts
+ *         without thread dispatching disabled, e.g. by _Objects_Get_local(),
+ *         and to acquire the thread queue lock.
+ *
+ *  @retval true The mutex is surrendered.  The thread queue lock is released
+ *          and the interrupt state is restored.
+ *  @retval false The Giant lock is necessary.  The thread queue lock is
+ *          released and interrupts are still disabled.  The caller must
+ *          disable thread dispatching, check again that the owner object was
+ *          not deleted and carry out the surrender operation with
+ *          _CORE_mutex_Surrender().
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_mutex_Surrender_isr_disable(
+  CORE_mutex_Control  *the_mutex,
+  ISR_lock_Context    *lock_context
+)
+{
+  Thread_Control *holder;
+
+  holder = the_mutex->holder;
+
+  if ( _Thread_Is_executing( holder ) ) {
+    if ( the_mutex->nest_count > 1 ) {
+      --the_mutex->nest_count;
+      _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
+      return true;
+    }
+
+    /*
+     *  The priority of the holder may be restored only under protection of
+     *  the Giant lock, so mutexes with priority inheritance or a priority
+     *  ceiling use the Giant lock in any case.
+     */
+    if (
+      the_mutex->nest_count == 1
+        && !_Thread_queue_Are_waiters_possible( &the_mutex->Wait_queue )
+        && !_CORE_mutex_Is_inherit_priority( &the_mutex->Attributes )
+        && !_CORE_mutex_Is_priority_ceiling( &the_mutex->Attributes )
+    ) {
+      the_mutex->nest_count = 0;
+      the_mutex->holder = NULL;
+      _Thread_queue_Release( &the_mutex->Wait_queue, lock_context );
+      return true;
+    }
+  }
+
+  _Thread_queue_Release_critical( &the_mutex->Wait_queue, lock_context );
+  return false;
+}
+
 /** @} */
 
 #ifdef __cplusplus
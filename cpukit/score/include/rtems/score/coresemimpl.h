@@ -196,53 +196,135 @@ RTEMS_INLINE_ROUTINE uint32_t  _CORE_semaphore_Get_count(
 }
 
 /**
- * This routine attempts to receive a unit from the_semaphore.
- * If a unit is available or if the wait flag is false, then the routine
- * returns.  Otherwise, the calling task is blocked until a unit becomes
- * available.
+ * This routine attempts to receive a unit from the_semaphore without the
+ * Giant lock.  The caller must acquire the thread queue lock and check that
+ * the owner object of the semaphore was not deleted after its look up.
  *
  * @param[in] the_semaphore is the semaphore to obtain
  * @param[in,out] executing The currently executing thread.
- * @param[in] id is the Id of the owning API level Semaphore object
  * @param[in] wait is true if the thread is willing to wait
- * @param[in] timeout is the maximum number of ticks to block
- * @param[in] level is a temporary variable used to contain the ISR
- *        disable level cookie
+ * @param[in,out] lock_context is the lock context used to disable interrupts
+ *        without thread dispatching disabled, e.g. by _Objects_Get_local(),
+ *        and to acquire the thread queue lock.
+ *
+ * @retval true A unit was available or the caller is not willing to wait.
+ *         The thread queue lock is released and the interrupt state is
+ *         restored.
+ * @retval false The calling thread must block.  The thread queue lock is
+ *         released and interrupts are still disabled.  The caller must
+ *         disable thread dispatching, check again that the owner object was
+ *         not deleted and block with _CORE_semaphore_Seize_blocking().
  *
  * @note There is currently no MACRO version of this routine.
  */
-RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_isr_disable(
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Seize_isr_disable(
   CORE_semaphore_Control  *the_semaphore,
   Thread_Control          *executing,
-  Objects_Id               id,
   bool                     wait,
-  Watchdog_Interval        timeout,
-  ISR_Level                level
+  ISR_lock_Context        *lock_context
 )
 {
-  /* disabled when you get here */
+  /* disabled and thread queue lock acquired when you get here */
 
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
   if ( the_semaphore->count != 0 ) {
     the_semaphore->count -= 1;
-    _ISR_Enable( level );
-    return;
+    _Thread_queue_Release( &the_semaphore->Wait_queue, lock_context );
+    return true;
   }
 
   if ( !wait ) {
-    _ISR_Enable( level );
+    _Thread_queue_Release( &the_semaphore->Wait_queue, lock_context );
     executing->Wait.return_code = CORE_SEMAPHORE_STATUS_UNSATISFIED_NOWAIT;
+    return true;
+  }
+
+  _Thread_queue_Release_critical( &the_semaphore->Wait_queue, lock_context );
+  return false;
+}
+
+/**
+ * This routine blocks the calling thread on the_semaphore in case still no
+ * unit is available.
+ *
+ * @param[in] the_semaphore is the semaphore to obtain
+ * @param[in,out] executing The currently executing thread.
+ * @param[in] id is the Id of the owning API level Semaphore object
+ * @param[in] timeout is the maximum number of ticks to block
+ * @param[in,out] lock_context is the lock context used to disable
+ *        interrupts.  The interrupt state is restored by this routine.
+ *
+ * Thread dispatching must be disabled.  The Giant lock must be acquired
+ * before the thread queue lock and a unit may be surrendered in the
+ * meantime, so the count is checked again.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_blocking(
+  CORE_semaphore_Control  *the_semaphore,
+  Thread_Control          *executing,
+  Objects_Id               id,
+  Watchdog_Interval        timeout,
+  ISR_lock_Context        *lock_context
+)
+{
+  _Thread_queue_Acquire_critical( &the_semaphore->Wait_queue, lock_context );
+  if ( the_semaphore->count != 0 ) {
+    the_semaphore->count -= 1;
+    _Thread_queue_Release( &the_semaphore->Wait_queue, lock_context );
     return;
   }
 
-  _Thread_Disable_dispatch();
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue          = &the_semaphore->Wait_queue;
   executing->Wait.id             = id;
-  _ISR_Enable( level );
+  _Thread_queue_Release( &the_semaphore->Wait_queue, lock_context );
 
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, executing, timeout );
-  _Thread_Enable_dispatch();
+}
+
+/**
+ * @brief Surrenders a unit to the semaphore without the Giant lock if
+ * possible.
+ *
+ * In case no thread may wait on the semaphore, then the unit is returned to
+ * the semaphore under protection of the thread queue lock only.  The caller
+ * must acquire the thread queue lock and check that the owner object of the
+ * semaphore was not deleted after its look up.
+ *
+ * @param[in] the_semaphore is the semaphore to surrender
+ * @param[in,out] lock_context is the lock context used to disable interrupts
+ *        without thread dispatching disabled, e.g. by _Objects_Get_local(),
+ *        and to acquire the thread queue lock.
+ * @param[out] status is an indication of whether the surrender succeeded or
+ *        failed in case this routine returns true.
+ *
+ * @retval true The surrender operation is done.  The thread queue lock is
+ *         released and the interrupt state is restored.
+ * @retval false A thread may wait on the semaphore.  The thread queue lock
+ *         is released and interrupts are still disabled.  The caller must
+ *         disable thread dispatching, check again that the owner object was
+ *         not deleted and carry out the surrender operation with
+ *         _CORE_semaphore_Surrender().
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Surrender_isr_disable(
+  CORE_semaphore_Control *the_semaphore,
+  ISR_lock_Context       *lock_context,
+  CORE_semaphore_Status  *status
+)
+{
+  if ( !_Thread_queue_Are_waiters_possible( &the_semaphore->Wait_queue ) ) {
+    if ( the_semaphore->count < the_semaphore->Attributes.maximum_count ) {
+      the_semaphore->count += 1;
+      *status = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
+    } else {
+      *status = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
+    }
+
+    _Thread_queue_Release( &the_semaphore->Wait_queue, lock_context );
+    return true;
+  }
+
+  _Thread_queue_Release_critical( &the_semaphore->Wait_queue, lock_context );
+  return false;
 }
 
 /** @} */
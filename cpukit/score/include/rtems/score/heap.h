@@ -41,6 +41,11 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally a two-level segregated fit index may be enabled for a heap via
+ * _Heap_Enable_segregated_fit().  In this case the free block for an
+ * allocation request without alignment and boundary constraints is found in
+ * constant time.
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -323,11 +328,70 @@ typedef struct {
   uint32_t resizes;
 } Heap_Statistics;
 
+/**
+ * @brief Log2 of the second level class count of the segregated fit index.
+ */
+#define HEAP_SEGREGATED_SL_LOG2 3
+
+/**
+ * @brief Second level class count of the segregated fit index.
+ *
+ * Each power of two size range is split into this count of linear sub-ranges.
+ */
+#define HEAP_SEGREGATED_SL_COUNT (1U << HEAP_SEGREGATED_SL_LOG2)
+
+/**
+ * @brief First level class count of the segregated fit index.
+ *
+ * There is one first level class for each power of two size range.
+ */
+#define HEAP_SEGREGATED_FL_COUNT (8 * sizeof( uintptr_t ))
+
+/**
+ * @brief Two-level segregated fit index of the free blocks.
+ *
+ * The free blocks are partitioned into size classes.  The first level class
+ * is the index of the most significant bit of the block size.  The second
+ * level class is given by the next @ref HEAP_SEGREGATED_SL_LOG2 bits.
+ *
+ * The free block list is kept sorted by size class in ascending order.  For
+ * each non-empty class the first block of this class in the free block list
+ * is stored.  Bitmaps indicate the non-empty classes, so that a class with a
+ * block large enough for a request can be found in constant time.
+ *
+ * @see _Heap_Enable_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief Bitmap of the first level classes with at least one free block.
+   */
+  uintptr_t fl_bitmap;
+
+  /**
+   * @brief Bitmaps of the second level classes with at least one free block.
+   */
+  uint8_t sl_bitmap[ HEAP_SEGREGATED_FL_COUNT ];
+
+  /**
+   * @brief First free block of each class in the free block list.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FL_COUNT ][ HEAP_SEGREGATED_SL_COUNT ];
+} Heap_Segregated_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+
+  /**
+   * @brief The segregated fit index of the free blocks.
+   *
+   * In case this is @c NULL, then the free blocks are allocated using the
+   * first fit method.
+   */
+  Heap_Segregated_index *segregated;
+
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
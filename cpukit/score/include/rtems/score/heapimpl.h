@@ -306,6 +306,59 @@ Heap_Block *_Heap_Block_allocate(
   uintptr_t alloc_size
 );
 
+/**
+ * @brief Enables the two-level segregated fit index for the heap @a heap.
+ *
+ * The index is allocated from the heap itself.  All free blocks are sorted
+ * into the index.  Afterwards allocation requests without alignment and
+ * boundary constraints are satisfied in constant time.  Allocation requests
+ * with alignment or boundary constraints start the search at the first
+ * suitable size class.
+ *
+ * This function must be called before the heap is used by other threads.
+ * Calling this function for a heap with an enabled index has no effect.
+ *
+ * Returns @a true if successful, and @c false otherwise.
+ *
+ * @see Heap_Segregated_index.
+ */
+bool _Heap_Enable_segregated_fit( Heap_Control *heap );
+
+/**
+ * @brief Inserts the free block @a block into the free block list of the heap
+ * @a heap with an enabled segregated fit index.
+ *
+ * The block size must be valid.
+ */
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block @a block from the free block list of the heap
+ * @a heap with an enabled segregated fit index.
+ *
+ * The block size must be still valid.
+ */
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Returns the free block of the heap @a heap with an enabled segregated
+ * fit index at which the search for a block of at least @a block_size bytes
+ * should start.
+ *
+ * In case @a good_fit_size is not zero and a non-empty size class exists
+ * which contains only blocks of at least @a good_fit_size bytes, then the
+ * first block of the smallest such class is returned.  Otherwise the first
+ * block of the smallest non-empty size class which may contain a large enough
+ * block is returned, so that a search continuing in the free block list visits
+ * all blocks which are large enough.  Returns the free list tail if no such
+ * block exists.
+ */
+Heap_Block *_Heap_Segregated_search(
+  Heap_Control *heap,
+  uintptr_t block_size,
+  uintptr_t good_fit_size
+);
+
 #ifndef HEAP_PROTECTION
   #define _Heap_Protection_block_initialize( heap, block ) ((void) 0)
   #define _Heap_Protection_block_check( heap, block ) ((void) 0)
@@ -440,6 +493,126 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+RTEMS_INLINE_ROUTINE bool _Heap_Is_segregated_fit(
+  const Heap_Control *heap
+)
+{
+  return heap->segregated != NULL;
+}
+
+/**
+ * @brief Returns the index of the most significant bit set in @a value.
+ *
+ * The @a value must not be zero.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _Heap_Segregated_msb( uintptr_t value )
+{
+  return (unsigned int) ( 8 * sizeof( unsigned long ) - 1 )
+    - (unsigned int) __builtin_clzl( (unsigned long) value );
+}
+
+/**
+ * @brief Maps the block size @a size to the first level class @a fl and the
+ * second level class @a sl of the segregated fit index.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_mapping(
+  uintptr_t size,
+  unsigned int *fl,
+  unsigned int *sl
+)
+{
+  unsigned int msb = _Heap_Segregated_msb( size );
+
+  *fl = msb;
+
+  if ( msb >= HEAP_SEGREGATED_SL_LOG2 ) {
+    *sl = (unsigned int) ( size >> ( msb - HEAP_SEGREGATED_SL_LOG2 ) )
+      & ( HEAP_SEGREGATED_SL_COUNT - 1 );
+  } else {
+    *sl = 0;
+  }
+}
+
+/**
+ * @brief Inserts the free block @a block after @a block_before into the free
+ * block list.
+ *
+ * In case the segregated fit index is enabled, the block is inserted according
+ * to its size class and @a block_before is ignored.  The block size must be
+ * valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert_after(
+  Heap_Control *heap,
+  Heap_Block *block_before,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    _Heap_Free_list_insert_after( block_before, block );
+  }
+}
+
+/**
+ * @brief Replaces the free block @a old_block with @a new_block in the free
+ * block list.
+ *
+ * The size of both blocks must be valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_remove( heap, old_block );
+    _Heap_Segregated_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Removes the free block @a block from the free block list.
+ *
+ * The block size must be still valid.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_remove( heap, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Sets the size of the free block @a block to @a size.
+ *
+ * The previous block of a free block is always used.  In case the segregated
+ * fit index is enabled, the block moves to the free list position of its new
+ * size class.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_insert( heap, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
 RTEMS_INLINE_ROUTINE bool _Heap_Is_aligned(
   uintptr_t value,
   uintptr_t alignment
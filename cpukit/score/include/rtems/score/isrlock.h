@@ -174,6 +174,48 @@ static inline void _ISR_lock_Release_and_ISR_enable(
 #endif
 }
 
+/**
+ * @brief Disables interrupts and saves the previous interrupt state in the ISR
+ * lock context.
+ *
+ * This function can be used in thread and interrupt context.  It may be used
+ * to enter an ISR disabled section in which the lock itself is acquired later
+ * with _ISR_lock_Acquire().  The section may end with
+ * _ISR_lock_Release_and_ISR_enable() or _ISR_lock_ISR_enable().
+ *
+ * @param[in,out] context The local ISR lock context to store the interrupt
+ * state.
+ *
+ * @see _ISR_lock_ISR_enable().
+ */
+static inline void _ISR_lock_ISR_disable( ISR_lock_Context *context )
+{
+#if defined( RTEMS_SMP )
+  _ISR_Disable_without_giant( context->lock_context.isr_level );
+#else
+  _ISR_Disable( context->isr_level );
+#endif
+}
+
+/**
+ * @brief Restores the saved interrupt state of the ISR lock context.
+ *
+ * This function can be used in thread and interrupt context.
+ *
+ * @param[in,out] context The local ISR lock context containing the saved
+ * interrupt state.
+ *
+ * @see _ISR_lock_ISR_disable().
+ */
+static inline void _ISR_lock_ISR_enable( ISR_lock_Context *context )
+{
+#if defined( RTEMS_SMP )
+  _ISR_Enable_without_giant( context->lock_context.isr_level );
+#else
+  _ISR_Enable( context->isr_level );
+#endif
+}
+
 /**
  * @brief Acquires an ISR lock inside an ISR disabled section.
  *
@@ -22,6 +22,7 @@
 #include <rtems/score/object.h>
 #include <rtems/score/apimutex.h>
 #include <rtems/score/isrlevel.h>
+#include <rtems/score/isrlock.h>
 #include <rtems/score/threaddispatch.h>
 
 #ifdef __cplusplus
@@ -166,6 +167,19 @@ typedef struct {
   #endif
   /** This is the maximum length of names. */
   uint16_t          name_length;
+  /**
+   * This is the table of hash buckets of the optional name index.  Each
+   * bucket contains the index of the first object of its hash chain or zero.
+   * It is NULL in case the name index is disabled.
+   */
+  Objects_Maximum  *name_index_buckets;
+  /**
+   * This is the table of hash chain links of the name index indexed by the
+   * object index.  The hash chains are ordered by increasing object index.
+   */
+  Objects_Maximum  *name_index_next;
+  /** This is the count of hash buckets of the name index minus one. */
+  uint32_t          name_index_mask;
   #if defined(RTEMS_MULTIPROCESSING)
     /** This is this object class' method called when extracting a thread. */
     Objects_Thread_queue_Extract_callout extract;
@@ -539,7 +553,8 @@ Objects_Control *_Objects_Get (
  *  @param[in] information points to an object class information block.
  *  @param[in] id is the Id of the object whose name we are locating.
  *  @param[in] location will contain an indication of success or failure.
- *  @param[in] level is the interrupt level being turned.
+ *  @param[out] lock_context is the lock context to store the interrupt
+ *         state.
  *
  *  @retval This method returns one of the values from the
  *          @ref Objects_Name_or_id_lookup_errors enumeration to indicate
@@ -555,7 +570,33 @@ Objects_Control *_Objects_Get_isr_disable(
   Objects_Information *information,
   Objects_Id           id,
   Objects_Locations   *location,
-  ISR_Level           *level
+  ISR_lock_Context    *lock_context
+);
+
+/**
+ * @brief Maps object ids to object control blocks with interrupts disabled.
+ *
+ * In contrast to _Objects_Get_isr_disable() this function does not disable
+ * thread dispatching, so on SMP configurations the Giant lock is not
+ * acquired.  The object must be protected by an object specific ISR lock
+ * which may be acquired with _ISR_lock_Acquire() using the same lock context.
+ *
+ * @param[in] information The object class information block.
+ * @param[in] id The object identifier.
+ * @param[out] location The location of the object.
+ * @param[out] lock_context The lock context to store the interrupt state.
+ *
+ * @retval NULL The object is remote or the identifier is invalid.
+ * Interrupts are not disabled.
+ * @retval object The local object.  Interrupts are disabled and the location
+ * is OBJECTS_LOCAL.  Use _ISR_lock_ISR_enable() or
+ * _ISR_lock_Release_and_ISR_enable() to restore the interrupt state.
+ */
+Objects_Control *_Objects_Get_local(
+  Objects_Information *information,
+  Objects_Id           id,
+  Objects_Locations   *location,
+  ISR_lock_Context    *lock_context
 );
 
 /**
@@ -680,6 +721,34 @@ bool _Objects_Set_name(
   const char          *name
 );
 
+/**
+ *  @brief Inserts an object into the name index.
+ *
+ *  The object must be in the local table and the name index must be
+ *  enabled.  Objects without a name are not indexed.
+ *
+ *  @param[in] information points to an Object Information Table.
+ *  @param[in] the_object is a pointer to an object.
+ */
+void _Objects_Name_index_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
+/**
+ *  @brief Removes an object from the name index.
+ *
+ *  This must be done before the name of the object changes.  Nothing
+ *  happens in case the object is not in the name index.
+ *
+ *  @param[in] information points to an Object Information Table.
+ *  @param[in] the_object is a pointer to an object.
+ */
+void _Objects_Name_index_remove(
+  Objects_Information *information,
+  Objects_Control     *the_object
+);
+
 /**
  *  @brief Removes object from namespace.
  *
@@ -882,6 +951,92 @@ RTEMS_INLINE_ROUTINE void _Objects_Invalidate_Id(
   );
 }
 
+/**
+ * This function returns true if the name index of the object information
+ * is enabled, see CONFIGURE_OBJECT_NAME_INDEX.
+ */
+RTEMS_INLINE_ROUTINE bool _Objects_Has_name_index(
+  const Objects_Information *information
+)
+{
+  return information->name_index_buckets != NULL;
+}
+
+/**
+ * This function returns the name index hash value of an integer name.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  return ( name * 0x9e3779b1U ) >> 16;
+}
+
+/**
+ * This function returns the name index hash value of a string name.  Only
+ * the first @a length characters are significant like in the name
+ * comparison of _Objects_Name_to_id_string().
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      length
+)
+{
+  uint32_t hash = 2166136261U;
+  size_t   i;
+
+  for ( i = 0 ; i < length && name[ i ] != '\0' ; ++i ) {
+    hash = ( hash ^ (unsigned char) name[ i ] ) * 16777619U;
+  }
+
+  return _Objects_Name_index_hash_u32( hash );
+}
+
+/**
+ * This function computes the name index hash value of the_object.  It
+ * returns false in case the object has no name.
+ */
+RTEMS_INLINE_ROUTINE bool _Objects_Name_index_get_hash(
+  const Objects_Information *information,
+  const Objects_Control     *the_object,
+  uint32_t                  *hash
+)
+{
+  #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+    if ( information->is_string ) {
+      if ( the_object->name.name_p == NULL )
+        return false;
+
+      *hash = _Objects_Name_index_hash_string(
+        the_object->name.name_p,
+        information->name_length
+      );
+      return true;
+    }
+  #endif
+
+  if ( the_object->name.name_u32 == 0 )
+    return false;
+
+  *hash = _Objects_Name_index_hash_u32( the_object->name.name_u32 );
+  return true;
+}
+
+/**
+ * This function returns the name index bucket of the_object or NULL in case
+ * the object has no name.
+ */
+RTEMS_INLINE_ROUTINE Objects_Maximum *_Objects_Name_index_get_bucket(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t hash;
+
+  if ( !_Objects_Name_index_get_hash( information, the_object, &hash ) )
+    return NULL;
+
+  return &information->name_index_buckets[ hash & information->name_index_mask ];
+}
+
 /**
  * This function places the_object control pointer and object name
  * in the Local Pointer and Local Name Tables, respectively.
@@ -903,6 +1058,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( _Objects_Has_name_index( information ) )
+    _Objects_Name_index_insert( information, the_object );
 }
 
 /**
@@ -927,6 +1085,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( _Objects_Has_name_index( information ) )
+    _Objects_Name_index_insert( information, the_object );
 }
 
 /**
@@ -953,6 +1114,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( _Objects_Has_name_index( information ) )
+    _Objects_Name_index_insert( information, the_object );
 }
 
 /**
@@ -27,6 +27,7 @@
   #include <rtems/score/smp.h>
   #include <rtems/score/smplock.h>
   #include <rtems/score/timestamp.h>
+  #include <rtems/score/watchdog.h>
 #endif
 
 #ifdef __cplusplus
@@ -41,6 +42,8 @@ extern "C" {
    * processor.
    */
   #if defined( RTEMS_PROFILING )
+    #define PER_CPU_CONTROL_SIZE_LOG2 9
+  #elif defined( RTEMS_SMP_MCS_LOCK )
     #define PER_CPU_CONTROL_SIZE_LOG2 8
   #else
     #define PER_CPU_CONTROL_SIZE_LOG2 7
@@ -230,6 +233,41 @@ typedef struct {
    */
   uint64_t total_interrupt_time;
 #endif /* defined( RTEMS_PROFILING ) */
+
+#if defined( RTEMS_SMP )
+  /**
+   * @brief Count of inter-processor interrupt requests issued by this
+   * processor.
+   *
+   * A request is issued each time this processor posts a thread dispatch
+   * request or a SMP message to another processor.
+   *
+   * This value may overflow.
+   *
+   * @see _Per_CPU_Send_interrupt().
+   */
+  Atomic_Uint ipi_request_count;
+
+  /**
+   * @brief Count of inter-processor interrupts actually sent by this
+   * processor.
+   *
+   * Requests to a processor which has not yet acknowledged a previous
+   * inter-processor interrupt are coalesced with the outstanding interrupt,
+   * so this value is less than or equal to the request count.
+   *
+   * This value may overflow.
+   */
+  Atomic_Uint ipi_send_count;
+
+  /**
+   * @brief Count of inter-processor interrupts received and acknowledged by
+   * this processor.
+   *
+   * This value may overflow.
+   */
+  Atomic_Uint ipi_receive_count;
+#endif /* defined( RTEMS_SMP ) */
 } Per_CPU_Stats;
 
 /**
@@ -345,6 +383,23 @@ typedef struct Per_CPU_Control {
      */
     Atomic_Ulong message;
 
+    /**
+     * @brief Indicates if an inter-processor interrupt is outstanding for
+     * this processor.
+     *
+     * Other processors set this indicator before they send an
+     * inter-processor interrupt.  In case it is already set, then no further
+     * interrupt is sent.  This processor clears the indicator in its
+     * inter-processor interrupt handler before it processes the SMP messages
+     * and the thread dispatch request.  Thus bursts of requests are batched
+     * into a single interrupt.  The indicator is only used for processors in
+     * the PER_CPU_STATE_UP state.
+     *
+     * @see _Per_CPU_Send_interrupt() and
+     * _SMP_Inter_processor_interrupt_handler().
+     */
+    Atomic_Uint ipi_pending;
+
     /**
      * @brief The scheduler context of the scheduler owning this processor.
      */
@@ -364,6 +419,17 @@ typedef struct Per_CPU_Control {
      * _CPU_SMP_Start_processor().
      */
     bool started;
+
+    /**
+     * @brief The ticks based watchdogs armed on this processor.
+     *
+     * The watchdogs are protected by their own lock.  The clock tick
+     * processes them on the processor calling rtems_clock_tick() or on this
+     * processor in case it calls rtems_clock_tick_processor().
+     *
+     * @see _Watchdog_Ticks_get().
+     */
+    Watchdog_Ticks_control *Watchdog_ticks;
   #endif
 
   Per_CPU_Stats Stats;
@@ -529,9 +595,69 @@ static inline bool _Per_CPU_Is_processor_started(
 
 #if defined( RTEMS_SMP )
 
-static inline void _Per_CPU_Send_interrupt( const Per_CPU_Control *cpu )
+/**
+ * @brief Requests an inter-processor interrupt for a processor.
+ *
+ * The actual interrupt is only sent in case no interrupt is outstanding for
+ * the target processor.  The target processor acknowledges the interrupt in
+ * _SMP_Inter_processor_interrupt_handler() before it looks at the thread
+ * dispatch necessary indicator and the SMP messages.  So all requests posted
+ * before the acknowledge are served by the outstanding interrupt.
+ *
+ * A processor which is not yet up may not acknowledge an interrupt, e.g. its
+ * interrupt controller is not initialized.  Interrupts to such a processor
+ * are sent unconditionally and do not use the pending indicator.
+ *
+ * @param[in] cpu The target processor.
+ */
+static inline void _Per_CPU_Send_interrupt( Per_CPU_Control *cpu )
 {
-  _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu ) );
+  /*
+   * SMP messages may be sent with thread dispatching enabled, so use a
+   * snapshot.  The statistics may be attributed to the wrong processor in
+   * this case, but the counters are updated atomically.
+   */
+  Per_CPU_Control *cpu_self = _Per_CPU_Get_snapshot();
+
+  _Atomic_Fetch_add_uint(
+    &cpu_self->Stats.ipi_request_count,
+    1U,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  /*
+   * The caller updated the thread dispatch necessary indicator or the SMP
+   * message bits before.  This fence pairs with the acknowledge in
+   * _SMP_Inter_processor_interrupt_handler().  Either we observe the
+   * acknowledge and send a new interrupt, or the target processor observes
+   * our update while it processes the outstanding interrupt.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  /*
+   * The processor state is read without the state lock.  It changes only
+   * once into the up state, so an outdated value results at most in an
+   * unnecessary interrupt.
+   */
+  if (
+    cpu->state != PER_CPU_STATE_UP
+      || (
+        _Atomic_Load_uint( &cpu->ipi_pending, ATOMIC_ORDER_RELAXED ) == 0U
+          && _Atomic_Exchange_uint(
+            &cpu->ipi_pending,
+            1U,
+            ATOMIC_ORDER_RELAXED
+          ) == 0U
+      )
+  ) {
+    _Atomic_Fetch_add_uint(
+      &cpu_self->Stats.ipi_send_count,
+      1U,
+      ATOMIC_ORDER_RELAXED
+    );
+
+    _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu ) );
+  }
 }
 
 /**
@@ -0,0 +1,149 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerEDFSMP
+ *
+ * @brief EDF SMP Scheduler API
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULEREDFSMP_H
+#define _RTEMS_SCORE_SCHEDULEREDFSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/scheduleredf.h>
+#include <rtems/score/schedulersmp.h>
+#include <rtems/score/rbtree.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup ScoreSchedulerEDFSMP EDF SMP Scheduler
+ *
+ * @ingroup ScoreSchedulerSMP
+ *
+ * This is an implementation of the global earliest deadline first scheduler
+ * (G-EDF).  The processor count ready threads with the earliest deadlines are
+ * scheduled.  Threads without a deadline are background threads and get the
+ * processors left over by the deadline driven threads.  The deadlines are
+ * determined by the Rate Monotonic Manager via the release job operation like
+ * in the uni-processor EDF scheduler.
+ *
+ * The ready threads are kept in a red-black tree ordered by deadline, thus
+ * the insert and extract operations are O(log(count of ready threads)).  The
+ * scheduled chain uses linear insert operations and has at most processor
+ * count entries.
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief Scheduler context specialization for EDF SMP schedulers.
+ */
+typedef struct {
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief The ready threads ordered by deadline.
+   */
+  RBTree_Control Ready;
+} Scheduler_EDF_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for EDF SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief Red-black tree node for the ready queue.
+   */
+  RBTree_Node Node;
+
+  /**
+   * @brief State of the thread with respect to the ready queue.
+   *
+   * This is used to move the initial priority of the thread to the region of
+   * background threads, see _Scheduler_EDF_Update_priority().
+   */
+  Scheduler_EDF_Queue_state queue_state;
+} Scheduler_EDF_SMP_Node;
+
+/**
+ * @brief Entry points for the EDF SMP Scheduler.
+ */
+#define SCHEDULER_EDF_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_EDF_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_EDF_SMP_Yield, \
+    _Scheduler_EDF_SMP_Block, \
+    _Scheduler_EDF_SMP_Unblock, \
+    _Scheduler_EDF_SMP_Change_priority, \
+    _Scheduler_EDF_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_EDF_SMP_Update_priority, \
+    _Scheduler_EDF_Priority_compare, \
+    _Scheduler_EDF_Release_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_SMP_Start_idle \
+    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
+  }
+
+void _Scheduler_EDF_SMP_Initialize( const Scheduler_Control *scheduler );
+
+void _Scheduler_EDF_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+void _Scheduler_EDF_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority
+);
+
+void _Scheduler_EDF_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+void _Scheduler_EDF_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+void _Scheduler_EDF_SMP_Change_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Priority_Control         new_priority,
+  bool                     prepend_it
+);
+
+void _Scheduler_EDF_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULEREDFSMP_H */
@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerWorkStealingSMP
+ *
+ * @brief Work Stealing SMP Scheduler API
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+#define _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+#include <rtems/score/cpuset.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup ScoreSchedulerWorkStealingSMP Work Stealing SMP Scheduler
+ *
+ * @ingroup ScoreSchedulerSMP
+ *
+ * This is a partitioned fixed priority scheduler with thread migration.  Each
+ * processor has its own ready chain ordered by thread priority.  A thread
+ * which becomes ready is placed on the processor it executed last, provided
+ * its affinity set allows this.  It may preempt the thread executing there.
+ * In case another processor of its affinity set executes the idle thread,
+ * then the thread is moved to this processor instead.
+ *
+ * Threads migrate between the ready chains by work stealing.  A processor
+ * whose own ready chain contains only its idle thread steals the highest
+ * priority ready thread of the other processors which is allowed to execute
+ * on it (idle-time stealing).  In addition each processor checks at every
+ * clock tick if another processor has a ready thread of higher priority than
+ * its scheduled thread and steals it in this case (periodic stealing).  Thus a
+ * priority inversion across processors lasts at most one clock tick.
+ *
+ * The scheduling operations only look at the ready chain of the current
+ * processor in the common case.  The ready chains of the other processors are
+ * only inspected in case the current processor runs out of work and at clock
+ * ticks.  In return for this the global fixed priority order is not enforced
+ * at every scheduling decision.
+ *
+ * The idle threads are bound to their processor.  The thread affinity is
+ * honoured for all other threads.
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief Per-processor ready queue of the Work Stealing SMP Scheduler.
+ */
+typedef struct {
+  /**
+   * @brief The ready chain ordered by thread priority.
+   */
+  Chain_Control Ready;
+} Scheduler_work_stealing_SMP_Queue;
+
+/**
+ * @brief Scheduler context specialization for Work Stealing SMP schedulers.
+ */
+typedef struct {
+  Scheduler_SMP_Context             Base;
+  Scheduler_work_stealing_SMP_Queue Queues[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_work_stealing_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for Work Stealing SMP schedulers.
+ *
+ * This is a per thread structure.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief Structure containing affinity set data and size.
+   */
+  CPU_set_Control Affinity;
+
+  /**
+   * @brief Indicates if this node belongs to an idle thread.
+   */
+  bool is_idle;
+} Scheduler_work_stealing_SMP_Node;
+
+/**
+ * @brief Entry points for the Work Stealing SMP Scheduler.
+ */
+#define SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_work_stealing_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_work_stealing_SMP_Yield, \
+    _Scheduler_work_stealing_SMP_Block, \
+    _Scheduler_work_stealing_SMP_Unblock, \
+    _Scheduler_work_stealing_SMP_Change_priority, \
+    _Scheduler_work_stealing_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_work_stealing_SMP_Update_priority, \
+    _Scheduler_priority_Priority_compare, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_work_stealing_SMP_Tick, \
+    _Scheduler_work_stealing_SMP_Start_idle, \
+    _Scheduler_work_stealing_SMP_Get_affinity, \
+    _Scheduler_work_stealing_SMP_Set_affinity \
+  }
+
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+);
+
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+void _Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+void _Scheduler_work_stealing_SMP_Change_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Priority_Control         new_priority,
+  bool                     prepend_it
+);
+
+void _Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority
+);
+
+void _Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+);
+
+/**
+ * @brief Performs the time-slicing and the periodic work stealing.
+ *
+ * The periodic work stealing is done for the processor of the executing
+ * thread.
+ *
+ * @param[in] scheduler The scheduler instance.
+ * @param[in] executing The executing thread of a processor.
+ */
+void _Scheduler_work_stealing_SMP_Tick(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *executing
+);
+
+/**
+ * @brief Starts the idle thread and binds it to its processor.
+ *
+ * @param[in] scheduler The scheduler instance.
+ * @param[in] thread The idle thread.
+ * @param[in] cpu The processor of the idle thread.
+ */
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Per_CPU_Control         *cpu
+);
+
+/**
+ * @brief Get affinity for the work stealing SMP scheduler.
+ *
+ * @param[in] scheduler The scheduler of the thread.
+ * @param[in] thread The associated thread.
+ * @param[in] cpusetsize The size of the cpuset.
+ * @param[in,out] cpuset The associated affinity set.
+ *
+ * @retval true if successful
+ * @retval false if unsuccessful
+ */
+bool _Scheduler_work_stealing_SMP_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+);
+
+/**
+ * @brief Set affinity for the work stealing SMP scheduler.
+ *
+ * The affinity set of an idle thread cannot be changed.
+ *
+ * @param[in] scheduler The scheduler of the thread.
+ * @param[in] thread The associated thread.
+ * @param[in] cpusetsize The size of the cpuset.
+ * @param[in] cpuset Affinity new affinity set.
+ *
+ * @retval true if successful
+ * @retval false if unsuccessful
+ */
+bool _Scheduler_work_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H */
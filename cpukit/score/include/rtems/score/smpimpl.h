@@ -133,6 +133,22 @@ static inline void _SMP_Inter_processor_interrupt_handler( void )
 {
   Per_CPU_Control *cpu_self = _Per_CPU_Get();
 
+  /*
+   * Acknowledge the interrupt before we look at the messages.  Requests
+   * posted after this point trigger a new interrupt, see
+   * _Per_CPU_Send_interrupt().  The thread dispatch necessary indicator is
+   * evaluated on interrupt exit.
+   */
+  _Atomic_Exchange_uint( &cpu_self->ipi_pending, 0U, ATOMIC_ORDER_SEQ_CST );
+  _Atomic_Store_uint(
+    &cpu_self->Stats.ipi_receive_count,
+    _Atomic_Load_uint(
+      &cpu_self->Stats.ipi_receive_count,
+      ATOMIC_ORDER_RELAXED
+    ) + 1U,
+    ATOMIC_ORDER_RELAXED
+  );
+
   if ( _Atomic_Load_ulong( &cpu_self->message, ATOMIC_ORDER_RELAXED ) != 0 ) {
     unsigned long message = _Atomic_Exchange_ulong(
       &cpu_self->message,
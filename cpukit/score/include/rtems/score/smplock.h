@@ -44,12 +44,17 @@ extern "C" {
  * @brief The SMP lock provides mutual exclusion for SMP systems at the lowest
  * level.
  *
- * The SMP lock is implemented as a ticket lock.  This provides fairness in
- * case of concurrent lock attempts.
- *
- * This SMP lock API uses a local context for acquire and release pairs.  Such
- * a context may be used to implement for example the Mellor-Crummey and Scott
- * (MCS) locks in the future.
+ * The SMP lock is implemented as a ticket lock by default.  This provides
+ * fairness in case of concurrent lock attempts.
+ *
+ * This SMP lock API uses a local context for acquire and release pairs.  In
+ * case RTEMS_SMP_MCS_LOCK is defined (configure option
+ * --enable-smp-mcs-lock), then the SMP lock is implemented as a
+ * Mellor-Crummey and Scott (MCS) lock and the local context contains the queue
+ * node.  The MCS lock is fair as well, but each waiting processor spins on its
+ * own queue node and not on a cache line shared by all processors.  Ticket and
+ * MCS locks may also be used directly to select the variant for an individual
+ * lock.
  *
  * @{
  */
@@ -201,6 +206,45 @@ static inline void _SMP_lock_Stats_release_update(
   const SMP_lock_Stats_context *stats_context
 );
 
+/**
+ * @brief Updates the SMP lock statistics after a lock acquisition.
+ *
+ * @param[in,out] stats The SMP lock statistics block.
+ * @param[out] stats_context The SMP lock statistics context.
+ * @param[in] first The lock acquire attempt instant.
+ * @param[in] initial_queue_length The initial queue length of the lock
+ * acquire attempt.
+ */
+#if defined( RTEMS_PROFILING )
+static inline void _SMP_lock_Stats_acquire_update(
+  SMP_lock_Stats *stats,
+  SMP_lock_Stats_context *stats_context,
+  CPU_Counter_ticks first,
+  unsigned int initial_queue_length
+)
+{
+  CPU_Counter_ticks second;
+  CPU_Counter_ticks delta;
+
+  second = _CPU_Counter_read();
+  stats_context->acquire_instant = second;
+  delta = _CPU_Counter_difference( second, first );
+
+  ++stats->usage_count;
+
+  stats->total_acquire_time += delta;
+
+  if ( stats->max_acquire_time < delta ) {
+    stats->max_acquire_time = delta;
+  }
+
+  if ( initial_queue_length >= SMP_LOCK_STATS_CONTENTION_COUNTS ) {
+    initial_queue_length = SMP_LOCK_STATS_CONTENTION_COUNTS - 1;
+  }
+  ++stats->contention_counts[initial_queue_length];
+}
+#endif
+
 /**
  * @brief SMP ticket lock control.
  */
@@ -270,10 +314,7 @@ static inline void _SMP_ticket_lock_Acquire(
   unsigned int now_serving;
 
 #if defined( RTEMS_PROFILING )
-  SMP_lock_Stats *stats = &lock->Stats;
   CPU_Counter_ticks first;
-  CPU_Counter_ticks second;
-  CPU_Counter_ticks delta;
   unsigned int initial_queue_length;
 
   first = _CPU_Counter_read();
@@ -298,22 +339,12 @@ static inline void _SMP_ticket_lock_Acquire(
 #if defined( RTEMS_PROFILING )
   }
 
-  second = _CPU_Counter_read();
-  stats_context->acquire_instant = second;
-  delta = _CPU_Counter_difference( second, first );
-
-  ++stats->usage_count;
-
-  stats->total_acquire_time += delta;
-
-  if ( stats->max_acquire_time < delta ) {
-    stats->max_acquire_time = delta;
-  }
-
-  if ( initial_queue_length >= SMP_LOCK_STATS_CONTENTION_COUNTS ) {
-    initial_queue_length = SMP_LOCK_STATS_CONTENTION_COUNTS - 1;
-  }
-  ++stats->contention_counts[initial_queue_length];
+  _SMP_lock_Stats_acquire_update(
+    &lock->Stats,
+    stats_context,
+    first,
+    initial_queue_length
+  );
 #else
   (void) stats_context;
 #endif
@@ -339,25 +370,230 @@ static inline void _SMP_ticket_lock_Release(
   _Atomic_Store_uint( &lock->now_serving, next_ticket, ATOMIC_ORDER_RELEASE );
 }
 
+/**
+ * @brief SMP MCS lock context.
+ *
+ * This is the queue node of a processor for an acquire and release pair.
+ * Other processors write to this context while it is in the lock queue, so it
+ * must not move or go out of scope until the lock is released.
+ */
+typedef struct {
+  /**
+   * @brief The context of the next processor in the lock queue.
+   *
+   * It is a pointer to an SMP_MCS_lock_Context or NULL.
+   */
+  Atomic_Pointer next;
+
+  /**
+   * @brief The processor waits for the lock as long as this value is not
+   * zero.
+   */
+  Atomic_Uint locked;
+
+  /**
+   * @brief The SMP lock statistics context.
+   */
+  SMP_lock_Stats_context Stats_context;
+} SMP_MCS_lock_Context;
+
+/**
+ * @brief SMP MCS lock control.
+ */
+typedef struct {
+  /**
+   * @brief The last context in the lock queue.
+   *
+   * It is a pointer to an SMP_MCS_lock_Context or NULL in case the lock is
+   * free.
+   */
+  Atomic_Pointer queue;
+
+  SMP_lock_Stats Stats;
+} SMP_MCS_lock_Control;
+
+/**
+ * @brief SMP MCS lock control initializer for static initialization.
+ */
+#define SMP_MCS_LOCK_INITIALIZER( name ) \
+  { \
+    ATOMIC_INITIALIZER_PTR( NULL ), \
+    SMP_LOCK_STATS_INITIALIZER( name ) \
+  }
+
+/**
+ * @brief Initializes an SMP MCS lock.
+ *
+ * Concurrent initialization leads to unpredictable results.
+ *
+ * @param[in,out] lock The SMP MCS lock control.
+ * @param[in] name The name for the SMP MCS lock.  This name must be
+ * persistent throughout the life time of this lock.
+ */
+static inline void _SMP_MCS_lock_Initialize(
+  SMP_MCS_lock_Control *lock,
+  const char *name
+)
+{
+  _Atomic_Init_ptr( &lock->queue, (uintptr_t) NULL );
+  _SMP_lock_Stats_initialize( &lock->Stats, name );
+}
+
+/**
+ * @brief Destroys an SMP MCS lock.
+ *
+ * Concurrent destruction leads to unpredictable results.
+ *
+ * @param[in,out] lock The SMP MCS lock control.
+ */
+static inline void _SMP_MCS_lock_Destroy( SMP_MCS_lock_Control *lock )
+{
+  _SMP_lock_Stats_destroy( &lock->Stats );
+}
+
+/**
+ * @brief Acquires an SMP MCS lock.
+ *
+ * This function will not disable interrupts.  The caller must ensure that the
+ * current thread of execution is not interrupted indefinite once it obtained
+ * the SMP MCS lock.
+ *
+ * In case profiling is enabled, then the lock acquire attempts are accounted
+ * to the first contention counter in case the lock was free and to the second
+ * contention counter otherwise.  The MCS lock does not know the actual queue
+ * length.
+ *
+ * @param[in,out] lock The SMP MCS lock control.
+ * @param[in,out] context The SMP MCS lock context for an acquire and release
+ * pair.
+ */
+static inline void _SMP_MCS_lock_Acquire(
+  SMP_MCS_lock_Control *lock,
+  SMP_MCS_lock_Context *context
+)
+{
+  SMP_MCS_lock_Context *previous;
+
+#if defined( RTEMS_PROFILING )
+  CPU_Counter_ticks first;
+
+  first = _CPU_Counter_read();
+#endif
+
+  _Atomic_Store_ptr( &context->next, (uintptr_t) NULL, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &context->locked, 1U, ATOMIC_ORDER_RELAXED );
+
+  previous = (SMP_MCS_lock_Context *) _Atomic_Exchange_ptr(
+    &lock->queue,
+    (uintptr_t) context,
+    ATOMIC_ORDER_SEQ_CST
+  );
+
+  if ( previous != NULL ) {
+    unsigned int locked;
+
+    _Atomic_Store_ptr(
+      &previous->next,
+      (uintptr_t) context,
+      ATOMIC_ORDER_RELEASE
+    );
+
+    do {
+      locked = _Atomic_Load_uint( &context->locked, ATOMIC_ORDER_ACQUIRE );
+    } while ( locked != 0U );
+  }
+
+#if defined( RTEMS_PROFILING )
+  _SMP_lock_Stats_acquire_update(
+    &lock->Stats,
+    &context->Stats_context,
+    first,
+    previous != NULL ? 1U : 0U
+  );
+#endif
+}
+
+/**
+ * @brief Releases an SMP MCS lock.
+ *
+ * @param[in,out] lock The SMP MCS lock control.
+ * @param[in,out] context The SMP MCS lock context for an acquire and release
+ * pair.
+ */
+static inline void _SMP_MCS_lock_Release(
+  SMP_MCS_lock_Control *lock,
+  SMP_MCS_lock_Context *context
+)
+{
+  SMP_MCS_lock_Context *next;
+
+  _SMP_lock_Stats_release_update( &lock->Stats, &context->Stats_context );
+
+  next = (SMP_MCS_lock_Context *)
+    _Atomic_Load_ptr( &context->next, ATOMIC_ORDER_ACQUIRE );
+
+  if ( next == NULL ) {
+    uintptr_t expected = (uintptr_t) context;
+    bool success = _Atomic_Compare_exchange_ptr(
+      &lock->queue,
+      &expected,
+      (uintptr_t) NULL,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    );
+
+    if ( success ) {
+      return;
+    }
+
+    /*
+     * Another processor enqueued itself, but did not yet link its context to
+     * ours.
+     */
+    do {
+      next = (SMP_MCS_lock_Context *)
+        _Atomic_Load_ptr( &context->next, ATOMIC_ORDER_ACQUIRE );
+    } while ( next == NULL );
+  }
+
+  _Atomic_Store_uint( &next->locked, 0U, ATOMIC_ORDER_RELEASE );
+}
+
 /**
  * @brief SMP lock control.
  */
 typedef struct {
+#if defined( RTEMS_SMP_MCS_LOCK )
+  SMP_MCS_lock_Control mcs_lock;
+#else
   SMP_ticket_lock_Control ticket_lock;
+#endif
 } SMP_lock_Control;
 
 /**
  * @brief Local SMP lock context for acquire and release pairs.
+ *
+ * In case the MCS lock is used, then the context is the queue node of the
+ * lock and must not move or go out of scope during an acquire and release
+ * pair.
  */
 typedef struct {
   ISR_Level isr_level;
+#if defined( RTEMS_SMP_MCS_LOCK )
+  SMP_MCS_lock_Context MCS_context;
+#else
   SMP_lock_Stats_context Stats_context;
+#endif
 } SMP_lock_Context;
 
 /**
  * @brief SMP lock control initializer for static initialization.
  */
+#if defined( RTEMS_SMP_MCS_LOCK )
+#define SMP_LOCK_INITIALIZER( name ) { SMP_MCS_LOCK_INITIALIZER( name ) }
+#else
 #define SMP_LOCK_INITIALIZER( name ) { SMP_TICKET_LOCK_INITIALIZER( name ) }
+#endif
 
 /**
  * @brief Initializes an SMP lock.
@@ -373,7 +609,11 @@ static inline void _SMP_lock_Initialize(
   const char *name
 )
 {
+#if defined( RTEMS_SMP_MCS_LOCK )
+  _SMP_MCS_lock_Initialize( &lock->mcs_lock, name );
+#else
   _SMP_ticket_lock_Initialize( &lock->ticket_lock, name );
+#endif
 }
 
 /**
@@ -385,7 +625,11 @@ static inline void _SMP_lock_Initialize(
  */
 static inline void _SMP_lock_Destroy( SMP_lock_Control *lock )
 {
+#if defined( RTEMS_SMP_MCS_LOCK )
+  _SMP_MCS_lock_Destroy( &lock->mcs_lock );
+#else
   _SMP_ticket_lock_Destroy( &lock->ticket_lock );
+#endif
 }
 
 /**
@@ -404,8 +648,11 @@ static inline void _SMP_lock_Acquire(
   SMP_lock_Context *context
 )
 {
-  (void) context;
+#if defined( RTEMS_SMP_MCS_LOCK )
+  _SMP_MCS_lock_Acquire( &lock->mcs_lock, &context->MCS_context );
+#else
   _SMP_ticket_lock_Acquire( &lock->ticket_lock, &context->Stats_context );
+#endif
 }
 
 /**
@@ -420,8 +667,11 @@ static inline void _SMP_lock_Release(
   SMP_lock_Context *context
 )
 {
-  (void) context;
+#if defined( RTEMS_SMP_MCS_LOCK )
+  _SMP_MCS_lock_Release( &lock->mcs_lock, &context->MCS_context );
+#else
   _SMP_ticket_lock_Release( &lock->ticket_lock, &context->Stats_context );
+#endif
 }
 
 /**
@@ -286,10 +286,6 @@ typedef struct {
    */
   uint32_t              return_code;
 
-  /** This field is the chain header for the second through Nth tasks
-   *  of the same priority blocked waiting on the same object.
-   */
-  Chain_Control         Block2n;
   /** This field points to the thread queue on which this thread is blocked. */
   Thread_queue_Control *queue;
 }   Thread_Wait_information;
@@ -304,6 +300,10 @@ typedef struct {
 typedef struct {
   /** This field is the object management structure for each proxy. */
   Objects_Control          Object;
+  /** This field is the red-black tree node used for priority thread
+   *  queues.
+   */
+  RBTree_Node              RBNode;
   /** This field is the current execution state of this proxy. */
   States_Control           current_state;
   /** This field is the current priority state of this proxy. */
@@ -483,6 +483,10 @@ typedef struct {
 struct Thread_Control_struct {
   /** This field is the object management structure for each thread. */
   Objects_Control          Object;
+  /** This field is the red-black tree node used for priority thread
+   *  queues.
+   */
+  RBTree_Node              RBNode;
   /** This field is the current execution state of this thread. */
   States_Control           current_state;
   /** This field is the current priority state of this thread. */
@@ -20,6 +20,8 @@
 #define _RTEMS_SCORE_THREADQ_H
 
 #include <rtems/score/chain.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/threadsync.h>
 
@@ -47,22 +49,6 @@ typedef enum {
   THREAD_QUEUE_DISCIPLINE_PRIORITY  /* PRIORITY queue discipline */
 }   Thread_queue_Disciplines;
 
-/**
- *  This is one of the constants used to manage the priority queues.
- *
- *  There are four chains used to maintain a priority -- each chain
- *  manages a distinct set of task priorities.  The number of chains
- *  is determined by TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS.
- *  The following set must be consistent.
- *
- *  The set below configures 4 headers -- each contains 64 priorities.
- *  Header x manages priority range (x*64) through ((x*64)+63).  If
- *  the priority is more than half way through the priority range it
- *  is in, then the search is performed from the rear of the chain.
- *  This halves the search time to find the insertion point.
- */
-#define TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS 4
-
 /**
  *  This is the structure used to manage sets of tasks which are blocked
  *  waiting to acquire a resource.
@@ -74,11 +60,25 @@ typedef struct {
   union {
     /** This is the FIFO discipline list. */
     Chain_Control Fifo;
-    /** This is the set of lists for priority discipline waiting. */
-    Chain_Control Priority[TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS];
+    /** This is the red-black tree for priority discipline waiting.  Threads
+     *  of equal priority are ordered FIFO.
+     */
+    RBTree_Control Priority;
   } Queues;
   /** This field is used to manage the critical section. */
   Thread_blocking_operation_States sync_state;
+  /** This lock protects the state of the thread queue owner which may be
+   *  accessed without the Giant lock, e.g. the count of a semaphore, and
+   *  the waiters possible indicator.
+   */
+  ISR_lock_Control         Lock;
+  /** This field is true if threads may wait on this thread queue.  It is
+   *  set with the lock held in case a thread enters the critical section to
+   *  block on this thread queue.  It is cleared in case a dequeue operation
+   *  found no thread.  While it is false an owner operation protected only
+   *  by the lock is not required to unblock a thread.
+   */
+  bool                     waiters_possible;
   /** This field indicates the thread queue's blocking discipline. */
   Thread_queue_Disciplines discipline;
   /** This indicates the blocking state for threads waiting on this
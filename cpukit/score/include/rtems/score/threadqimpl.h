@@ -36,18 +36,6 @@ extern "C" {
  */
 #define THREAD_QUEUE_WAIT_FOREVER  WATCHDOG_NO_TIMEOUT
 
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_PRIORITIES_PER_HEADER      64
-
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_REVERSE_SEARCH_MASK        0x20
-
 /**
  *  The following type defines the callout used when a remote task
  *  is extracted from a local thread queue.
@@ -227,8 +215,7 @@ Thread_Control *_Thread_queue_Dequeue_priority(
  *          well as filling in *@ level_p with the previous interrupt level.
  *
  *  - INTERRUPT LATENCY:
- *    + forward less than
- *    + forward equal
+ *    + single case
  */
 Thread_blocking_operation_States _Thread_queue_Enqueue_priority (
   Thread_queue_Control *the_thread_queue,
@@ -377,33 +364,90 @@ void _Thread_queue_Process_timeout(
 );
 
 /**
- * This function returns the index of the priority chain on which
- * a thread of the_priority should be placed.
+ * @brief Compares the current priorities of two threads for the red-black
+ * tree of a priority thread queue.
+ *
+ * @param[in] left The red-black tree node of the first thread.
+ * @param[in] right The red-black tree node of the second thread.
+ *
+ * @retval 1 The first thread has a numerically greater priority value, thus
+ *   it has a lower priority than the second thread.
+ * @retval 0 The threads have the same priority.
+ * @retval -1 The first thread has a numerically lesser priority value, thus
+ *   it has a higher priority than the second thread.
+ */
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+);
+
+/**
+ * @brief Disables interrupts and acquires the lock of the thread queue.
+ *
+ * @param[in] the_thread_queue The thread queue.
+ * @param[in,out] lock_context The lock context for the acquire and release
+ * pair.
  */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Acquire(
+  Thread_queue_Control *the_thread_queue,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_ISR_disable_and_acquire( &the_thread_queue->Lock, lock_context );
+}
 
-RTEMS_INLINE_ROUTINE uint32_t   _Thread_queue_Header_number (
-  Priority_Control the_priority
+/**
+ * @brief Acquires the lock of the thread queue inside an ISR disabled
+ * section.
+ *
+ * @param[in] the_thread_queue The thread queue.
+ * @param[in,out] lock_context The lock context for the acquire and release
+ * pair.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Acquire_critical(
+  Thread_queue_Control *the_thread_queue,
+  ISR_lock_Context     *lock_context
 )
 {
-  return (the_priority / TASK_QUEUE_DATA_PRIORITIES_PER_HEADER);
+  _ISR_lock_Acquire( &the_thread_queue->Lock, lock_context );
 }
 
 /**
- * This function returns true if the_priority indicates that the
- * enqueue search should start at the front of this priority
- * group chain, and false if the search should start at the rear.
+ * @brief Releases the lock of the thread queue.  The interrupt status
+ * remains unchanged.
+ *
+ * @param[in] the_thread_queue The thread queue.
+ * @param[in,out] lock_context The lock context of the acquire.
  */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Release_critical(
+  Thread_queue_Control *the_thread_queue,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release( &the_thread_queue->Lock, lock_context );
+}
 
-RTEMS_INLINE_ROUTINE bool _Thread_queue_Is_reverse_search (
-  Priority_Control the_priority
+/**
+ * @brief Releases the lock of the thread queue and restores the interrupt
+ * status saved in the lock context.
+ *
+ * @param[in] the_thread_queue The thread queue.
+ * @param[in,out] lock_context The lock context of the acquire.
+ */
+RTEMS_INLINE_ROUTINE void _Thread_queue_Release(
+  Thread_queue_Control *the_thread_queue,
+  ISR_lock_Context     *lock_context
 )
 {
-  return ( the_priority & TASK_QUEUE_DATA_REVERSE_SEARCH_MASK );
+  _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, lock_context );
 }
 
 /**
  * This routine is invoked to indicate that the specified thread queue is
  * entering a critical section.
+ *
+ * Owners which access their state without the Giant lock must call this
+ * routine with the thread queue lock held.
  */
 
 RTEMS_INLINE_ROUTINE void _Thread_queue_Enter_critical_section (
@@ -411,6 +455,23 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Enter_critical_section (
 )
 {
   the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED;
+  the_thread_queue->waiters_possible = true;
+}
+
+/**
+ * @brief Returns true if threads may wait on the thread queue.
+ *
+ * The caller must hold the thread queue lock.  In case this function returns
+ * false, then no thread waits on the thread queue and no thread is in the
+ * process to block on it.
+ *
+ * @param[in] the_thread_queue The thread queue.
+ */
+RTEMS_INLINE_ROUTINE bool _Thread_queue_Are_waiters_possible(
+  const Thread_queue_Control *the_thread_queue
+)
+{
+  return the_thread_queue->waiters_possible;
 }
 
 /**@}*/
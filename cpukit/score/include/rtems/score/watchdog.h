@@ -21,6 +21,7 @@
 #define _RTEMS_SCORE_WATCHDOG_H
 
 #include <rtems/score/object.h>
+#include <rtems/score/isrlock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +94,96 @@ typedef enum {
   WATCHDOG_REMOVE_IT
 } Watchdog_States;
 
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+/**
+ *  @brief Number of index bits of the innermost timing wheel level.
+ */
+#define WATCHDOG_WHEEL_ROOT_BITS 8
+
+/**
+ *  @brief Number of index bits of each outer timing wheel level.
+ */
+#define WATCHDOG_WHEEL_LEVEL_BITS 6
+
+/**
+ *  @brief Number of outer timing wheel levels.
+ *
+ *  The innermost level and the outer levels together cover the complete
+ *  range of the @ref Watchdog_Interval type.
+ */
+#define WATCHDOG_WHEEL_LEVELS 4
+
+#define WATCHDOG_WHEEL_ROOT_SIZE ( 1U << WATCHDOG_WHEEL_ROOT_BITS )
+
+#define WATCHDOG_WHEEL_ROOT_MASK ( WATCHDOG_WHEEL_ROOT_SIZE - 1U )
+
+#define WATCHDOG_WHEEL_LEVEL_SIZE ( 1U << WATCHDOG_WHEEL_LEVEL_BITS )
+
+#define WATCHDOG_WHEEL_LEVEL_MASK ( WATCHDOG_WHEEL_LEVEL_SIZE - 1U )
+
+/**
+ *  @brief Hierarchical timing wheel.
+ *
+ *  The innermost level has one slot for each of the next
+ *  @ref WATCHDOG_WHEEL_ROOT_SIZE ticks.  Each outer level has slots of
+ *  increasing granularity.  Watchdogs of an outer level slot are cascaded
+ *  into the next inner level once the innermost level wraps around.  Thus
+ *  insert and remove operations are O(1) independent of the number of
+ *  pending watchdogs.
+ */
+typedef struct {
+  /** This field is the next tick which will be processed. */
+  Watchdog_Interval current;
+  /** These are the innermost level slots, one for each tick. */
+  Chain_Control     Root[ WATCHDOG_WHEEL_ROOT_SIZE ];
+  /** These are the outer level slots. */
+  Chain_Control     Levels[ WATCHDOG_WHEEL_LEVELS ][ WATCHDOG_WHEEL_LEVEL_SIZE ];
+} Watchdog_Wheel;
+#endif
+
+/**
+ *  @brief Synchronization of a set of watchdogs.
+ *
+ *  The lock protects the watchdogs of a set, e.g. a delta chain or a timing
+ *  wheel.  An insert operation on a delta chain temporarily releases the
+ *  lock while it walks along the chain.  It restarts the walk in case the
+ *  generation changed in the meantime.
+ */
+typedef struct {
+  /** This field is the lock protecting the watchdogs of the set. */
+  ISR_lock_Control   Lock;
+  /** This field is incremented by each modification of the set which
+   *  invalidates a walk along the set.
+   */
+  volatile uint32_t  generation;
+} Watchdog_Sync_control;
+
+/**
+ *  @brief Control block of the ticks based watchdogs.
+ *
+ *  Depending on the configuration this is either a delta chain or a
+ *  hierarchical timing wheel.  On SMP configurations each processor has its
+ *  own ticks based watchdogs with an own lock.
+ */
+typedef struct {
+  /** This field is the synchronization of the ticks based watchdogs. */
+  Watchdog_Sync_control  Sync;
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  /** This field is the timing wheel of the ticks based watchdogs. */
+  Watchdog_Wheel         Wheel;
+#else
+  /** This field is the delta chain of the ticks based watchdogs. */
+  Chain_Control          Chain;
+#endif
+#if defined(RTEMS_SMP)
+  /** This field is true if the processor owning these watchdogs processes
+   *  the clock ticks in its own clock interrupt, see
+   *  rtems_clock_tick_processor().
+   */
+  bool                   local_tick;
+#endif
+} Watchdog_Ticks_control;
+
 /**
  *  @brief The control block used to manage each watchdog timer.
  *
@@ -122,6 +213,21 @@ typedef struct {
    *  watchdog handler routine.
    */
   void                           *user_data;
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  /** This field is the timing wheel on which this watchdog resides or NULL
+   *  in case it is on a delta chain or off all chains.
+   */
+  Watchdog_Wheel                 *wheel;
+  /** This field is the absolute tick of the timing wheel at which this
+   *  watchdog fires.
+   */
+  Watchdog_Interval               expire;
+#endif
+  /** This field is the synchronization of the set of watchdogs on which
+   *  this watchdog was inserted last.  It is NULL if the watchdog was never
+   *  inserted.
+   */
+  Watchdog_Sync_control          *sync;
 }   Watchdog_Control;
 
 /**@}*/
@@ -21,6 +21,8 @@
 
 #include <rtems/score/watchdog.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/threaddispatch.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,20 +71,12 @@ typedef enum {
 } Watchdog_Adjust_directions;
 
 /**
- *  @brief Watchdog synchronization level.
+ *  @brief Watchdog synchronization of the global watchdog chains.
  *
- *  This used for synchronization purposes
- *  during an insert on a watchdog delta chain.
+ *  This is the synchronization of the seconds watchdog chain and the
+ *  watchdog chains of the timer server.
  */
-SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_level;
-
-/**
- *  @brief Watchdog synchronization count.
- *
- *  This used for synchronization purposes
- *  during an insert on a watchdog delta chain.
- */
-SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_count;
+SCORE_EXTERN Watchdog_Sync_control _Watchdog_Sync;
 
 /**
  *  @brief The number of ticks since the system was booted.
@@ -92,12 +86,22 @@ SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_count;
 
 SCORE_EXTERN volatile Watchdog_Interval _Watchdog_Ticks_since_boot;
 
+#if defined(RTEMS_SMP)
+/**
+ *  @brief Ticks based watchdogs of each processor.
+ *
+ *  This table is instantiated by <rtems/confdefs.h> with one entry for each
+ *  configured processor.
+ */
+extern Watchdog_Ticks_control _Watchdog_Ticks_per_CPU[];
+#else
 /**
- *  @brief Watchdog chain which is managed at ticks.
+ *  @brief Watchdogs which are managed at ticks.
  *
- *  This is the watchdog chain which is managed at ticks.
+ *  This is the watchdog chain or timing wheel which is managed at ticks.
  */
-SCORE_EXTERN Chain_Control _Watchdog_Ticks_chain;
+SCORE_EXTERN Watchdog_Ticks_control _Watchdog_Ticks;
+#endif
 
 /**
  *  @brief Watchdog chain which is managed at second boundaries.
@@ -128,6 +132,22 @@ Watchdog_States _Watchdog_Remove (
   Watchdog_Control *the_watchdog
 );
 
+/**
+ *  @brief Removes @a the_watchdog from the watchdog set protected by
+ *  @a sync.
+ *
+ *  The lock of @a sync must be held by the caller and @a the_watchdog must
+ *  belong to the set.
+ *
+ *  @param[in] sync is the synchronization of the watchdog set
+ *  @param[in] the_watchdog will be removed
+ *  @retval the state in which @a the_watchdog was in when removed
+ */
+Watchdog_States _Watchdog_Remove_locked (
+  Watchdog_Sync_control *sync,
+  Watchdog_Control      *the_watchdog
+);
+
 /**
  *  @brief Adjusts the @a header watchdog chain in the forward
  *  or backward @a direction for @a units ticks.
@@ -135,11 +155,13 @@ Watchdog_States _Watchdog_Remove (
  *  This routine adjusts the @a header watchdog chain in the forward
  *  or backward @a direction for @a units ticks.
  *
+ *  @param[in] sync is the synchronization of @a header
  *  @param[in] header is the watchdog chain to adjust
  *  @param[in] direction is the direction to adjust @a header
  *  @param[in] units is the number of units to adjust @a header
  */
 void _Watchdog_Adjust (
+  Watchdog_Sync_control      *sync,
   Chain_Control              *header,
   Watchdog_Adjust_directions  direction,
   Watchdog_Interval           units
@@ -152,6 +174,7 @@ void _Watchdog_Adjust (
  *  This routine adjusts the @a header watchdog chain in the forward
  *  @a direction for @a units_arg ticks.
  *
+ *  @param[in] sync is the synchronization of @a header
  *  @param[in] header is the watchdog chain to adjust
  *  @param[in] units_arg is the number of units to adjust @a header
  *  @param[in] to_fire is a pointer to an initialized Chain_Control to which
@@ -160,6 +183,7 @@ void _Watchdog_Adjust (
  *  @note This always adjusts forward.
  */
 void _Watchdog_Adjust_to_chain(
+  Watchdog_Sync_control       *sync,
   Chain_Control               *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
@@ -174,10 +198,12 @@ void _Watchdog_Adjust_to_chain(
  *  for a time of @a units.
  *  Update the delta interval counters.
  *
+ *  @param[in] sync is the synchronization of @a header
  *  @param[in] header is @a the_watchdog list to insert @a the_watchdog on
  *  @param[in] the_watchdog is the watchdog to insert
  */
 void _Watchdog_Insert (
+  Watchdog_Sync_control *sync,
   Chain_Control         *header,
   Watchdog_Control      *the_watchdog
 );
@@ -190,12 +216,256 @@ void _Watchdog_Insert (
  *  the @a header watchdog chain.
  *  This routine decrements the delta counter in response to a tick.
  *
+ *  @param[in] sync is the synchronization of @a header
  *  @param[in] header is the watchdog chain to tickle
  */
 void _Watchdog_Tickle (
-  Chain_Control *header
+  Watchdog_Sync_control *sync,
+  Chain_Control         *header
 );
 
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+/**
+ *  @brief Initializes the @a wheel watchdog timing wheel.
+ *
+ *  All slots of the timing wheel are emptied and the current tick is set to
+ *  zero.
+ *
+ *  @param[in] wheel is the timing wheel to initialize
+ */
+void _Watchdog_Wheel_initialize(
+  Watchdog_Wheel *wheel
+);
+
+/**
+ *  @brief Inserts @a the_watchdog into the @a wheel timing wheel
+ *  for a time of @a the_watchdog->initial ticks.
+ *
+ *  In contrast to @ref _Watchdog_Insert() this operation has a constant
+ *  execution time independent of the number of pending watchdogs.
+ *
+ *  @param[in] sync is the synchronization of @a wheel
+ *  @param[in] wheel is the timing wheel to insert @a the_watchdog on
+ *  @param[in] the_watchdog is the watchdog to insert
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Sync_control *sync,
+  Watchdog_Wheel        *wheel,
+  Watchdog_Control      *the_watchdog
+);
+
+/**
+ *  @brief This routine is invoked at each clock tick to advance the
+ *  @a wheel timing wheel by one tick.
+ *
+ *  The watchdogs of outer levels are cascaded into the inner levels if
+ *  necessary and all watchdogs expiring at the current tick are fired.
+ *
+ *  @param[in] sync is the synchronization of @a wheel
+ *  @param[in] wheel is the timing wheel to tickle
+ */
+void _Watchdog_Wheel_tickle(
+  Watchdog_Sync_control *sync,
+  Watchdog_Wheel        *wheel
+);
+
+/**
+ * This routine places THE_WATCHDOG into the slot of WHEEL which
+ * corresponds to its expiration tick.  The lock of the timing wheel must
+ * be held.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Wheel_enqueue(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  Watchdog_Interval  expire = the_watchdog->expire;
+  Watchdog_Interval  delta = expire - wheel->current;
+  Chain_Control     *slot;
+
+  if ( delta < WATCHDOG_WHEEL_ROOT_SIZE ) {
+    slot = &wheel->Root[ expire & WATCHDOG_WHEEL_ROOT_MASK ];
+  } else {
+    unsigned int level = 0;
+    unsigned int shift = WATCHDOG_WHEEL_ROOT_BITS;
+
+    while (
+      level < WATCHDOG_WHEEL_LEVELS - 1
+        && ( delta >> ( shift + WATCHDOG_WHEEL_LEVEL_BITS ) ) != 0
+    ) {
+      ++level;
+      shift += WATCHDOG_WHEEL_LEVEL_BITS;
+    }
+
+    slot = &wheel->Levels[ level ][
+      ( expire >> shift ) & WATCHDOG_WHEEL_LEVEL_MASK
+    ];
+  }
+
+  _Chain_Append_unprotected( slot, &the_watchdog->Node );
+}
+#endif
+
+/**
+ * This routine initializes the synchronization SYNC of a set of watchdogs.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Sync_initialize(
+  Watchdog_Sync_control *sync
+)
+{
+
+  _ISR_lock_Initialize( &sync->Lock, "Watchdog" );
+  sync->generation = 0;
+
+}
+
+/**
+ * This routine disables interrupts and acquires the lock of SYNC.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Sync_acquire(
+  Watchdog_Sync_control *sync,
+  ISR_lock_Context      *lock_context
+)
+{
+
+  _ISR_lock_ISR_disable_and_acquire( &sync->Lock, lock_context );
+
+}
+
+/**
+ * This routine releases the lock of SYNC and restores the interrupt status.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Sync_release(
+  Watchdog_Sync_control *sync,
+  ISR_lock_Context      *lock_context
+)
+{
+
+  _ISR_lock_Release_and_ISR_enable( &sync->Lock, lock_context );
+
+}
+
+/**
+ * This routine temporarily releases the lock of SYNC and enables interrupts.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Sync_flash(
+  Watchdog_Sync_control *sync,
+  ISR_lock_Context      *lock_context
+)
+{
+
+  _ISR_lock_Release_and_ISR_enable( &sync->Lock, lock_context );
+  _ISR_lock_ISR_disable_and_acquire( &sync->Lock, lock_context );
+
+}
+
+/**
+ * This routine invokes the service ROUTINE of an expired watchdog.  The
+ * lock of the watchdog set must not be held.  On SMP configurations the
+ * watchdog sets are processed without the Giant lock, so thread dispatching
+ * is disabled for the service routine.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Fire(
+  Watchdog_Service_routine_entry  routine,
+  Objects_Id                      id,
+  void                           *user_data
+)
+{
+
+#if defined(RTEMS_SMP)
+  _Thread_Disable_dispatch();
+#endif
+
+  ( *routine )( id, user_data );
+
+#if defined(RTEMS_SMP)
+  _Thread_Enable_dispatch();
+#endif
+
+}
+
+/**
+ * This routine returns the ticks based watchdogs of the executing
+ * processor.  On SMP configurations thread dispatching or interrupts must be
+ * disabled.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Ticks_control *_Watchdog_Ticks_get( void )
+{
+
+#if defined(RTEMS_SMP)
+  return _Per_CPU_Get()->Watchdog_ticks;
+#else
+  return &_Watchdog_Ticks;
+#endif
+
+}
+
+/**
+ * This routine initializes the TICKS based watchdogs.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Ticks_initialize(
+  Watchdog_Ticks_control *ticks
+)
+{
+
+  _Watchdog_Sync_initialize( &ticks->Sync );
+
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  _Watchdog_Wheel_initialize( &ticks->Wheel );
+#else
+  _Chain_Initialize_empty( &ticks->Chain );
+#endif
+
+#if defined(RTEMS_SMP)
+  ticks->local_tick = false;
+#endif
+
+}
+
+/**
+ * This routine inserts THE_WATCHDOG into the TICKS based watchdogs for
+ * a time of THE_WATCHDOG->initial ticks.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Ticks_insert(
+  Watchdog_Ticks_control *ticks,
+  Watchdog_Control       *the_watchdog
+)
+{
+
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  _Watchdog_Wheel_insert( &ticks->Sync, &ticks->Wheel, the_watchdog );
+#else
+  _Watchdog_Insert( &ticks->Sync, &ticks->Chain, the_watchdog );
+#endif
+
+}
+
+/**
+ * This routine advances the TICKS based watchdogs by one tick.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Ticks_tickle(
+  Watchdog_Ticks_control *ticks
+)
+{
+
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  _Watchdog_Wheel_tickle( &ticks->Sync, &ticks->Wheel );
+#else
+  _Watchdog_Tickle( &ticks->Sync, &ticks->Chain );
+#endif
+
+}
+
 /**
  * This routine initializes the specified watchdog.  The watchdog is
  * made inactive, the watchdog id and handler routine are set to the
@@ -213,6 +483,10 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Initialize(
   the_watchdog->routine   = routine;
   the_watchdog->id        = id;
   the_watchdog->user_data = user_data;
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  the_watchdog->wheel     = NULL;
+#endif
+  the_watchdog->sync      = NULL;
 }
 
 /**
@@ -259,13 +533,29 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Deactivate(
 
 /**
  * This routine is invoked at each clock tick to update the ticks
- * watchdog chain.
+ * watchdog chain.  On SMP configurations the watchdogs of each processor
+ * are updated with the lock of the processor, except for processors which
+ * process the clock ticks in their own clock interrupt.
  */
 
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_ticks( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Ticks_chain );
+#if defined(RTEMS_SMP)
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Watchdog_Ticks_control *ticks =
+      _Per_CPU_Get_by_index( cpu_index )->Watchdog_ticks;
+
+    if ( !ticks->local_tick ) {
+      _Watchdog_Ticks_tickle( ticks );
+    }
+  }
+#else
+  _Watchdog_Ticks_tickle( &_Watchdog_Ticks );
+#endif
 
 }
 
@@ -277,7 +567,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_ticks( void )
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_seconds( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Seconds_chain );
+  _Watchdog_Tickle( &_Watchdog_Sync, &_Watchdog_Seconds_chain );
 
 }
 
@@ -296,7 +586,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_ticks(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Ticks_insert( _Watchdog_Ticks_get(), the_watchdog );
 
 }
 
@@ -315,7 +605,11 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_seconds(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Seconds_chain, the_watchdog );
+  _Watchdog_Insert(
+    &_Watchdog_Sync,
+    &_Watchdog_Seconds_chain,
+    the_watchdog
+  );
 
 }
 
@@ -331,13 +625,20 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_seconds(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Seconds_chain, direction, units );
+  _Watchdog_Adjust(
+    &_Watchdog_Sync,
+    &_Watchdog_Seconds_chain,
+    direction,
+    units
+  );
 
 }
 
+#if !defined(RTEMS_WATCHDOG_TIMING_WHEEL)
 /**
  * This routine adjusts the ticks watchdog chain in the forward
- * or backward DIRECTION for UNITS ticks.
+ * or backward DIRECTION for UNITS ticks.  On SMP configurations the
+ * watchdogs of each processor are adjusted.
  */
 
 RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_ticks(
@@ -346,9 +647,27 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_ticks(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Ticks_chain, direction, units );
+#if defined(RTEMS_SMP)
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Watchdog_Ticks_control *ticks =
+      _Per_CPU_Get_by_index( cpu_index )->Watchdog_ticks;
+
+    _Watchdog_Adjust( &ticks->Sync, &ticks->Chain, direction, units );
+  }
+#else
+  _Watchdog_Adjust(
+    &_Watchdog_Ticks.Sync,
+    &_Watchdog_Ticks.Chain,
+    direction,
+    units
+  );
+#endif
 
 }
+#endif
 
 /**
  * This routine resets THE_WATCHDOG timer to its state at INSERT
@@ -364,7 +683,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Reset(
 
   (void) _Watchdog_Remove( the_watchdog );
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Ticks_insert( _Watchdog_Ticks_get(), the_watchdog );
 
 }
 
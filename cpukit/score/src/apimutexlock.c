@@ -26,7 +26,7 @@
 void _API_Mutex_Lock( API_Mutex_Control *the_mutex )
 {
   bool previous_thread_life_protection;
-  ISR_Level level;
+  ISR_lock_Context lock_context;
 
   previous_thread_life_protection = _Thread_Set_life_protection( true );
 
@@ -34,7 +34,7 @@ void _API_Mutex_Lock( API_Mutex_Control *the_mutex )
     _Thread_Disable_dispatch();
   #endif
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable( &lock_context );
 
   _CORE_mutex_Seize(
     &the_mutex->Mutex,
@@ -42,7 +42,7 @@ void _API_Mutex_Lock( API_Mutex_Control *the_mutex )
     the_mutex->Object.id,
     true,
     0,
-    level
+    &lock_context
   );
 
   if ( the_mutex->Mutex.nest_count == 1 ) {
@@ -52,9 +52,12 @@ bool _CORE_message_queue_Initialize(
 {
   size_t message_buffering_required = 0;
   size_t allocated_message_size;
+  size_t buffer_count;
 
+  the_message_queue->Attributes                 = *the_message_queue_attributes;
   the_message_queue->maximum_pending_messages   = maximum_pending_messages;
   the_message_queue->number_of_pending_messages = 0;
+  the_message_queue->number_of_loaned_messages  = 0;
   the_message_queue->maximum_message_size       = maximum_message_size;
   _CORE_message_queue_Set_notify( the_message_queue, NULL, NULL );
 
@@ -77,13 +80,27 @@ bool _CORE_message_queue_Initialize(
   if (allocated_message_size < maximum_message_size)
     return false;
 
+  /*
+   *  The ring of a single producer single consumer message queue needs one
+   *  slot more than the maximum count of pending messages.
+   */
+  buffer_count = (size_t) maximum_pending_messages;
+  if ( the_message_queue_attributes->single_producer_single_consumer ) {
+    buffer_count += 1;
+    if ( buffer_count < maximum_pending_messages )
+      return false;
+  }
+
   /*
    *  Calculate how much total memory is required for message buffering and
    *  check for overflow on the multiplication.
    */
+  the_message_queue->message_buffer_size =
+    allocated_message_size + sizeof( CORE_message_queue_Buffer_control );
+
   if ( !size_t_mult32_with_overflow(
-        (size_t) maximum_pending_messages,
-        allocated_message_size + sizeof(CORE_message_queue_Buffer_control),
+        buffer_count,
+        the_message_queue->message_buffer_size,
         &message_buffering_required ) ) 
     return false;
 
@@ -104,11 +121,18 @@ bool _CORE_message_queue_Initialize(
     &the_message_queue->Inactive_messages,
     the_message_queue->message_buffers,
     (size_t) maximum_pending_messages,
-    allocated_message_size + sizeof( CORE_message_queue_Buffer_control )
+    the_message_queue->message_buffer_size
   );
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
 
+  _Atomic_Init_uint( &the_message_queue->Ring.head, 0 );
+  _Atomic_Init_uint( &the_message_queue->Ring.tail, 0 );
+  _Atomic_Init_uint( &the_message_queue->Ring.consumer_waiting, 0 );
+  the_message_queue->Ring.slot_count = (uint32_t) buffer_count;
+  _Atomic_Init_uint( &the_message_queue->Ring.users, 0 );
+  the_message_queue->Ring.closed = false;
+
   _Thread_queue_Initialize(
     &the_message_queue->Wait_queue,
     _CORE_message_queue_Is_priority( the_message_queue_attributes ) ?
@@ -38,7 +38,6 @@ CORE_message_queue_Status _CORE_message_queue_Broadcast(
 {
   Thread_Control          *the_thread;
   uint32_t                 number_broadcasted;
-  Thread_Wait_information *waitp;
 
   if ( size > the_message_queue->maximum_message_size ) {
     return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
@@ -65,16 +64,16 @@ CORE_message_queue_Status _CORE_message_queue_Broadcast(
   number_broadcasted = 0;
   while ((the_thread =
           _Thread_queue_Dequeue(&the_message_queue->Wait_queue))) {
-    waitp = &the_thread->Wait;
-    number_broadcasted += 1;
-
-    _CORE_message_queue_Copy_buffer(
-      buffer,
-      waitp->return_argument_second.mutable_object,
-      size
-    );
+    if ( !_CORE_message_queue_Copy_to_receiver(
+           the_message_queue,
+           the_thread,
+           buffer,
+           size
+         ) ) {
+      continue;
+    }
 
-    *(size_t *) the_thread->Wait.return_argument = size;
+    number_broadcasted += 1;
 
     #if defined(RTEMS_MULTIPROCESSING)
       if ( !_Objects_Is_local_id( the_thread->Object.id ) )
@@ -29,6 +29,26 @@ uint32_t   _CORE_message_queue_Flush(
   CORE_message_queue_Control *the_message_queue
 )
 {
+  if (
+    _CORE_message_queue_Is_single_producer_single_consumer(
+      &the_message_queue->Attributes
+    )
+  ) {
+    CORE_message_queue_Ring *ring = &the_message_queue->Ring;
+    unsigned int             head;
+    unsigned int             tail;
+
+    /*
+     *  A flush of the ring buffer discards the pending messages on behalf of
+     *  the consumer, thus it must not run concurrently with a receive.
+     */
+    head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+    tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_ACQUIRE );
+    _Atomic_Store_uint( &ring->head, tail, ATOMIC_ORDER_RELEASE );
+
+    return tail >= head ? tail - head : tail + ring->slot_count - head;
+  }
+
   if ( the_message_queue->number_of_pending_messages != 0 )
     return _CORE_message_queue_Flush_support( the_message_queue );
   else
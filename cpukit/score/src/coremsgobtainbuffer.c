@@ -0,0 +1,47 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Obtain Buffer
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+
+CORE_message_queue_Buffer_control *_CORE_message_queue_Obtain_buffer(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  ISR_Level                          level;
+
+  _ISR_Disable( level );
+    the_message = (CORE_message_queue_Buffer_control *)
+      _Chain_Get_unprotected( &the_message_queue->Inactive_messages );
+
+    if ( the_message != NULL ) {
+      /*
+       *  A message buffer on loan is off chain.  This is used to detect
+       *  invalid release and submit requests.
+       */
+      _Chain_Set_off_chain( &the_message->Node );
+      the_message_queue->number_of_loaned_messages += 1;
+    }
+  _ISR_Enable( level );
+
+  return the_message;
+}
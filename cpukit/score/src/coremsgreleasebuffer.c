@@ -0,0 +1,43 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Release Buffer
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  ISR_Level level;
+
+  /*
+   *  No thread waits to send while message buffers are on loan, so the
+   *  message buffer simply goes back to the pool.
+   */
+  _ISR_Disable( level );
+    the_message_queue->number_of_loaned_messages -= 1;
+    _Chain_Append_unprotected(
+      &the_message_queue->Inactive_messages,
+      &the_message->Node
+    );
+  _ISR_Enable( level );
+}
@@ -0,0 +1,88 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Seize Buffer
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  Objects_Id                          id,
+  CORE_message_queue_Buffer_control **message_p,
+  bool                                wait,
+  Watchdog_Interval                   timeout
+)
+{
+  ISR_Level                          level;
+  CORE_message_queue_Buffer_control *the_message;
+
+  executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+  _ISR_Disable( level );
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+    the_message_queue->number_of_loaned_messages += 1;
+    _ISR_Enable( level );
+
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    *message_p = the_message;
+
+    #if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+      /*
+       *  Since there was a pending message, all threads waiting on the
+       *  message queue wait to send.  They must not wait for the return of
+       *  this loan.
+       */
+      if ( _Thread_queue_First( &the_message_queue->Wait_queue ) != NULL ) {
+        _Thread_queue_Flush(
+          &the_message_queue->Wait_queue,
+          NULL,
+          CORE_MESSAGE_QUEUE_STATUS_TOO_MANY
+        );
+      }
+    #endif
+    return;
+  }
+
+  *message_p = NULL;
+
+  if ( !wait ) {
+    _ISR_Enable( level );
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
+    return;
+  }
+
+  /*
+   *  A NULL buffer indicates to the sender that we wait for a message
+   *  buffer on loan.
+   */
+  _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
+  executing->Wait.queue = &the_message_queue->Wait_queue;
+  executing->Wait.id = id;
+  executing->Wait.return_argument_second.mutable_object = NULL;
+  executing->Wait.return_argument = message_p;
+  /* Wait.count will be filled in with the message priority */
+  _ISR_Enable( level );
+
+  _Thread_queue_Enqueue( &the_message_queue->Wait_queue, executing, timeout );
+}
@@ -0,0 +1,157 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Seize Many
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+
+void _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control      *the_message_queue,
+  Thread_Control                  *executing,
+  Objects_Id                       id,
+  void                            *buffer,
+  size_t                          *sizes,
+  uint32_t                         max_count,
+  uint32_t                        *count_p,
+  bool                             wait,
+  Watchdog_Interval                timeout
+)
+{
+  char          *destination = buffer;
+  size_t         stride = the_message_queue->maximum_message_size;
+  uint32_t       count = 0;
+  uint32_t       i;
+  Chain_Control  messages;
+  Chain_Node    *the_node;
+  ISR_Level      level;
+
+  executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+  _Chain_Initialize_empty( &messages );
+
+  _ISR_Disable( level );
+  while ( count < max_count ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    _Chain_Append_unprotected( &messages, &the_message->Node );
+    ++count;
+  }
+
+  if ( count == 0 ) {
+    if ( !wait ) {
+      _ISR_Enable( level );
+      *count_p = 0;
+      executing->Wait.return_code =
+        CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
+      return;
+    }
+
+    /*
+     *  Wait for a single message like _CORE_message_queue_Seize() does.
+     */
+    *count_p = 1;
+    _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
+    executing->Wait.queue = &the_message_queue->Wait_queue;
+    executing->Wait.id = id;
+    executing->Wait.return_argument_second.mutable_object = buffer;
+    executing->Wait.return_argument = &sizes[ 0 ];
+    _ISR_Enable( level );
+
+    _Thread_queue_Enqueue( &the_message_queue->Wait_queue, executing, timeout );
+    return;
+  }
+
+  the_message_queue->number_of_pending_messages -= count;
+  _ISR_Enable( level );
+
+  *count_p = count;
+
+  /*
+   *  Copy the messages with interrupts enabled.  The message buffers are
+   *  private to this thread until they are returned to the pool.
+   */
+  i = 0;
+  the_node = _Chain_First( &messages );
+  while ( !_Chain_Is_tail( &messages, the_node ) ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    the_message = (CORE_message_queue_Buffer_control *) the_node;
+    the_node = _Chain_Next( the_node );
+
+    sizes[ i ] = the_message->Contents.size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Copy_buffer(
+      the_message->Contents.buffer,
+      destination + i * stride,
+      sizes[ i ]
+    );
+
+    #if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+    {
+      Thread_Control *the_thread;
+
+      /*
+       *  There could be a thread waiting to send a message.  This code
+       *  puts the message in the message queue on behalf of the waiting
+       *  thread and reuses the message buffer for this purpose.
+       */
+      the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+      if ( the_thread != NULL ) {
+        _Chain_Extract_unprotected( &the_message->Node );
+        _CORE_message_queue_Set_message_priority(
+          the_message,
+          the_thread->Wait.count
+        );
+        the_message->Contents.size = (size_t) the_thread->Wait.option;
+        _CORE_message_queue_Copy_buffer(
+          the_thread->Wait.return_argument_second.immutable_object,
+          the_message->Contents.buffer,
+          the_message->Contents.size
+        );
+
+        _CORE_message_queue_Insert_message(
+           the_message_queue,
+           the_message,
+           _CORE_message_queue_Get_message_priority( the_message )
+        );
+      }
+    }
+    #endif
+
+    ++i;
+  }
+
+  /*
+   *  Return the message buffers to the pool at once.
+   */
+  _ISR_Disable( level );
+    while ( ( the_node = _Chain_Get_unprotected( &messages ) ) != NULL ) {
+      _Chain_Append_unprotected(
+        &the_message_queue->Inactive_messages,
+        the_node
+      );
+    }
+  _ISR_Enable( level );
+}
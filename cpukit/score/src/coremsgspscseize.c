@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Single Producer Single Consumer Seize
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/watchdogimpl.h>
+
+static bool _CORE_message_queue_SPSC_Is_empty(
+  const CORE_message_queue_Ring *ring
+)
+{
+  return _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED )
+    == _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+}
+
+static bool _CORE_message_queue_SPSC_Pop(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *buffer,
+  size_t                     *size_p
+)
+{
+  CORE_message_queue_Ring           *ring = &the_message_queue->Ring;
+  CORE_message_queue_Buffer_control *the_message;
+  unsigned int                       head;
+
+  /*
+   *  Only the consumer writes the head index, so a relaxed load is
+   *  sufficient.  The acquire load of the tail index pairs with the release
+   *  store of the producer and makes the message contents visible.
+   */
+  head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+
+  if ( head == _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_ACQUIRE ) ) {
+    return false;
+  }
+
+  the_message = _CORE_message_queue_Ring_slot( the_message_queue, head );
+  *size_p = the_message->Contents.size;
+  _CORE_message_queue_Copy_buffer(
+    the_message->Contents.buffer,
+    buffer,
+    *size_p
+  );
+
+  _Atomic_Store_uint(
+    &ring->head,
+    _CORE_message_queue_Ring_next( the_message_queue, head ),
+    ATOMIC_ORDER_RELEASE
+  );
+
+  return true;
+}
+
+void _CORE_message_queue_SPSC_Seize(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  Objects_Id                  id,
+  void                       *buffer,
+  size_t                     *size_p,
+  bool                        wait,
+  Watchdog_Interval           timeout
+)
+{
+  CORE_message_queue_Ring *ring = &the_message_queue->Ring;
+  ISR_lock_Context         lock_context;
+  Watchdog_Interval        start;
+  Watchdog_Interval        interval;
+
+  executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+
+  if ( _CORE_message_queue_SPSC_Pop( the_message_queue, buffer, size_p ) ) {
+    return;
+  }
+
+  if ( !wait ) {
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
+    return;
+  }
+
+  start = _Watchdog_Ticks_since_boot;
+  interval = timeout;
+
+  while ( true ) {
+    _Thread_Disable_dispatch();
+    _Thread_queue_Acquire( &the_message_queue->Wait_queue, &lock_context );
+
+    /*
+     *  The message queue delete directive closes the queue and unblocks the
+     *  consumer before it waits for the end of our operation, so we must not
+     *  block on a closed queue.
+     */
+    if ( ring->closed ) {
+      _Thread_queue_Release( &the_message_queue->Wait_queue, &lock_context );
+      _Thread_Enable_dispatch();
+      executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_WAS_DELETED;
+      return;
+    }
+
+    _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
+    executing->Wait.queue = &the_message_queue->Wait_queue;
+    executing->Wait.id = id;
+    _Atomic_Store_uint( &ring->consumer_waiting, 1, ATOMIC_ORDER_RELAXED );
+
+    /*
+     *  This fence pairs with the fence in _CORE_message_queue_SPSC_Submit().
+     */
+    _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+    if ( _CORE_message_queue_SPSC_Is_empty( ring ) ) {
+      _Thread_queue_Release( &the_message_queue->Wait_queue, &lock_context );
+      _Thread_queue_Enqueue(
+        &the_message_queue->Wait_queue,
+        executing,
+        interval
+      );
+    } else {
+      the_message_queue->Wait_queue.sync_state =
+        THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
+      _Thread_queue_Release( &the_message_queue->Wait_queue, &lock_context );
+    }
+
+    _Thread_Enable_dispatch();
+    _Atomic_Store_uint( &ring->consumer_waiting, 0, ATOMIC_ORDER_RELAXED );
+
+    if (
+      executing->Wait.return_code != CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL
+    ) {
+      return;
+    }
+
+    if ( _CORE_message_queue_SPSC_Pop( the_message_queue, buffer, size_p ) ) {
+      return;
+    }
+
+    /*
+     *  A producer unblocks us only after it published a message.  However, a
+     *  late unblock request of a previous receive operation may satisfy this
+     *  wait with an empty ring buffer.  In this case we block again for the
+     *  remaining time.
+     */
+    if ( timeout != WATCHDOG_NO_TIMEOUT ) {
+      Watchdog_Interval elapsed = _Watchdog_Ticks_since_boot - start;
+
+      if ( elapsed >= timeout ) {
+        executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_TIMEOUT;
+        return;
+      }
+
+      interval = timeout - elapsed;
+    }
+  }
+}
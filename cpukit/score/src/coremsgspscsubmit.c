@@ -0,0 +1,81 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Single Producer Single Consumer Submit
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+
+CORE_message_queue_Status _CORE_message_queue_SPSC_Submit(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size
+)
+{
+  CORE_message_queue_Ring           *ring = &the_message_queue->Ring;
+  CORE_message_queue_Buffer_control *the_message;
+  unsigned int                       tail;
+  unsigned int                       next;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
+  }
+
+  /*
+   *  Only the producer writes the tail index, so a relaxed load is
+   *  sufficient.  The acquire load of the head index pairs with the release
+   *  store of the consumer and ensures that the consumer is done with the
+   *  slot before we overwrite it.
+   */
+  tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+  next = _CORE_message_queue_Ring_next( the_message_queue, tail );
+
+  if ( next == _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_ACQUIRE ) ) {
+    return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+  }
+
+  the_message = _CORE_message_queue_Ring_slot( the_message_queue, tail );
+  the_message->Contents.size = size;
+  _CORE_message_queue_Copy_buffer(
+    buffer,
+    the_message->Contents.buffer,
+    size
+  );
+
+  _Atomic_Store_uint( &ring->tail, next, ATOMIC_ORDER_RELEASE );
+
+  /*
+   *  This fence pairs with the fence in _CORE_message_queue_SPSC_Seize().
+   *  Either we observe the consumer waiting indicator or the consumer
+   *  observes the new tail index before it blocks.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _Atomic_Load_uint( &ring->consumer_waiting, ATOMIC_ORDER_RELAXED ) ) {
+    /*
+     *  The consumer fetches the message itself once it is unblocked, so
+     *  there is nothing to copy on its behalf.
+     */
+    _Thread_Disable_dispatch();
+    (void) _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    _Thread_Enable_dispatch();
+  }
+
+  return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+}
@@ -53,12 +53,14 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
   if ( the_message_queue->number_of_pending_messages == 0 ) {
     the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
     if ( the_thread ) {
-      _CORE_message_queue_Copy_buffer(
-        buffer,
-        the_thread->Wait.return_argument_second.mutable_object,
-        size
-      );
-      *(size_t *) the_thread->Wait.return_argument = size;
+      if ( !_CORE_message_queue_Copy_to_receiver(
+             the_message_queue,
+             the_thread,
+             buffer,
+             size
+           ) ) {
+        return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+      }
       the_thread->Wait.count = (uint32_t) submit_type;
 
       #if defined(RTEMS_MULTIPROCESSING)
@@ -104,6 +106,16 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
       return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
     }
 
+    /*
+     *  Do NOT block on a send if message buffers are on loan.  A message
+     *  buffer on loan may stay away from the pool for an unbounded time and
+     *  the threads waiting to receive and the threads waiting to send must
+     *  never share the thread queue.
+     */
+    if ( the_message_queue->number_of_loaned_messages != 0 ) {
+      return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+    }
+
     /*
      *  Do NOT block on a send if the caller is in an ISR.  It is
      *  deadly to block in an ISR.
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Submit Buffer
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/isr.h>
+
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  Objects_Id                                 id,
+  #if defined(RTEMS_MULTIPROCESSING)
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  #else
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support  __attribute__((unused)),
+  #endif
+  CORE_message_queue_Submit_types            submit_type
+)
+{
+  Thread_Control *the_thread;
+  ISR_Level       level;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
+  }
+
+  the_message->Contents.size = size;
+
+  /*
+   *  Is there a thread currently waiting on this message queue?
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    if ( the_thread ) {
+      if ( the_thread->Wait.return_argument_second.mutable_object == NULL ) {
+        /*
+         *  The thread waits for a message buffer on loan, so the loan
+         *  moves on to this thread.
+         */
+        *(CORE_message_queue_Buffer_control **)
+          the_thread->Wait.return_argument = the_message;
+      } else {
+        _CORE_message_queue_Copy_buffer(
+          the_message->Contents.buffer,
+          the_thread->Wait.return_argument_second.mutable_object,
+          size
+        );
+        *(size_t *) the_thread->Wait.return_argument = size;
+        _CORE_message_queue_Release_buffer( the_message_queue, the_message );
+      }
+      the_thread->Wait.count = (uint32_t) submit_type;
+
+      #if defined(RTEMS_MULTIPROCESSING)
+        if ( !_Objects_Is_local_id( the_thread->Object.id ) )
+          (*api_message_queue_mp_support) ( the_thread, id );
+      #endif
+      return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+    }
+  }
+
+  /*
+   *  No one waiting on the message queue at this time, so the message
+   *  buffer returns from loan and is queued up for a future receive.
+   */
+  _ISR_Disable( level );
+    the_message_queue->number_of_loaned_messages -= 1;
+  _ISR_Enable( level );
+
+  _CORE_message_queue_Set_message_priority( the_message, submit_type );
+  _CORE_message_queue_Insert_message(
+     the_message_queue,
+     the_message,
+     submit_type
+  );
+  return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+}
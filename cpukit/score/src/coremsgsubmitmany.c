@@ -0,0 +1,172 @@
+/**
+ * @file
+ *
+ * @brief CORE Message Queue Submit Many
+ *
+ * @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/isr.h>
+
+CORE_message_queue_Status _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control                *the_message_queue,
+  const void                                *buffer,
+  const size_t                              *sizes,
+  uint32_t                                   count,
+  uint32_t                                  *sent_p,
+  Objects_Id                                 id,
+  CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  CORE_message_queue_Submit_types            submit_type
+)
+{
+  const char    *source = buffer;
+  size_t         stride = the_message_queue->maximum_message_size;
+  uint32_t       sent = 0;
+  uint32_t       allocated = 0;
+  uint32_t       i;
+  Chain_Control  messages;
+  Chain_Node    *the_node;
+  ISR_Level      level;
+
+  *sent_p = 0;
+
+  for ( i = 0 ; i < count ; ++i ) {
+    if ( sizes[ i ] > the_message_queue->maximum_message_size ) {
+      return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
+    }
+  }
+
+  /*
+   *  Is there a thread currently waiting on this message queue?  There can
+   *  only be waiting receivers in case no message is pending.
+   */
+  while ( sent < count && the_message_queue->number_of_pending_messages == 0 ) {
+    Thread_Control *the_thread;
+
+    the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    if ( the_thread == NULL ) {
+      break;
+    }
+
+    if ( !_CORE_message_queue_Copy_to_receiver(
+             the_message_queue,
+             the_thread,
+             source + sent * stride,
+             sizes[ sent ]
+           ) ) {
+      *sent_p = sent;
+      return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+    }
+    the_thread->Wait.count = (uint32_t) submit_type;
+
+    #if defined(RTEMS_MULTIPROCESSING)
+      if ( !_Objects_Is_local_id( the_thread->Object.id ) )
+        (*api_message_queue_mp_support) ( the_thread, id );
+    #endif
+
+    ++sent;
+  }
+
+  if ( sent == count ) {
+    *sent_p = sent;
+    return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+  }
+
+  /*
+   *  Allocate the message buffers for the remaining messages at once.
+   */
+  _Chain_Initialize_empty( &messages );
+
+  _ISR_Disable( level );
+    while ( sent + allocated < count ) {
+      the_node = _Chain_Get_unprotected( &the_message_queue->Inactive_messages );
+      if ( the_node == NULL ) {
+        break;
+      }
+
+      _Chain_Append_unprotected( &messages, the_node );
+      ++allocated;
+    }
+  _ISR_Enable( level );
+
+  /*
+   *  Fill in the messages with interrupts enabled.  The message buffers are
+   *  private to this thread until they are placed on the pending queue.
+   */
+  i = sent;
+  the_node = _Chain_First( &messages );
+  while ( !_Chain_Is_tail( &messages, the_node ) ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    the_message = (CORE_message_queue_Buffer_control *) the_node;
+    _CORE_message_queue_Copy_buffer(
+      source + i * stride,
+      the_message->Contents.buffer,
+      sizes[ i ]
+    );
+    the_message->Contents.size = sizes[ i ];
+    _CORE_message_queue_Set_message_priority( the_message, submit_type );
+
+    the_node = _Chain_Next( the_node );
+    ++i;
+  }
+
+  if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
+    #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+      bool notify;
+    #endif
+
+    _ISR_Disable( level );
+      #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+        notify = the_message_queue->number_of_pending_messages == 0
+          && allocated > 0;
+      #endif
+      the_message_queue->number_of_pending_messages += allocated;
+      while ( ( the_node = _Chain_Get_unprotected( &messages ) ) != NULL ) {
+        _CORE_message_queue_Append_unprotected(
+          the_message_queue,
+          (CORE_message_queue_Buffer_control *) the_node
+        );
+      }
+    _ISR_Enable( level );
+
+    #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+      if ( notify && the_message_queue->notify_handler )
+        (*the_message_queue->notify_handler)(
+          the_message_queue->notify_argument
+        );
+    #endif
+  } else {
+    while ( ( the_node = _Chain_Get_unprotected( &messages ) ) != NULL ) {
+      _CORE_message_queue_Insert_message(
+        the_message_queue,
+        (CORE_message_queue_Buffer_control *) the_node,
+        submit_type
+      );
+    }
+  }
+
+  sent += allocated;
+  *sent_p = sent;
+
+  if ( sent != count ) {
+    return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+  }
+
+  return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+}
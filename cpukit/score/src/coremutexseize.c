@@ -31,7 +31,7 @@ void _CORE_mutex_Seize(
   Objects_Id           _id,
   bool                 _wait,
   Watchdog_Interval    _timeout,
-  ISR_Level            _level
+  ISR_lock_Context    *_lock_context
 )
 {
   _CORE_mutex_Seize_body(
@@ -40,7 +40,7 @@ void _CORE_mutex_Seize(
     _id,
     _wait,
     _timeout,
-    _level
+    _lock_context
   );
 }
 #endif
@@ -27,13 +27,13 @@
 int _CORE_mutex_Seize_interrupt_trylock(
   CORE_mutex_Control  *the_mutex,
   Thread_Control      *executing,
-  ISR_Level            level
+  ISR_lock_Context    *lock_context
 )
 {
   return _CORE_mutex_Seize_interrupt_trylock_body(
     the_mutex,
     executing,
-    level
+    lock_context
   );
 }
 #endif
@@ -98,8 +98,11 @@ CORE_mutex_Status _CORE_mutex_Surrender(
 #endif
 )
 {
-  Thread_Control *the_thread;
-  Thread_Control *holder;
+  Thread_Control   *the_thread;
+  Thread_Control   *holder;
+  ISR_lock_Context  lock_context;
+
+  _Thread_queue_Acquire( &the_mutex->Wait_queue, &lock_context );
 
   holder = the_mutex->holder;
 
@@ -112,17 +115,28 @@ CORE_mutex_Status _CORE_mutex_Surrender(
    */
 
   if ( the_mutex->Attributes.only_owner_release ) {
-    if ( !_Thread_Is_executing( holder ) )
+    if ( !_Thread_Is_executing( holder ) ) {
+      _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
       return CORE_MUTEX_STATUS_NOT_OWNER_OF_RESOURCE;
+    }
   }
 
   /* XXX already unlocked -- not right status */
 
-  if ( !the_mutex->nest_count )
+  if ( !the_mutex->nest_count ) {
+    _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
     return CORE_MUTEX_STATUS_SUCCESSFUL;
+  }
 
   the_mutex->nest_count--;
 
+  /*
+   *  The holder stays in place until the mutex is transferred to a blocked
+   *  thread or formally released below.  So obtain operations carried out
+   *  without the Giant lock cannot grab the mutex in the meantime.
+   */
+  _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
+
   if ( the_mutex->nest_count != 0 ) {
     /*
      *  All error checking is on the locking side, so if the lock was
@@ -149,8 +163,8 @@ CORE_mutex_Status _CORE_mutex_Surrender(
   }
 
   /*
-   *  Formally release the mutex before possibly transferring it to a
-   *  blocked thread.
+   *  Formally release the resource of the holder before possibly
+   *  transferring the mutex to a blocked thread.
    */
   if ( _CORE_mutex_Is_inherit_priority( &the_mutex->Attributes ) ||
        _CORE_mutex_Is_priority_ceiling( &the_mutex->Attributes ) ) {
@@ -172,13 +186,16 @@ CORE_mutex_Status _CORE_mutex_Surrender(
       _Thread_Change_priority( holder, holder->real_priority, true );
     }
   }
-  the_mutex->holder = NULL;
 
   /*
    *  Now we check if another thread was waiting for this mutex.  If so,
    *  transfer the mutex to that thread.
    */
-  if ( ( the_thread = _Thread_queue_Dequeue( &the_mutex->Wait_queue ) ) ) {
+  the_thread = _Thread_queue_Dequeue( &the_mutex->Wait_queue );
+
+  _Thread_queue_Acquire( &the_mutex->Wait_queue, &lock_context );
+
+  if ( the_thread ) {
 
 #if defined(RTEMS_MULTIPROCESSING)
     if ( !_Objects_Is_local_id( the_thread->Object.id ) ) {
@@ -186,6 +203,8 @@ CORE_mutex_Status _CORE_mutex_Surrender(
       the_mutex->holder     = NULL;
       the_mutex->nest_count = 1;
 
+      _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
+
       ( *api_mutex_mp_support)( the_thread, id );
 
     } else
@@ -195,6 +214,8 @@ CORE_mutex_Status _CORE_mutex_Surrender(
       the_mutex->holder     = the_thread;
       the_mutex->nest_count = 1;
 
+      _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
+
       switch ( the_mutex->Attributes.discipline ) {
         case CORE_MUTEX_DISCIPLINES_FIFO:
         case CORE_MUTEX_DISCIPLINES_PRIORITY:
@@ -217,6 +238,9 @@ CORE_mutex_Status _CORE_mutex_Surrender(
           break;
       }
     }
+  } else {
+    the_mutex->holder = NULL;
+    _Thread_queue_Release( &the_mutex->Wait_queue, &lock_context );
   }
 
   return CORE_MUTEX_STATUS_SUCCESSFUL;
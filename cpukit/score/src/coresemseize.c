@@ -34,13 +34,13 @@ void _CORE_semaphore_Seize(
   Watchdog_Interval       timeout
 )
 {
-  ISR_Level       level;
+  ISR_lock_Context lock_context;
 
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
-  _ISR_Disable( level );
+  _Thread_queue_Acquire( &the_semaphore->Wait_queue, &lock_context );
   if ( the_semaphore->count != 0 ) {
     the_semaphore->count -= 1;
-    _ISR_Enable( level );
+    _Thread_queue_Release( &the_semaphore->Wait_queue, &lock_context );
     return;
   }
 
@@ -50,7 +50,7 @@ void _CORE_semaphore_Seize(
    *  the semaphore was not available and the caller never blocked.
    */
   if ( !wait ) {
-    _ISR_Enable( level );
+    _Thread_queue_Release( &the_semaphore->Wait_queue, &lock_context );
     executing->Wait.return_code = CORE_SEMAPHORE_STATUS_UNSATISFIED_NOWAIT;
     return;
   }
@@ -62,7 +62,7 @@ void _CORE_semaphore_Seize(
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue = &the_semaphore->Wait_queue;
   executing->Wait.id    = id;
-  _ISR_Enable( level );
+  _Thread_queue_Release( &the_semaphore->Wait_queue, &lock_context );
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, executing, timeout );
 }
 #endif
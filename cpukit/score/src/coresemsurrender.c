@@ -29,7 +29,7 @@ CORE_semaphore_Status _CORE_semaphore_Surrender(
 )
 {
   Thread_Control *the_thread;
-  ISR_Level       level;
+  ISR_lock_Context lock_context;
   CORE_semaphore_Status status;
 
   status = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
@@ -42,12 +42,12 @@ CORE_semaphore_Status _CORE_semaphore_Surrender(
 #endif
 
   } else {
-    _ISR_Disable( level );
+    _Thread_queue_Acquire( &the_semaphore->Wait_queue, &lock_context );
       if ( the_semaphore->count < the_semaphore->Attributes.maximum_count )
         the_semaphore->count += 1;
       else
         status = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
-    _ISR_Enable( level );
+    _Thread_queue_Release( &the_semaphore->Wait_queue, &lock_context );
   }
 
   return status;
@@ -339,22 +339,23 @@ static void _Heap_Block_split(
     stats->free_size += free_block_size;
 
     if ( _Heap_Is_used( next_block ) ) {
-      _Heap_Free_list_insert_after( free_list_anchor, free_block );
+      free_block->size_and_flag = free_block_size | HEAP_PREV_BLOCK_USED;
+
+      _Heap_Free_block_insert_after( heap, free_list_anchor, free_block );
 
       /* Statistics */
       ++stats->free_blocks;
     } else {
       uintptr_t const next_block_size = _Heap_Block_size( next_block );
 
-      _Heap_Free_list_replace( next_block, free_block );
-
       free_block_size += next_block_size;
+      free_block->size_and_flag = free_block_size | HEAP_PREV_BLOCK_USED;
+
+      _Heap_Free_block_replace( heap, next_block, free_block );
 
       next_block = _Heap_Block_at( free_block, free_block_size );
     }
 
-    free_block->size_and_flag = free_block_size | HEAP_PREV_BLOCK_USED;
-
     next_block->prev_size = free_block_size;
     next_block->size_and_flag &= ~HEAP_PREV_BLOCK_USED;
 
@@ -405,7 +406,9 @@ static Heap_Block *_Heap_Block_allocate_from_end(
   stats->free_size += block_size;
 
   if ( _Heap_Is_prev_used( block ) ) {
-    _Heap_Free_list_insert_after( free_list_anchor, block );
+    block->size_and_flag = block_size | HEAP_PREV_BLOCK_USED;
+
+    _Heap_Free_block_insert_after( heap, free_list_anchor, block );
 
     free_list_anchor = block;
 
@@ -417,9 +420,9 @@ static Heap_Block *_Heap_Block_allocate_from_end(
 
     block = prev_block;
     block_size += prev_block_size;
-  }
 
-  block->size_and_flag = block_size | HEAP_PREV_BLOCK_USED;
+    _Heap_Free_block_set_size( heap, block, block_size );
+  }
 
   new_block->prev_size = block_size;
   new_block->size_and_flag = new_block_size;
@@ -448,7 +451,7 @@ Heap_Block *_Heap_Block_allocate(
   if ( _Heap_Is_free( block ) ) {
     free_list_anchor = block->prev;
 
-    _Heap_Free_list_remove( block );
+    _Heap_Free_block_remove( heap, block );
 
     /* Statistics */
     --stats->free_blocks;
@@ -196,6 +196,7 @@ void *_Heap_Allocate_aligned_with_boundary(
   uintptr_t alloc_begin = 0;
   uint32_t search_count = 0;
   bool search_again = false;
+  uintptr_t good_fit_size = 0;
 
   if ( block_size_floor < alloc_size ) {
     /* Integer overflow occured */
@@ -212,10 +213,27 @@ void *_Heap_Allocate_aligned_with_boundary(
     }
   }
 
+  /*
+   * A block which is larger than the request by the alignment is a good fit
+   * for an aligned request.  There is no such size for a boundary constraint.
+   */
+  if ( boundary == 0 ) {
+    good_fit_size = block_size_floor + alignment;
+
+    if ( good_fit_size < block_size_floor ) {
+      good_fit_size = 0;
+    }
+  }
+
   do {
     Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-    block = _Heap_Free_list_first( heap );
+    if ( _Heap_Is_segregated_fit( heap ) ) {
+      block = _Heap_Segregated_search( heap, block_size_floor, good_fit_size );
+    } else {
+      block = _Heap_Free_list_first( heap );
+    }
+
     while ( block != free_list_tail ) {
       _HAssert( _Heap_Is_prev_used( block ) );
 
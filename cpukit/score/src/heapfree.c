@@ -164,29 +164,29 @@ bool _Heap_Free( Heap_Control *heap, void *alloc_begin_ptr )
 
     if ( next_is_free ) {       /* coalesce both */
       uintptr_t const size = block_size + prev_size + next_block_size;
-      _Heap_Free_list_remove( next_block );
+      _Heap_Free_block_remove( heap, next_block );
       stats->free_blocks -= 1;
-      prev_block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+      _Heap_Free_block_set_size( heap, prev_block, size );
       next_block = _Heap_Block_at( prev_block, size );
       _HAssert(!_Heap_Is_prev_used( next_block));
       next_block->prev_size = size;
     } else {                      /* coalesce prev */
       uintptr_t const size = block_size + prev_size;
-      prev_block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+      _Heap_Free_block_set_size( heap, prev_block, size );
       next_block->size_and_flag &= ~HEAP_PREV_BLOCK_USED;
       next_block->prev_size = size;
     }
   } else if ( next_is_free ) {    /* coalesce next */
     uintptr_t const size = block_size + next_block_size;
-    _Heap_Free_list_replace( next_block, block );
     block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Free_block_replace( heap, next_block, block );
     next_block  = _Heap_Block_at( block, size );
     next_block->prev_size = size;
   } else {                        /* no coalesce */
     /* Add 'block' to the head of the free blocks list as it tends to
        produce less fragmentation than adding to the tail. */
-    _Heap_Free_list_insert_after( _Heap_Free_list_head( heap), block );
     block->size_and_flag = block_size | HEAP_PREV_BLOCK_USED;
+    _Heap_Free_block_insert_after( heap, _Heap_Free_list_head( heap), block );
     next_block->size_and_flag &= ~HEAP_PREV_BLOCK_USED;
     next_block->prev_size = block_size;
 
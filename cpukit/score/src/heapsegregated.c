@@ -0,0 +1,215 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreHeap
+ *
+ * @brief Heap Handler Segregated Fit Implementation
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+static unsigned int _Heap_Segregated_lsb( uintptr_t value )
+{
+  return (unsigned int) __builtin_ctzl( (unsigned long) value );
+}
+
+/*
+ * Finds the smallest non-empty class which is greater than or equal to the
+ * class (fl, sl).  The second level class sl may be equal to
+ * HEAP_SEGREGATED_SL_COUNT to start the search at the next first level class.
+ */
+static bool _Heap_Segregated_find(
+  const Heap_Segregated_index *index,
+  unsigned int fl,
+  unsigned int sl,
+  unsigned int *fl_found,
+  unsigned int *sl_found
+)
+{
+  unsigned int sl_bits = index->sl_bitmap[ fl ] & ( ~0U << sl );
+
+  if ( sl_bits == 0 ) {
+    uintptr_t fl_bits;
+
+    ++fl;
+
+    if ( fl >= HEAP_SEGREGATED_FL_COUNT ) {
+      return false;
+    }
+
+    fl_bits = index->fl_bitmap & ( ~(uintptr_t) 0 << fl );
+
+    if ( fl_bits == 0 ) {
+      return false;
+    }
+
+    fl = _Heap_Segregated_lsb( fl_bits );
+    sl_bits = index->sl_bitmap[ fl ];
+  }
+
+  *fl_found = fl;
+  *sl_found = _Heap_Segregated_lsb( sl_bits );
+
+  return true;
+}
+
+void _Heap_Segregated_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated;
+  Heap_Block *next;
+  unsigned int fl;
+  unsigned int sl;
+  unsigned int next_fl;
+  unsigned int next_sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  next = index->first[ fl ][ sl ];
+
+  if ( next == NULL ) {
+    /*
+     * The class is empty.  Keep the free list sorted by class and insert the
+     * block in front of the first block of the next greater non-empty class.
+     */
+    if ( _Heap_Segregated_find( index, fl, sl + 1, &next_fl, &next_sl ) ) {
+      next = index->first[ next_fl ][ next_sl ];
+    } else {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    index->sl_bitmap[ fl ] |= (uint8_t) ( 1U << sl );
+    index->fl_bitmap |= (uintptr_t) 1 << fl;
+  }
+
+  _Heap_Free_list_insert_before( next, block );
+  index->first[ fl ][ sl ] = block;
+}
+
+void _Heap_Segregated_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_index *const index = heap->segregated;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block *const next = block->next;
+    unsigned int next_fl;
+    unsigned int next_sl;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      _Heap_Segregated_mapping( _Heap_Block_size( next ), &next_fl, &next_sl );
+    } else {
+      next_fl = HEAP_SEGREGATED_FL_COUNT;
+      next_sl = 0;
+    }
+
+    if ( next_fl == fl && next_sl == sl ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->sl_bitmap[ fl ] &= (uint8_t) ~( 1U << sl );
+
+      if ( index->sl_bitmap[ fl ] == 0 ) {
+        index->fl_bitmap &= ~( (uintptr_t) 1 << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+Heap_Block *_Heap_Segregated_search(
+  Heap_Control *heap,
+  uintptr_t block_size,
+  uintptr_t good_fit_size
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  unsigned int fl;
+  unsigned int sl;
+  unsigned int fl_found;
+  unsigned int sl_found;
+
+  if ( good_fit_size != 0 ) {
+    unsigned int msb = _Heap_Segregated_msb( good_fit_size );
+    uintptr_t round_up = msb >= HEAP_SEGREGATED_SL_LOG2 ?
+      ( (uintptr_t) 1 << ( msb - HEAP_SEGREGATED_SL_LOG2 ) ) - 1
+        : ( (uintptr_t) 1 << msb ) - 1;
+    uintptr_t good_size = good_fit_size + round_up;
+
+    /*
+     * All blocks of the class of the rounded up size are large enough.
+     */
+    if ( good_size >= good_fit_size ) {
+      _Heap_Segregated_mapping( good_size, &fl, &sl );
+
+      if ( _Heap_Segregated_find( index, fl, sl, &fl_found, &sl_found ) ) {
+        return index->first[ fl_found ][ sl_found ];
+      }
+    }
+  }
+
+  _Heap_Segregated_mapping( block_size, &fl, &sl );
+
+  if ( _Heap_Segregated_find( index, fl, sl, &fl_found, &sl_found ) ) {
+    return index->first[ fl_found ][ sl_found ];
+  }
+
+  return _Heap_Free_list_tail( heap );
+}
+
+bool _Heap_Enable_segregated_fit( Heap_Control *heap )
+{
+  Heap_Segregated_index *index;
+  Heap_Block *const free_list_head = _Heap_Free_list_head( heap );
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *block;
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return true;
+  }
+
+  index = _Heap_Allocate( heap, sizeof( *index ) );
+  if ( index == NULL ) {
+    return false;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+
+  /*
+   * Detach the free blocks and insert them again one by one to sort them by
+   * class.
+   */
+  block = _Heap_Free_list_first( heap );
+  free_list_head->next = free_list_tail;
+  free_list_tail->prev = free_list_head;
+
+  heap->segregated = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *const next = block->next;
+
+    _Heap_Segregated_insert( heap, block );
+
+    block = next;
+  }
+
+  return true;
+}
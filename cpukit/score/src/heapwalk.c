@@ -53,6 +53,92 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
   va_end( ap );
 }
 
+static bool _Heap_Walk_check_segregated_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_index *const index = heap->segregated;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  unsigned int prev_class = 0;
+  unsigned int class_count = 0;
+  unsigned int bitmap_count = 0;
+  unsigned int fl;
+
+  while ( free_block != free_list_tail ) {
+    unsigned int sl;
+    unsigned int class;
+
+    _Heap_Segregated_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+    class = fl * HEAP_SEGREGATED_SL_COUNT + sl + 1;
+
+    if ( class < prev_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: not sorted by size class\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( class != prev_class ) {
+      if (
+        index->first[ fl ][ sl ] != free_block
+          || ( index->sl_bitmap[ fl ] & ( 1U << sl ) ) == 0
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: invalid size class index\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      ++class_count;
+      prev_class = class;
+    }
+
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FL_COUNT; ++fl ) {
+    bool const fl_set = ( index->fl_bitmap & ( (uintptr_t) 1 << fl ) ) != 0;
+
+    if ( fl_set != ( index->sl_bitmap[ fl ] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "first level class %u: invalid bitmap\n",
+        fl
+      );
+
+      return false;
+    }
+
+    bitmap_count += (unsigned int) __builtin_popcount( index->sl_bitmap[ fl ] );
+  }
+
+  if ( bitmap_count != class_count ) {
+    (*printer)(
+      source,
+      true,
+      "segregated index: %u classes in bitmaps, but %u in free list\n",
+      bitmap_count,
+      class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
@@ -117,6 +203,10 @@ static bool _Heap_Walk_check_free_list(
     free_block = free_block->next;
   }
 
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Walk_check_segregated_index( source, printer, heap );
+  }
+
   return true;
 }
 
@@ -25,9 +25,47 @@
 #include <rtems/score/isrlevel.h>
 #include <rtems/score/sysstate.h>
 #include <rtems/score/wkspace.h>
+#include <rtems/config.h>
 
 #include <string.h>  /* for memcpy() */
 
+/*
+ *  Rebuilds the name index for all objects of the local table.  The objects
+ *  are visited in decreasing index order and prepended to their hash chain,
+ *  so the hash chains are ordered by increasing object index.
+ */
+static void _Objects_Name_index_rebuild(
+  Objects_Information *information,
+  Objects_Control    **local_table,
+  uint32_t             table_size,
+  Objects_Maximum     *buckets,
+  Objects_Maximum     *next,
+  uint32_t             mask
+)
+{
+  uint32_t index;
+
+  memset( buckets, 0, ( mask + 1 ) * sizeof( *buckets ) );
+  memset( next, 0, table_size * sizeof( *next ) );
+
+  index = table_size;
+  while ( index > 0 ) {
+    Objects_Control *the_object;
+    uint32_t         hash;
+
+    --index;
+    the_object = local_table[ index ];
+    if ( the_object == NULL )
+      continue;
+
+    if ( !_Objects_Name_index_get_hash( information, the_object, &hash ) )
+      continue;
+
+    next[ index ] = buckets[ hash & mask ];
+    buckets[ hash & mask ] = (Objects_Maximum) index;
+  }
+}
+
 /*
  *  _Objects_Extend_information
  *
@@ -117,6 +155,9 @@ void _Objects_Extend_information(
     void            **object_blocks;
     uint32_t         *inactive_per_block;
     Objects_Control **local_table;
+    Objects_Maximum  *name_index_buckets;
+    Objects_Maximum  *name_index_next;
+    uint32_t          name_index_mask;
     void             *old_tables;
     size_t            block_size;
     uintptr_t         object_blocks_size;
@@ -134,6 +175,11 @@ void _Objects_Extend_information(
      *      void            *objects[block_count];
      *      uint32_t         inactive_count[block_count];
      *      Objects_Control *local_table[maximum];
+     *      Objects_Maximum  name_index_next[maximum];
+     *      Objects_Maximum  name_index_buckets[mask + 1];
+     *
+     *  The name index tables are only present in case the name index is
+     *  enabled by the configuration.
      *
      *  This is the order in memory. Watch changing the order. See the memcpy
      *  below.
@@ -161,6 +207,19 @@ void _Objects_Extend_information(
         );
     block_size = object_blocks_size + inactive_per_block_size +
         ((maximum + minimum_index) * sizeof(Objects_Control *));
+
+    /*
+     *  The bucket count of the name index is the next power of two of the
+     *  maximum object count, so the hash chains are short on average.
+     */
+    name_index_mask = 0;
+    if ( rtems_configuration_get_object_name_index() ) {
+      while ( name_index_mask + 1 < maximum )
+        name_index_mask = ( name_index_mask << 1 ) | 1;
+
+      block_size += ((maximum + minimum_index) * sizeof(Objects_Maximum)) +
+          ((name_index_mask + 1) * sizeof(Objects_Maximum));
+    }
     if ( information->auto_extend ) {
       object_blocks = _Workspace_Allocate( block_size );
       if ( !object_blocks ) {
@@ -182,6 +241,14 @@ void _Objects_Extend_information(
         inactive_per_block,
         inactive_per_block_size
     );
+    if ( rtems_configuration_get_object_name_index() ) {
+      name_index_next = (Objects_Maximum *)
+        &local_table[ maximum + minimum_index ];
+      name_index_buckets = &name_index_next[ maximum + minimum_index ];
+    } else {
+      name_index_next = NULL;
+      name_index_buckets = NULL;
+    }
 
     /*
      *  Take the block count down. Saves all the (block_count - 1)
@@ -226,6 +293,22 @@ void _Objects_Extend_information(
     }
 
     _Thread_Disable_dispatch();
+
+    /*
+     *  Renames of objects are done with thread dispatching disabled, so the
+     *  name index is rebuilt from a stable set of names.
+     */
+    if ( name_index_buckets != NULL ) {
+      _Objects_Name_index_rebuild(
+        information,
+        local_table,
+        maximum + minimum_index,
+        name_index_buckets,
+        name_index_next,
+        name_index_mask
+      );
+    }
+
     _ISR_Disable( level );
 
     old_tables = information->object_blocks;
@@ -233,6 +316,9 @@ void _Objects_Extend_information(
     information->object_blocks = object_blocks;
     information->inactive_per_block = inactive_per_block;
     information->local_table = local_table;
+    information->name_index_buckets = name_index_buckets;
+    information->name_index_next = name_index_next;
+    information->name_index_mask = name_index_mask;
     information->maximum = (Objects_Maximum) maximum;
     information->maximum_id = _Objects_Build_id(
         information->the_api,
@@ -112,6 +112,14 @@ void _Objects_Initialize_information(
 
   information->name_length = maximum_name_length;
 
+  /*
+   *  The optional name index is allocated together with the local table
+   *  by _Objects_Extend_information().
+   */
+  information->name_index_buckets = NULL;
+  information->name_index_next    = NULL;
+  information->name_index_mask    = 0;
+
   _Chain_Initialize_empty( &information->Inactive );
 
   /*
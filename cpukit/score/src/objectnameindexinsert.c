@@ -0,0 +1,52 @@
+/**
+ * @file
+ *
+ * @brief Inserts Object into Name Index
+ *
+ * @ingroup Score
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+
+void _Objects_Name_index_insert(
+  Objects_Information *information,
+  Objects_Control     *the_object
+)
+{
+  Objects_Maximum *link;
+  Objects_Maximum  index;
+
+  link = _Objects_Name_index_get_bucket( information, the_object );
+  if ( link == NULL )
+    return;
+
+  index = _Objects_Get_index( the_object->id );
+
+  /*
+   *  Keep the hash chain ordered by object index, so that a lookup finds
+   *  the object with the lowest index among objects with equal names like
+   *  the linear search of the local table does.
+   */
+  _Thread_Disable_dispatch();
+
+  while ( *link != 0 && *link < index )
+    link = &information->name_index_next[ *link ];
+
+  information->name_index_next[ index ] = *link;
+  *link = index;
+
+  _Thread_Enable_dispatch();
+}
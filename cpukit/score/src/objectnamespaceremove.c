@@ -27,6 +27,9 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 )
 {
+  if ( _Objects_Has_name_index( information ) )
+    _Objects_Name_index_remove( information, the_object );
+
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     /*
      *  If this is a string format name, then free the memory.
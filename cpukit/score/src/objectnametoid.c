@@ -51,7 +51,28 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
-  if ( search_local_node ) {
+  if ( search_local_node && _Objects_Has_name_index( information ) ) {
+    uint32_t hash = _Objects_Name_index_hash_u32( name );
+
+    _Thread_Disable_dispatch();
+
+    index = information->name_index_buckets[
+      hash & information->name_index_mask
+    ];
+    while ( index != 0 ) {
+      the_object = information->local_table[ index ];
+
+      if ( the_object != NULL && name == the_object->name.name_u32 ) {
+        *id = the_object->id;
+        _Thread_Enable_dispatch();
+        return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+      }
+
+      index = information->name_index_next[ index ];
+    }
+
+    _Thread_Enable_dispatch();
+  } else if ( search_local_node ) {
     for ( index = 1; index <= information->maximum; index++ ) {
       the_object = information->local_table[ index ];
       if ( !the_object )
@@ -40,7 +40,35 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_string(
   if ( !name )
     return OBJECTS_INVALID_NAME;
 
-  if ( information->maximum != 0 ) {
+  if ( _Objects_Has_name_index( information ) ) {
+    uint32_t hash = _Objects_Name_index_hash_string(
+      name,
+      information->name_length
+    );
+
+    _Thread_Disable_dispatch();
+
+    index = information->name_index_buckets[
+      hash & information->name_index_mask
+    ];
+    while ( index != 0 ) {
+      the_object = information->local_table[ index ];
+
+      if (
+        the_object != NULL
+          && the_object->name.name_p != NULL
+          && !strncmp( name, the_object->name.name_p, information->name_length )
+      ) {
+        *id = the_object->id;
+        _Thread_Enable_dispatch();
+        return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+      }
+
+      index = information->name_index_next[ index ];
+    }
+
+    _Thread_Enable_dispatch();
+  } else if ( information->maximum != 0 ) {
 
     for ( index = 1; index <= information->maximum; index++ ) {
       the_object = information->local_table[ index ];
@@ -31,10 +31,18 @@ bool _Objects_Set_name(
 {
   size_t                 length;
   const char            *s;
+  bool                   is_indexed;
 
   s      = name;
   length = strnlen( name, information->name_length );
 
+  /*
+   *  An open object must leave the name index while its name changes.
+   */
+  is_indexed = _Objects_Has_name_index( information )
+    && information->local_table[ _Objects_Get_index( the_object->id ) ]
+      == the_object;
+
 #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
   if ( information->is_string ) {
     char *d;
@@ -43,6 +51,9 @@ bool _Objects_Set_name(
     if ( !d )
       return false;
 
+    if ( is_indexed )
+      _Objects_Name_index_remove( information, the_object );
+
     _Workspace_Free( (void *)the_object->name.name_p );
     the_object->name.name_p = NULL;
 
@@ -52,6 +63,9 @@ bool _Objects_Set_name(
   } else
 #endif
   {
+    if ( is_indexed )
+      _Objects_Name_index_remove( information, the_object );
+
     the_object->name.name_u32 =  _Objects_Build_name(
       ((0 <= length) ? s[ 0 ] : ' '),
       ((1 <  length) ? s[ 1 ] : ' '),
@@ -61,5 +75,8 @@ bool _Objects_Set_name(
 
   }
 
+  if ( is_indexed )
+    _Objects_Name_index_insert( information, the_object );
+
   return true;
 }
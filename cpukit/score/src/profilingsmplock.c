@@ -21,9 +21,14 @@
 #if defined( RTEMS_PROFILING )
 SMP_lock_Stats_control _SMP_lock_Stats_control = {
   .Lock = {
+#if defined( RTEMS_SMP_MCS_LOCK )
+    .mcs_lock = {
+      .queue = ATOMIC_INITIALIZER_PTR( NULL ),
+#else
     .ticket_lock = {
       .next_ticket = ATOMIC_INITIALIZER_UINT( 0U ),
       .now_serving = ATOMIC_INITIALIZER_UINT( 0U ),
+#endif
       .Stats = {
         .Node = CHAIN_NODE_INITIALIZER_ONE_NODE_CHAIN(
           &_SMP_lock_Stats_control.Stats_chain
@@ -33,7 +38,11 @@ SMP_lock_Stats_control _SMP_lock_Stats_control = {
     }
   },
   .Stats_chain = CHAIN_INITIALIZER_ONE_NODE(
+#if defined( RTEMS_SMP_MCS_LOCK )
+    &_SMP_lock_Stats_control.Lock.mcs_lock.Stats.Node
+#else
     &_SMP_lock_Stats_control.Lock.ticket_lock.Stats.Node
+#endif
   ),
   .Iterator_chain = CHAIN_INITIALIZER_EMPTY(
     _SMP_lock_Stats_control.Iterator_chain
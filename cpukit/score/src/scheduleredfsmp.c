@@ -0,0 +1,423 @@
+/**
+ * @file
+ *
+ * @brief EDF SMP Scheduler Implementation
+ *
+ * @ingroup ScoreSchedulerEDFSMP
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/scheduleredfsmp.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static Scheduler_EDF_SMP_Context *
+_Scheduler_EDF_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_EDF_SMP_Context *) _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_EDF_SMP_Context *
+_Scheduler_EDF_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_EDF_SMP_Context *) context;
+}
+
+static Scheduler_EDF_SMP_Node *
+_Scheduler_EDF_SMP_Node_get( Thread_Control *thread )
+{
+  return (Scheduler_EDF_SMP_Node *) _Scheduler_Node_get( thread );
+}
+
+static Scheduler_EDF_SMP_Node *
+_Scheduler_EDF_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_EDF_SMP_Node *) node;
+}
+
+static int _Scheduler_EDF_SMP_RBTree_compare_function(
+  const RBTree_Node *n1,
+  const RBTree_Node *n2
+)
+{
+  Priority_Control value1 =
+    _RBTree_Container_of( n1, Scheduler_EDF_SMP_Node, Node )->Base.priority;
+  Priority_Control value2 =
+    _RBTree_Container_of( n2, Scheduler_EDF_SMP_Node, Node )->Base.priority;
+
+  /*
+   * This function compares only numbers for the red-black tree,
+   * but priorities have an opposite sense.
+   */
+  return -_Scheduler_EDF_Priority_compare( value1, value2 );
+}
+
+/*
+ * The order functions for the scheduled chain.  In contrast to the
+ * _Scheduler_SMP_Insert_priority_lifo_order() and
+ * _Scheduler_SMP_Insert_priority_fifo_order() the deadlines must be compared
+ * relative to the current time.
+ */
+
+static bool _Scheduler_EDF_SMP_Insert_priority_lifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  const Scheduler_SMP_Node *node_to_insert =
+    (const Scheduler_SMP_Node *) to_insert;
+  const Scheduler_SMP_Node *node_next =
+    (const Scheduler_SMP_Node *) next;
+
+  return _Scheduler_EDF_Priority_compare(
+    node_to_insert->priority,
+    node_next->priority
+  ) >= 0;
+}
+
+static bool _Scheduler_EDF_SMP_Insert_priority_fifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  const Scheduler_SMP_Node *node_to_insert =
+    (const Scheduler_SMP_Node *) to_insert;
+  const Scheduler_SMP_Node *node_next =
+    (const Scheduler_SMP_Node *) next;
+
+  return _Scheduler_EDF_Priority_compare(
+    node_to_insert->priority,
+    node_next->priority
+  ) > 0;
+}
+
+void _Scheduler_EDF_SMP_Initialize( const Scheduler_Control *scheduler )
+{
+  Scheduler_EDF_SMP_Context *self =
+    _Scheduler_EDF_SMP_Get_context( scheduler );
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  _RBTree_Initialize_empty(
+    &self->Ready,
+    _Scheduler_EDF_SMP_RBTree_compare_function,
+    false
+  );
+}
+
+void _Scheduler_EDF_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_EDF_SMP_Node *node = _Scheduler_EDF_SMP_Node_get( the_thread );
+
+  (void) scheduler;
+
+  _Scheduler_SMP_Node_initialize( &node->Base, the_thread );
+  node->queue_state = SCHEDULER_EDF_QUEUE_STATE_NEVER_HAS_BEEN;
+}
+
+static void _Scheduler_EDF_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *node = _Scheduler_SMP_Node_downcast( node_to_update );
+
+  (void) context;
+
+  _Scheduler_SMP_Node_update_priority( node, new_priority );
+}
+
+void _Scheduler_EDF_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Scheduler_EDF_SMP_Node *node = _Scheduler_EDF_SMP_Node_get( thread );
+
+  (void) new_priority;
+
+  if ( node->queue_state == SCHEDULER_EDF_QUEUE_STATE_NEVER_HAS_BEEN ) {
+    /* Shifts the priority to the region of background tasks. */
+    thread->Start.initial_priority |= SCHEDULER_EDF_PRIO_MSB;
+    thread->real_priority = thread->Start.initial_priority;
+    thread->current_priority = thread->Start.initial_priority;
+    node->queue_state = SCHEDULER_EDF_QUEUE_STATE_NOT_PRESENTLY;
+  }
+
+  _Scheduler_EDF_SMP_Do_update(
+    context,
+    &node->Base.Base,
+    thread->current_priority
+  );
+}
+
+static Scheduler_Node *_Scheduler_EDF_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  Scheduler_EDF_SMP_Context *self = _Scheduler_EDF_SMP_Get_self( context );
+  RBTree_Node *first = _RBTree_First( &self->Ready, RBT_LEFT );
+
+  (void) node;
+
+  _Assert( first != NULL );
+
+  return (Scheduler_Node *)
+    _RBTree_Container_of( first, Scheduler_EDF_SMP_Node, Node );
+}
+
+static void _Scheduler_EDF_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_EDF_SMP_Context *self = _Scheduler_EDF_SMP_Get_self( context );
+  Scheduler_EDF_SMP_Node *node =
+    _Scheduler_EDF_SMP_Node_downcast( node_to_insert );
+
+  _RBTree_Insert( &self->Ready, &node->Node );
+  node->queue_state = SCHEDULER_EDF_QUEUE_STATE_YES;
+}
+
+static void _Scheduler_EDF_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_EDF_SMP_Context *self = _Scheduler_EDF_SMP_Get_self( context );
+  Scheduler_EDF_SMP_Node *node =
+    _Scheduler_EDF_SMP_Node_downcast( node_to_extract );
+
+  _RBTree_Extract( &self->Ready, &node->Node );
+  node->queue_state = SCHEDULER_EDF_QUEUE_STATE_NOT_PRESENTLY;
+}
+
+static void _Scheduler_EDF_SMP_Insert_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_SMP_Context *self = _Scheduler_SMP_Get_self( context );
+
+  _Chain_Insert_ordered_unprotected(
+    &self->Scheduled,
+    &node_to_insert->Node,
+    _Scheduler_EDF_SMP_Insert_priority_lifo_order
+  );
+}
+
+static void _Scheduler_EDF_SMP_Insert_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  Scheduler_SMP_Context *self = _Scheduler_SMP_Get_self( context );
+
+  _Chain_Insert_ordered_unprotected(
+    &self->Scheduled,
+    &node_to_insert->Node,
+    _Scheduler_EDF_SMP_Insert_priority_fifo_order
+  );
+}
+
+static void _Scheduler_EDF_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node );
+  _Scheduler_EDF_SMP_Insert_ready( context, scheduled_to_ready );
+}
+
+static void _Scheduler_EDF_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  _Scheduler_EDF_SMP_Extract_from_ready( context, ready_to_scheduled );
+  _Scheduler_EDF_SMP_Insert_scheduled_fifo( context, ready_to_scheduled );
+}
+
+void _Scheduler_EDF_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    _Scheduler_EDF_SMP_Extract_from_ready,
+    _Scheduler_EDF_SMP_Get_highest_ready,
+    _Scheduler_EDF_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor
+  );
+}
+
+/*
+ * The red-black tree places nodes with equal deadlines in FIFO order, so the
+ * LIFO and FIFO variants differ only with respect to the scheduled chain.
+ * This is the same as in the uni-processor EDF scheduler which ignores the
+ * prepend indicator for the ready queue.
+ */
+
+static void _Scheduler_EDF_SMP_Enqueue_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  _Scheduler_SMP_Enqueue_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_EDF_SMP_Insert_ready,
+    insert_scheduled,
+    _Scheduler_EDF_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor
+  );
+}
+
+static void _Scheduler_EDF_SMP_Enqueue_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_EDF_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_EDF_SMP_Insert_priority_lifo_order,
+    _Scheduler_EDF_SMP_Insert_scheduled_lifo
+  );
+}
+
+static void _Scheduler_EDF_SMP_Enqueue_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_EDF_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_EDF_SMP_Insert_priority_fifo_order,
+    _Scheduler_EDF_SMP_Insert_scheduled_fifo
+  );
+}
+
+static void _Scheduler_EDF_SMP_Enqueue_scheduled_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  _Scheduler_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_EDF_SMP_Get_highest_ready,
+    _Scheduler_EDF_SMP_Insert_ready,
+    insert_scheduled,
+    _Scheduler_EDF_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor
+  );
+}
+
+static void _Scheduler_EDF_SMP_Enqueue_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_EDF_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_EDF_SMP_Insert_priority_lifo_order,
+    _Scheduler_EDF_SMP_Insert_scheduled_lifo
+  );
+}
+
+static void _Scheduler_EDF_SMP_Enqueue_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_EDF_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_EDF_SMP_Insert_priority_fifo_order,
+    _Scheduler_EDF_SMP_Insert_scheduled_fifo
+  );
+}
+
+void _Scheduler_EDF_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    _Scheduler_EDF_SMP_Enqueue_fifo
+  );
+}
+
+void _Scheduler_EDF_SMP_Change_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority,
+  bool                     prepend_it
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Change_priority(
+    context,
+    thread,
+    new_priority,
+    prepend_it,
+    _Scheduler_EDF_SMP_Extract_from_ready,
+    _Scheduler_EDF_SMP_Do_update,
+    _Scheduler_EDF_SMP_Enqueue_fifo,
+    _Scheduler_EDF_SMP_Enqueue_lifo,
+    _Scheduler_EDF_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_EDF_SMP_Enqueue_scheduled_lifo
+  );
+}
+
+void _Scheduler_EDF_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    _Scheduler_EDF_SMP_Extract_from_ready,
+    _Scheduler_EDF_SMP_Enqueue_fifo,
+    _Scheduler_EDF_SMP_Enqueue_scheduled_fifo
+  );
+}
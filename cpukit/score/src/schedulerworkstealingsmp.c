@@ -0,0 +1,783 @@
+/**
+ * @file
+ *
+ * @brief Work Stealing SMP Scheduler Implementation
+ *
+ * @ingroup ScoreSchedulerWorkStealingSMP
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/schedulerworkstealingsmp.h>
+#include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/config.h>
+
+static Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_work_stealing_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_work_stealing_SMP_Context *) context;
+}
+
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Node_get( Thread_Control *thread )
+{
+  return (Scheduler_work_stealing_SMP_Node *) _Scheduler_Node_get( thread );
+}
+
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_work_stealing_SMP_Node *) node;
+}
+
+static uint32_t _Scheduler_work_stealing_SMP_Get_CPU_index(
+  const Scheduler_work_stealing_SMP_Node *node
+)
+{
+  Thread_Control *thread = _Scheduler_Node_get_owner( &node->Base.Base );
+
+  return _Per_CPU_Get_index( _Thread_Get_CPU( thread ) );
+}
+
+static bool _Scheduler_work_stealing_SMP_Is_allowed(
+  const Scheduler_work_stealing_SMP_Node *node,
+  uint32_t                                cpu_index
+)
+{
+  return CPU_ISSET( (int) cpu_index, node->Affinity.set );
+}
+
+static bool _Scheduler_work_stealing_SMP_Is_eligible(
+  const Scheduler_Context                *context,
+  const Scheduler_work_stealing_SMP_Node *node,
+  uint32_t                                cpu_index
+)
+{
+  return _Scheduler_SMP_Is_processor_owned_by_us(
+      context,
+      _Per_CPU_Get_by_index( cpu_index )
+    )
+    && _Scheduler_work_stealing_SMP_Is_allowed( node, cpu_index );
+}
+
+/*
+ * The get lowest scheduled operation of this scheduler may not find a node to
+ * replace.  In this case it returns NULL.
+ */
+static bool _Scheduler_work_stealing_SMP_Insert_priority_lifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_lifo_order( to_insert, next );
+}
+
+static bool _Scheduler_work_stealing_SMP_Insert_priority_fifo_order(
+  const Chain_Node *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Insert_priority_fifo_order( to_insert, next );
+}
+
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_context( scheduler );
+  uint32_t cpu_max = rtems_configuration_get_maximum_processors();
+  uint32_t cpu_index;
+
+  _Scheduler_SMP_Initialize( &self->Base );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    _Chain_Initialize_empty( &self->Queues[ cpu_index ].Ready );
+  }
+}
+
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_get( the_thread );
+
+  (void) scheduler;
+
+  _Scheduler_SMP_Node_initialize( &node->Base, the_thread );
+
+  node->Affinity     = *_CPU_set_Default();
+  node->Affinity.set = &node->Affinity.preallocated;
+  node->is_idle      = false;
+}
+
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_get( thread );
+
+  /*
+   * The idle thread stays on its processor.  So each processor finds its idle
+   * thread in its own ready chain if nothing else is ready.
+   */
+  node->is_idle = true;
+  CPU_ZERO_S( node->Affinity.setsize, node->Affinity.set );
+  CPU_SET_S(
+    (int) _Per_CPU_Get_index( cpu ),
+    node->Affinity.setsize,
+    node->Affinity.set
+  );
+
+  _Scheduler_SMP_Start_idle( scheduler, thread, cpu );
+}
+
+static void _Scheduler_work_stealing_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *node = _Scheduler_SMP_Node_downcast( node_to_update );
+
+  (void) context;
+
+  _Scheduler_SMP_Node_update_priority( node, new_priority );
+}
+
+void _Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Scheduler_Node *node = _Scheduler_Node_get( thread );
+
+  _Scheduler_work_stealing_SMP_Do_update( context, node, new_priority );
+}
+
+/*
+ * A node becomes ready on the processor it executed last.  In case this
+ * processor is not in the affinity set or not owned by this scheduler
+ * instance (the affinity set or the scheduler changed), then it becomes ready
+ * on the first such processor.
+ */
+static Chain_Control *_Scheduler_work_stealing_SMP_Select_ready_chain(
+  Scheduler_Context                *context,
+  Scheduler_work_stealing_SMP_Node *node
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  uint32_t cpu_index = _Scheduler_work_stealing_SMP_Get_CPU_index( node );
+
+  if ( !_Scheduler_work_stealing_SMP_Is_eligible( context, node, cpu_index ) ) {
+    uint32_t cpu_count = _SMP_Get_processor_count();
+
+    for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+      if (
+        _Scheduler_work_stealing_SMP_Is_eligible( context, node, cpu_index )
+      ) {
+        break;
+      }
+    }
+
+    _Assert( cpu_index < cpu_count );
+  }
+
+  return &self->Queues[ cpu_index ].Ready;
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_ready_ordered(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert,
+  Chain_Node_order   order
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_downcast( node_to_insert );
+
+  _Chain_Insert_ordered_unprotected(
+    _Scheduler_work_stealing_SMP_Select_ready_chain( context, node ),
+    &node_to_insert->Node,
+    order
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_ready_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  _Scheduler_work_stealing_SMP_Insert_ready_ordered(
+    context,
+    node_to_insert,
+    _Scheduler_SMP_Insert_priority_lifo_order
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Insert_ready_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_insert
+)
+{
+  _Scheduler_work_stealing_SMP_Insert_ready_ordered(
+    context,
+    node_to_insert,
+    _Scheduler_SMP_Insert_priority_fifo_order
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  (void) context;
+
+  _Chain_Extract_unprotected( &node_to_extract->Node );
+}
+
+static void _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node );
+  _Scheduler_work_stealing_SMP_Insert_ready_lifo(
+    context,
+    scheduled_to_ready
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+
+  _Chain_Extract_unprotected( &ready_to_scheduled->Node );
+  _Chain_Insert_ordered_unprotected(
+    &self->Base.Scheduled,
+    &ready_to_scheduled->Node,
+    _Scheduler_SMP_Insert_priority_fifo_order
+  );
+}
+
+/*
+ * Returns the highest priority ready node of the other processors which is
+ * allowed to execute on the specified processor.  Only the nodes up to the
+ * first allowed node of each ready chain need to be inspected since the
+ * chains are ordered by priority.
+ */
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Get_highest_remote(
+  Scheduler_work_stealing_SMP_Context *self,
+  uint32_t                             cpu_index
+)
+{
+  Scheduler_work_stealing_SMP_Node *highest = NULL;
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t other_index;
+
+  for ( other_index = 0 ; other_index < cpu_count ; ++other_index ) {
+    Chain_Control *ready = &self->Queues[ other_index ].Ready;
+    Chain_Node    *chain_node;
+
+    if ( other_index == cpu_index ) {
+      continue;
+    }
+
+    for ( chain_node = _Chain_First( ready ) ;
+          chain_node != _Chain_Immutable_tail( ready ) ;
+          chain_node = _Chain_Next( chain_node ) ) {
+      Scheduler_work_stealing_SMP_Node *node =
+        (Scheduler_work_stealing_SMP_Node *) chain_node;
+
+      if (
+        highest != NULL
+          && node->Base.priority >= highest->Base.priority
+      ) {
+        break;
+      }
+
+      if ( _Scheduler_work_stealing_SMP_Is_allowed( node, cpu_index ) ) {
+        highest = node;
+        break;
+      }
+    }
+  }
+
+  return highest;
+}
+
+/*
+ * Selects the node to replace the victim on its processor.  This is the
+ * highest priority node of the local ready chain.  Only in case the local
+ * ready chain offers nothing but the idle thread a node is stolen from
+ * another processor.
+ */
+static Scheduler_Node *_Scheduler_work_stealing_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *victim
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  uint32_t cpu_index = _Scheduler_work_stealing_SMP_Get_CPU_index(
+    _Scheduler_work_stealing_SMP_Node_downcast( victim )
+  );
+  Chain_Control *ready = &self->Queues[ cpu_index ].Ready;
+  Scheduler_work_stealing_SMP_Node *highest = NULL;
+
+  if ( !_Chain_Is_empty( ready ) ) {
+    highest = (Scheduler_work_stealing_SMP_Node *) _Chain_First( ready );
+  }
+
+  if ( highest == NULL || highest->is_idle ) {
+    Scheduler_work_stealing_SMP_Node *stolen =
+      _Scheduler_work_stealing_SMP_Get_highest_remote( self, cpu_index );
+
+    if ( stolen != NULL ) {
+      highest = stolen;
+    }
+  }
+
+  _Assert( highest != NULL );
+
+  return &highest->Base.Base;
+}
+
+/*
+ * Selects the scheduled node to replace by the filter node.  A processor
+ * executing its idle thread is preferred, then the processor the filter node
+ * executed last.  Other processors are left alone, the filter node will be
+ * stolen by them if necessary.  Returns NULL in case no scheduled node may be
+ * replaced, e.g. all processors execute more important threads.
+ */
+static Scheduler_Node *_Scheduler_work_stealing_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base,
+  Chain_Node_order   order
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  Scheduler_work_stealing_SMP_Node *filter =
+    _Scheduler_work_stealing_SMP_Node_downcast( filter_base );
+  Chain_Control *scheduled = &self->Base.Scheduled;
+  uint32_t home_index = _Scheduler_work_stealing_SMP_Get_CPU_index( filter );
+  Scheduler_work_stealing_SMP_Node *idle = NULL;
+  Scheduler_work_stealing_SMP_Node *home = NULL;
+  Chain_Node *chain_node;
+
+  for ( chain_node = _Chain_Last( scheduled );
+        chain_node != _Chain_Immutable_head( scheduled ) ;
+        chain_node = _Chain_Previous( chain_node ) ) {
+    Scheduler_work_stealing_SMP_Node *node =
+      (Scheduler_work_stealing_SMP_Node *) chain_node;
+    uint32_t cpu_index;
+
+    /*
+     * The remaining scheduled nodes are of equal or higher importance than
+     * the filter node.
+     */
+    if ( !( *order )( &filter->Base.Base.Node, chain_node ) ) {
+      break;
+    }
+
+    cpu_index = _Scheduler_work_stealing_SMP_Get_CPU_index( node );
+
+    if ( !_Scheduler_work_stealing_SMP_Is_allowed( filter, cpu_index ) ) {
+      continue;
+    }
+
+    if ( node->is_idle ) {
+      if ( idle == NULL || cpu_index == home_index ) {
+        idle = node;
+      }
+    } else if ( cpu_index == home_index ) {
+      home = node;
+    }
+  }
+
+  if ( idle != NULL ) {
+    return &idle->Base.Base;
+  } else if ( home != NULL ) {
+    return &home->Base.Base;
+  } else {
+    return NULL;
+  }
+}
+
+static void _Scheduler_work_stealing_SMP_Allocate_processor(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled,
+  Scheduler_Node    *victim
+)
+{
+  Thread_Control  *victim_thread = _Scheduler_Node_get_owner( victim );
+  Thread_Control  *scheduled_thread = _Scheduler_Node_get_owner( scheduled );
+  Per_CPU_Control *victim_cpu = _Thread_Get_CPU( victim_thread );
+  Per_CPU_Control *cpu_self = _Per_CPU_Get();
+
+  (void) context;
+
+  _Scheduler_SMP_Node_change_state(
+    _Scheduler_SMP_Node_downcast( scheduled ),
+    SCHEDULER_SMP_NODE_SCHEDULED
+  );
+
+  _Thread_Set_CPU( scheduled_thread, victim_cpu );
+  _Scheduler_SMP_Update_heir( cpu_self, victim_cpu, scheduled_thread );
+}
+
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  Scheduler_Node *lowest_scheduled =
+    _Scheduler_work_stealing_SMP_Get_lowest_scheduled( context, node, order );
+
+  /*
+   * This is _Scheduler_SMP_Enqueue_ordered() except that the node waits in
+   * the ready set in case no scheduled node may be replaced.
+   */
+  if ( lowest_scheduled != NULL ) {
+    _Scheduler_SMP_Node_change_state(
+      _Scheduler_SMP_Node_downcast( lowest_scheduled ),
+      SCHEDULER_SMP_NODE_READY
+    );
+    _Scheduler_work_stealing_SMP_Allocate_processor(
+      context,
+      node,
+      lowest_scheduled
+    );
+    ( *insert_scheduled )( context, node );
+    _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+      context,
+      lowest_scheduled
+    );
+  } else {
+    ( *insert_ready )( context, node );
+  }
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_work_stealing_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_work_stealing_SMP_Insert_priority_lifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_work_stealing_SMP_Enqueue_ordered(
+    context,
+    node,
+    _Scheduler_work_stealing_SMP_Insert_priority_fifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+  Scheduler_Context    *context,
+  Scheduler_Node       *node,
+  Chain_Node_order      order,
+  Scheduler_SMP_Insert  insert_ready,
+  Scheduler_SMP_Insert  insert_scheduled
+)
+{
+  _Scheduler_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    order,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    insert_ready,
+    insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_scheduled_lifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_lifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_lifo,
+    _Scheduler_SMP_Insert_scheduled_lifo
+  );
+}
+
+static void _Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo(
+  Scheduler_Context *context,
+  Scheduler_Node    *node
+)
+{
+  _Scheduler_work_stealing_SMP_Enqueue_scheduled_ordered(
+    context,
+    node,
+    _Scheduler_SMP_Insert_priority_fifo_order,
+    _Scheduler_work_stealing_SMP_Insert_ready_fifo,
+    _Scheduler_SMP_Insert_scheduled_fifo
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Change_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Priority_Control         new_priority,
+  bool                     prepend_it
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Change_priority(
+    context,
+    thread,
+    new_priority,
+    prepend_it,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_lifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_lifo
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Enqueue_fifo,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled_fifo
+  );
+}
+
+static Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Get_scheduled(
+  Scheduler_work_stealing_SMP_Context *self,
+  uint32_t                             cpu_index
+)
+{
+  Chain_Control *scheduled = &self->Base.Scheduled;
+  Chain_Node    *chain_node;
+
+  for ( chain_node = _Chain_First( scheduled );
+        chain_node != _Chain_Immutable_tail( scheduled ) ;
+        chain_node = _Chain_Next( chain_node ) ) {
+    Scheduler_work_stealing_SMP_Node *node =
+      (Scheduler_work_stealing_SMP_Node *) chain_node;
+
+    if ( _Scheduler_work_stealing_SMP_Get_CPU_index( node ) == cpu_index ) {
+      return node;
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * Steals a ready node of another processor in case it is more important than
+ * the node scheduled on the specified processor.
+ */
+static void _Scheduler_work_stealing_SMP_Steal(
+  Scheduler_Context *context,
+  Per_CPU_Control   *cpu
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_self( context );
+  uint32_t cpu_index = _Per_CPU_Get_index( cpu );
+  Scheduler_work_stealing_SMP_Node *victim;
+  Scheduler_work_stealing_SMP_Node *stolen;
+
+  victim = _Scheduler_work_stealing_SMP_Get_scheduled( self, cpu_index );
+  if ( victim == NULL ) {
+    return;
+  }
+
+  stolen = _Scheduler_work_stealing_SMP_Get_highest_remote( self, cpu_index );
+  if (
+    stolen == NULL
+      || ( !victim->is_idle
+        && stolen->Base.priority >= victim->Base.priority )
+  ) {
+    return;
+  }
+
+  _Scheduler_SMP_Node_change_state( &victim->Base, SCHEDULER_SMP_NODE_READY );
+  _Scheduler_work_stealing_SMP_Allocate_processor(
+    context,
+    &stolen->Base.Base,
+    &victim->Base.Base
+  );
+  _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled(
+    context,
+    &stolen->Base.Base
+  );
+  _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+    context,
+    &victim->Base.Base
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Tick(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *executing
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+  Per_CPU_Control *cpu = _Thread_Get_CPU( executing );
+  ISR_Level level;
+
+  _Scheduler_default_Tick( scheduler, executing );
+
+  _ISR_Disable( level );
+
+  if ( _Scheduler_SMP_Is_processor_owned_by_us( context, cpu ) ) {
+    _Scheduler_work_stealing_SMP_Steal( context, cpu );
+  }
+
+  _ISR_Enable( level );
+}
+
+bool _Scheduler_work_stealing_SMP_Get_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  cpu_set_t               *cpuset
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_get( thread );
+
+  (void) scheduler;
+
+  if ( node->Affinity.setsize != cpusetsize ) {
+    return false;
+  }
+
+  CPU_COPY( cpuset, node->Affinity.set );
+  return true;
+}
+
+bool _Scheduler_work_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  size_t                   cpusetsize,
+  const cpu_set_t         *cpuset
+)
+{
+  Scheduler_work_stealing_SMP_Node *node =
+    _Scheduler_work_stealing_SMP_Node_get( thread );
+
+  (void) scheduler;
+
+  if ( node->is_idle || !_CPU_set_Is_valid( cpuset, cpusetsize ) ) {
+    return false;
+  }
+
+  if ( CPU_EQUAL_S( cpusetsize, cpuset, node->Affinity.set ) ) {
+    return true;
+  }
+
+  /*
+   * Block and unblock the thread to move it to a ready chain and processor
+   * of the new affinity set.
+   */
+  _Thread_Set_state( thread, STATES_MIGRATING );
+  CPU_COPY( node->Affinity.set, cpuset );
+  _Thread_Clear_state( thread, STATES_MIGRATING );
+
+  return true;
+}
@@ -159,7 +159,7 @@ void _SMP_Send_message( uint32_t cpu_index, unsigned long message )
 
   _Atomic_Fetch_or_ulong( &cpu->message, message, ATOMIC_ORDER_RELAXED );
 
-  _CPU_SMP_Send_interrupt( cpu_index );
+  _Per_CPU_Send_interrupt( cpu );
 }
 
 void _SMP_Broadcast_message( uint32_t message )
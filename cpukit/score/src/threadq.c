@@ -22,6 +22,26 @@
 #include <rtems/score/chainimpl.h>
 #include <rtems/score/scheduler.h>
 
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+)
+{
+  Priority_Control left_priority =
+    _RBTree_Container_of( left, Thread_Control, RBNode )->current_priority;
+  Priority_Control right_priority =
+    _RBTree_Container_of( right, Thread_Control, RBNode )->current_priority;
+
+  /*
+   * SuperCore priorities use lower numbers to indicate greater importance.
+   */
+  if ( left_priority == right_priority )
+    return 0;
+  if ( left_priority < right_priority )
+    return -1;
+  return 1;
+}
+
 void _Thread_queue_Initialize(
   Thread_queue_Control         *the_thread_queue,
   Thread_queue_Disciplines      the_discipline,
@@ -37,14 +57,16 @@ void _Thread_queue_Initialize(
   the_thread_queue->discipline     = the_discipline;
   the_thread_queue->timeout_status = timeout_status;
   the_thread_queue->sync_state     = THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
+  the_thread_queue->waiters_possible = false;
 
-  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
-    uint32_t   index;
+  _ISR_lock_Initialize( &the_thread_queue->Lock, "Thread Queue" );
 
-    for( index=0 ;
-         index < TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS ;
-         index++)
-      _Chain_Initialize_empty( &the_thread_queue->Queues.Priority[index] );
+  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
+    _RBTree_Initialize_empty(
+      &the_thread_queue->Queues.Priority,
+      _Thread_queue_Compare_priority,
+      false
+    );
   } else { /* must be THREAD_QUEUE_DISCIPLINE_FIFO */
     _Chain_Initialize_empty( &the_thread_queue->Queues.Fifo );
   }
@@ -28,7 +28,7 @@ Thread_Control *_Thread_queue_Dequeue(
 {
   Thread_Control *(*dequeue_p)( Thread_queue_Control * );
   Thread_Control *the_thread;
-  ISR_Level       level;
+  ISR_lock_Context lock_context;
   Thread_blocking_operation_States  sync_state;
 
   if ( the_thread_queue->discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY )
@@ -37,15 +37,22 @@ Thread_Control *_Thread_queue_Dequeue(
     dequeue_p = _Thread_queue_Dequeue_fifo;
 
   the_thread = (*dequeue_p)( the_thread_queue );
-  _ISR_Disable( level );
+  _Thread_queue_Acquire( the_thread_queue, &lock_context );
     if ( !the_thread ) {
       sync_state = the_thread_queue->sync_state;
       if ( (sync_state == THREAD_BLOCKING_OPERATION_TIMEOUT) ||
            (sync_state == THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED) ) {
         the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_SATISFIED;
         the_thread = _Thread_Executing;
+      } else {
+        /*
+         *  The thread queue is empty and since we are in a thread dispatch
+         *  disabled section no other thread is in the process to block on
+         *  it.
+         */
+        the_thread_queue->waiters_possible = false;
       }
     }
-  _ISR_Enable( level );
+  _Thread_queue_Release( the_thread_queue, &lock_context );
   return the_thread;
 }
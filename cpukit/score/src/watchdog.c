@@ -24,13 +24,27 @@
 #include <rtems/system.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/config.h>
 
 void _Watchdog_Handler_initialization( void )
 {
-  _Watchdog_Sync_count = 0;
-  _Watchdog_Sync_level = 0;
+#if defined(RTEMS_SMP)
+  uint32_t cpu_max = rtems_configuration_get_maximum_processors();
+  uint32_t cpu_index;
+#endif
+
+  _Watchdog_Sync_initialize( &_Watchdog_Sync );
   _Watchdog_Ticks_since_boot = 0;
 
-  _Chain_Initialize_empty( &_Watchdog_Ticks_chain );
+#if defined(RTEMS_SMP)
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Per_CPU_Control *cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    cpu->Watchdog_ticks = &_Watchdog_Ticks_per_CPU[ cpu_index ];
+    _Watchdog_Ticks_initialize( cpu->Watchdog_ticks );
+  }
+#else
+  _Watchdog_Ticks_initialize( _Watchdog_Ticks_get() );
+#endif
   _Chain_Initialize_empty( &_Watchdog_Seconds_chain );
 }
@@ -23,14 +23,15 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Adjust(
+  Watchdog_Sync_control       *sync,
   Chain_Control               *header,
   Watchdog_Adjust_directions   direction,
   Watchdog_Interval            units
 )
 {
-  ISR_Level level;
+  ISR_lock_Context lock_context;
 
-  _ISR_Disable( level );
+  _Watchdog_Sync_acquire( sync, &lock_context );
 
   /*
    * NOTE: It is safe NOT to make 'header' a pointer
@@ -55,11 +56,11 @@ void _Watchdog_Adjust(
             units -= _Watchdog_First( header )->delta_interval;
             _Watchdog_First( header )->delta_interval = 1;
 
-            _ISR_Enable( level );
+            _Watchdog_Sync_release( sync, &lock_context );
 
-            _Watchdog_Tickle( header );
+            _Watchdog_Tickle( sync, header );
 
-            _ISR_Disable( level );
+            _Watchdog_Sync_acquire( sync, &lock_context );
 
             if ( _Chain_Is_empty( header ) )
               break;
@@ -69,6 +70,6 @@ void _Watchdog_Adjust(
     }
   }
 
-  _ISR_Enable( level );
+  _Watchdog_Sync_release( sync, &lock_context );
 
 }
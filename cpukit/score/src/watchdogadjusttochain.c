@@ -23,6 +23,7 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Adjust_to_chain(
+  Watchdog_Sync_control       *sync,
   Chain_Control               *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
@@ -30,10 +31,10 @@ void _Watchdog_Adjust_to_chain(
 )
 {
   Watchdog_Interval  units = units_arg;
-  ISR_Level          level;
+  ISR_lock_Context   lock_context;
   Watchdog_Control  *first;
 
-  _ISR_Disable( level );
+  _Watchdog_Sync_acquire( sync, &lock_context );
 
   while ( 1 ) {
     if ( _Chain_Is_empty( header ) ) {
@@ -61,7 +62,7 @@ void _Watchdog_Adjust_to_chain(
       _Chain_Extract_unprotected( &first->Node );
       _Chain_Append_unprotected( to_fire, &first->Node );
 
-      _ISR_Flash( level );
+      _Watchdog_Sync_flash( sync, &lock_context );
 
       if ( _Chain_Is_empty( header ) )
         break;
@@ -71,6 +72,6 @@ void _Watchdog_Adjust_to_chain(
     }
   }
 
-  _ISR_Enable( level );
+  _Watchdog_Sync_release( sync, &lock_context );
 }
 
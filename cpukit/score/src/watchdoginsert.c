@@ -23,19 +23,17 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Insert(
+  Watchdog_Sync_control *sync,
   Chain_Control         *header,
   Watchdog_Control      *the_watchdog
 )
 {
-  ISR_Level          level;
+  ISR_lock_Context   lock_context;
   Watchdog_Control  *after;
-  uint32_t           insert_isr_nest_level;
+  uint32_t           generation;
   Watchdog_Interval  delta_interval;
 
-
-  insert_isr_nest_level   = _ISR_Nest_level;
-
-  _ISR_Disable( level );
+  _Watchdog_Sync_acquire( sync, &lock_context );
 
   /*
    *  Check to see if the watchdog has just been inserted by a
@@ -43,14 +41,15 @@ void _Watchdog_Insert(
    */
 
   if ( the_watchdog->state != WATCHDOG_INACTIVE ) {
-    _ISR_Enable( level );
+    _Watchdog_Sync_release( sync, &lock_context );
     return;
   }
 
   the_watchdog->state = WATCHDOG_BEING_INSERTED;
-  _Watchdog_Sync_count++;
+  the_watchdog->sync = sync;
 
 restart:
+  generation = sync->generation;
   delta_interval = the_watchdog->initial;
 
   for ( after = _Watchdog_First( header ) ;
@@ -67,14 +66,17 @@ restart:
 
      delta_interval -= after->delta_interval;
 
-     _ISR_Flash( level );
+     _Watchdog_Sync_flash( sync, &lock_context );
 
      if ( the_watchdog->state != WATCHDOG_BEING_INSERTED ) {
        goto exit_insert;
      }
 
-     if ( _Watchdog_Sync_level > insert_isr_nest_level ) {
-       _Watchdog_Sync_level = insert_isr_nest_level;
+     /*
+      *  Another insert or a remove changed the chain while the lock was
+      *  released, so the walk must start again.
+      */
+     if ( sync->generation != generation ) {
        goto restart;
      }
   }
@@ -87,8 +89,8 @@ restart:
 
   the_watchdog->start_time = _Watchdog_Ticks_since_boot;
 
+  ++sync->generation;
+
 exit_insert:
-  _Watchdog_Sync_level = insert_isr_nest_level;
-  _Watchdog_Sync_count--;
-  _ISR_Enable( level );
+  _Watchdog_Sync_release( sync, &lock_context );
 }
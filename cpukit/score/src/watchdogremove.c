@@ -22,15 +22,14 @@
 #include <rtems/score/isr.h>
 #include <rtems/score/watchdogimpl.h>
 
-Watchdog_States _Watchdog_Remove(
-  Watchdog_Control *the_watchdog
+Watchdog_States _Watchdog_Remove_locked(
+  Watchdog_Sync_control *sync,
+  Watchdog_Control      *the_watchdog
 )
 {
-  ISR_Level         level;
   Watchdog_States   previous_state;
   Watchdog_Control *next_watchdog;
 
-  _ISR_Disable( level );
   previous_state = the_watchdog->state;
   switch ( previous_state ) {
     case WATCHDOG_INACTIVE:
@@ -49,19 +48,64 @@ Watchdog_States _Watchdog_Remove(
     case WATCHDOG_REMOVE_IT:
 
       the_watchdog->state = WATCHDOG_INACTIVE;
+
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+      /*
+       *  Watchdogs on a timing wheel carry their absolute expiration tick,
+       *  so there is no delta interval to hand over to the next watchdog.
+       */
+      if ( the_watchdog->wheel != NULL ) {
+        the_watchdog->wheel = NULL;
+        _Chain_Extract_unprotected( &the_watchdog->Node );
+        break;
+      }
+#endif
+
       next_watchdog = _Watchdog_Next( the_watchdog );
 
       if ( _Watchdog_Next(next_watchdog) )
         next_watchdog->delta_interval += the_watchdog->delta_interval;
 
-      if ( _Watchdog_Sync_count )
-        _Watchdog_Sync_level = _ISR_Nest_level;
+      ++sync->generation;
 
       _Chain_Extract_unprotected( &the_watchdog->Node );
       break;
   }
   the_watchdog->stop_time = _Watchdog_Ticks_since_boot;
 
-  _ISR_Enable( level );
+  return( previous_state );
+}
+
+Watchdog_States _Watchdog_Remove(
+  Watchdog_Control *the_watchdog
+)
+{
+  ISR_lock_Context       lock_context;
+  Watchdog_Sync_control *sync;
+  Watchdog_States        previous_state;
+
+  /*
+   *  The watchdog may move to another set until we own the lock of its
+   *  current set.  A watchdog which was never inserted is inactive.
+   */
+  while ( true ) {
+    sync = the_watchdog->sync;
+
+    if ( sync == NULL ) {
+      sync = &_Watchdog_Sync;
+    }
+
+    _Watchdog_Sync_acquire( sync, &lock_context );
+
+    if ( the_watchdog->sync == sync || the_watchdog->sync == NULL ) {
+      break;
+    }
+
+    _Watchdog_Sync_release( sync, &lock_context );
+  }
+
+  previous_state = _Watchdog_Remove_locked( sync, the_watchdog );
+
+  _Watchdog_Sync_release( sync, &lock_context );
   return( previous_state );
 }
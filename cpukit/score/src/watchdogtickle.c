@@ -23,10 +23,11 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Tickle(
-  Chain_Control *header
+  Watchdog_Sync_control *sync,
+  Chain_Control         *header
 )
 {
-  ISR_Level level;
+  ISR_lock_Context lock_context;
   Watchdog_Control *the_watchdog;
   Watchdog_States  watchdog_state;
 
@@ -36,7 +37,7 @@ void _Watchdog_Tickle(
    * volatile data - till, 2003/7
    */
 
-  _ISR_Disable( level );
+  _Watchdog_Sync_acquire( sync, &lock_context );
 
   if ( _Chain_Is_empty( header ) )
     goto leave;
@@ -75,16 +76,17 @@ void _Watchdog_Tickle(
   }
 
   do {
-     watchdog_state = _Watchdog_Remove( the_watchdog );
+     Watchdog_Service_routine_entry  routine = the_watchdog->routine;
+     Objects_Id                      id = the_watchdog->id;
+     void                           *user_data = the_watchdog->user_data;
 
-     _ISR_Enable( level );
+     watchdog_state = _Watchdog_Remove_locked( sync, the_watchdog );
+
+     _Watchdog_Sync_release( sync, &lock_context );
 
      switch( watchdog_state ) {
        case WATCHDOG_ACTIVE:
-         (*the_watchdog->routine)(
-           the_watchdog->id,
-           the_watchdog->user_data
-         );
+         _Watchdog_Fire( routine, id, user_data );
          break;
 
        case WATCHDOG_INACTIVE:
@@ -107,12 +109,12 @@ void _Watchdog_Tickle(
          break;
      }
 
-     _ISR_Disable( level );
+     _Watchdog_Sync_acquire( sync, &lock_context );
 
      the_watchdog = _Watchdog_First( header );
    } while ( !_Chain_Is_empty( header ) &&
              (the_watchdog->delta_interval == 0) );
 
 leave:
-   _ISR_Enable(level);
+   _Watchdog_Sync_release( sync, &lock_context );
 }
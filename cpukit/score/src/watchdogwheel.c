@@ -0,0 +1,39 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timing Wheel Initialization
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+void _Watchdog_Wheel_initialize(
+  Watchdog_Wheel *wheel
+)
+{
+  unsigned int level;
+  unsigned int index;
+
+  wheel->current = 0;
+
+  for ( index = 0 ; index < WATCHDOG_WHEEL_ROOT_SIZE ; ++index )
+    _Chain_Initialize_empty( &wheel->Root[ index ] );
+
+  for ( level = 0 ; level < WATCHDOG_WHEEL_LEVELS ; ++level ) {
+    for ( index = 0 ; index < WATCHDOG_WHEEL_LEVEL_SIZE ; ++index )
+      _Chain_Initialize_empty( &wheel->Levels[ level ][ index ] );
+  }
+}
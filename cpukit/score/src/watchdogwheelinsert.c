@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timing Wheel Insert
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/watchdogimpl.h>
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Sync_control *sync,
+  Watchdog_Wheel        *wheel,
+  Watchdog_Control      *the_watchdog
+)
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Interval units;
+
+  _Watchdog_Sync_acquire( sync, &lock_context );
+
+  /*
+   *  Check to see if the watchdog has just been inserted by a
+   *  higher priority interrupt.  If so, abandon this insert.
+   */
+
+  if ( the_watchdog->state != WATCHDOG_INACTIVE ) {
+    _Watchdog_Sync_release( sync, &lock_context );
+    return;
+  }
+
+  /*
+   *  The current tick is processed by the next tickle.  An interval of zero
+   *  behaves like an interval of one as on the delta chain.
+   */
+  units = the_watchdog->initial;
+  if ( units > 0 )
+    --units;
+
+  the_watchdog->expire = wheel->current + units;
+  the_watchdog->wheel = wheel;
+  the_watchdog->sync = sync;
+
+  _Watchdog_Wheel_enqueue( wheel, the_watchdog );
+
+  _Watchdog_Activate( the_watchdog );
+
+  the_watchdog->start_time = _Watchdog_Ticks_since_boot;
+
+  _Watchdog_Sync_release( sync, &lock_context );
+}
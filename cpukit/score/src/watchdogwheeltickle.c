@@ -0,0 +1,116 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Timing Wheel Tickle
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/watchdogimpl.h>
+
+/*
+ *  Moves all watchdogs of an outer level slot to their slot relative to the
+ *  current tick.  Since the current tick is a multiple of the slot
+ *  granularity at this point, none of them will return to this slot.
+ */
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Sync_control *sync,
+  Watchdog_Wheel        *wheel,
+  Chain_Control         *slot,
+  ISR_lock_Context      *lock_context
+)
+{
+  while ( !_Chain_Is_empty( slot ) ) {
+    Watchdog_Control *the_watchdog;
+
+    the_watchdog = (Watchdog_Control *) _Chain_Get_first_unprotected( slot );
+    _Watchdog_Wheel_enqueue( wheel, the_watchdog );
+
+    _Watchdog_Sync_flash( sync, lock_context );
+  }
+}
+
+void _Watchdog_Wheel_tickle(
+  Watchdog_Sync_control *sync,
+  Watchdog_Wheel        *wheel
+)
+{
+  ISR_lock_Context   lock_context;
+  Chain_Control      fire;
+  Chain_Control     *slot;
+  Watchdog_Interval  current;
+
+  _Watchdog_Sync_acquire( sync, &lock_context );
+
+  current = wheel->current;
+
+  if ( ( current & WATCHDOG_WHEEL_ROOT_MASK ) == 0 ) {
+    unsigned int outer = 0;
+    unsigned int shift = WATCHDOG_WHEEL_ROOT_BITS;
+    unsigned int index;
+
+    do {
+      index = ( current >> shift ) & WATCHDOG_WHEEL_LEVEL_MASK;
+      _Watchdog_Wheel_cascade(
+        sync,
+        wheel,
+        &wheel->Levels[ outer ][ index ],
+        &lock_context
+      );
+      ++outer;
+      shift += WATCHDOG_WHEEL_LEVEL_BITS;
+    } while ( index == 0 && outer < WATCHDOG_WHEEL_LEVELS );
+  }
+
+  /*
+   *  Watchdogs inserted from now on expire at a later tick.  Move the
+   *  expired watchdogs to a private chain, since an insert with the maximum
+   *  root interval would otherwise end up in the slot we are processing.
+   */
+  wheel->current = current + 1;
+
+  _Chain_Initialize_empty( &fire );
+  slot = &wheel->Root[ current & WATCHDOG_WHEEL_ROOT_MASK ];
+
+  while ( !_Chain_Is_empty( slot ) ) {
+    _Chain_Append_unprotected( &fire, _Chain_Get_first_unprotected( slot ) );
+  }
+
+  while ( !_Chain_Is_empty( &fire ) ) {
+    Watchdog_Control               *the_watchdog;
+    Watchdog_States                 watchdog_state;
+    Watchdog_Service_routine_entry  routine;
+    Objects_Id                      id;
+    void                           *user_data;
+
+    the_watchdog = (Watchdog_Control *) _Chain_First( &fire );
+    routine = the_watchdog->routine;
+    id = the_watchdog->id;
+    user_data = the_watchdog->user_data;
+    watchdog_state = _Watchdog_Remove_locked( sync, the_watchdog );
+
+    _Watchdog_Sync_release( sync, &lock_context );
+
+    if ( watchdog_state == WATCHDOG_ACTIVE ) {
+      _Watchdog_Fire( routine, id, user_data );
+    }
+
+    _Watchdog_Sync_acquire( sync, &lock_context );
+  }
+
+  _Watchdog_Sync_release( sync, &lock_context );
+}
@@ -27,6 +27,7 @@ the clock manager are:
 @item @code{@value{DIRPREFIX}clock_get_uptime_nanoseconds} - Get nanoseconds since boot
 @item @code{@value{DIRPREFIX}clock_set_nanoseconds_extension} - Install the nanoseconds since last tick handler
 @item @code{@value{DIRPREFIX}clock_tick} - Announce a clock tick
+@item @code{@value{DIRPREFIX}clock_tick_processor} - Announce a clock tick to the executing processor
 @end itemize
 
 @section Background
@@ -859,3 +860,53 @@ The @code{microseconds_per_tick} and @code{ticks_per_timeslice}
 parameters in the Configuration Table contain the number of
 microseconds per tick and number of ticks per timeslice,
 respectively.
+
+@c
+@c
+@c
+@page
+@subsection CLOCK_TICK_PROCESSOR - Announce a clock tick to the executing processor
+
+@cindex clock tick processor
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_clock_tick_processor
+@example
+rtems_status_code rtems_clock_tick_processor( void );
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Clock_Tick_Processor (
+   Result :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - clock tick processed successfully
+
+@subheading DESCRIPTION:
+
+This directive announces to RTEMS that a system clock tick has
+occurred on the executing processor.  It processes the expiration of
+the timers, delays and timeouts armed on the executing processor.
+
+On SMP configurations each processor has its own set of ticks based
+timers.  By default the @code{@value{DIRPREFIX}clock_tick} directive
+processes the timers of all processors.  A clock driver with a clock
+interrupt on each processor calls this directive in the clock interrupt
+of each processor other than the one which calls
+@code{@value{DIRPREFIX}clock_tick}.  Once a processor called this
+directive, @code{@value{DIRPREFIX}clock_tick} no longer processes the
+timers of this processor.
+
+@subheading NOTES:
+
+This directive must be called from the clock interrupt of the executing
+processor.
+
+On uni-processor configurations this directive does nothing.
@@ -833,6 +833,46 @@ API Partitions that can be concurrently active.
 @subheading NOTES:
 This object class can be configured in unlimited allocation mode.
 
+@c
+@c === CONFIGURE_PARTITION_CACHE_BUFFERS ===
+@c
+@subsection Specify Partition Per-Processor Cache Size
+
+@findex CONFIGURE_PARTITION_CACHE_BUFFERS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_PARTITION_CACHE_BUFFERS}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+Zero or positive.
+
+@item DEFAULT VALUE:
+The default value is 0, which disables the per-processor partition caches.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter specifies the maximum count of free buffers held
+by the cache of each processor for each Classic API Partition.  The
+@code{rtems_partition_get_buffer()} and @code{rtems_partition_return_buffer()}
+directives use the cache of the executing processor.  An empty cache is
+refilled with a batch of half the maximum count of buffers from the
+partition.  A return to a full cache moves a batch of half the maximum count
+of buffers back to the partition.
+
+@subheading NOTES:
+The caches are allocated from the RTEMS Workspace during system
+initialization for the configured maximum count of partitions.  In unlimited
+allocation mode partitions beyond the initial allocation have no caches.  The
+buffers in the caches appear as used buffers of the partition.  They are
+returned to the partition during @code{rtems_partition_delete()}.  This option
+is intended for SMP configurations, but may be used on uni-processor
+configurations as well.
+
 @c
 @c === CONFIGURE_MAXIMUM_REGIONS ===
 @c
@@ -1790,6 +1830,44 @@ RTEMS "unlimited" objects option.  You will be able to create objects
 until you run out of all available memory rather then just until you
 run out of RTEMS Workspace.
 
+@c
+@c === CONFIGURE_OBJECT_NAME_INDEX ===
+@c
+@subsection Object Name Index
+
+@findex CONFIGURE_OBJECT_NAME_INDEX
+@cindex object name index
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_OBJECT_NAME_INDEX}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the object name to
+identifier translation searches the object tables linearly.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, each object class maintains a hash index of the object
+names.  The ident directives, e.g. @code{rtems_task_ident}, and the
+lookup of POSIX named objects, e.g. in @code{sem_open} or @code{mq_open},
+use this index and need a constant time on average.
+
+@subheading NOTES:
+The name index uses two additional bytes per object for the hash chains
+and up to four bytes per object for the hash buckets in case object
+identifiers with 16-bit indices are used.  The index is maintained when
+objects are created, deleted or renamed.  This is worthwhile for
+applications which create many objects and look them up by name, for
+example during system initialization.
+
 @c
 @c === CONFIGURE_MICROSECONDS_PER_TICK ===
 @c
@@ -2464,6 +2542,86 @@ of routines.
 @subheading NOTES:
 None.
 
+@c
+@c === CONFIGURE_MALLOC_SEGREGATED_FIT ===
+@c
+@subsection Enable Malloc Segregated Fit Allocation
+
+@findex CONFIGURE_MALLOC_SEGREGATED_FIT
+
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_SEGREGATED_FIT}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, and the C Program Heap uses the first fit
+allocation policy.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter is defined when the application wishes the
+C Program Heap to use a two-level segregated fit allocation policy.  The
+free blocks are sorted into size classes and a free block which satisfies an
+allocation request is found in constant time.  This bounds the execution time
+of @code{malloc()} independent of the heap fragmentation.
+
+@subheading NOTES:
+The size class index is allocated from the C Program Heap during system
+initialization.  It needs about 1KiB on 32-bit targets.  Allocation requests
+with an alignment or boundary constraint, e.g. @code{posix_memalign()}, start
+the search at the first suitable size class, but may still visit several
+free blocks.  In case the unified work area is used, then the RTEMS Workspace
+uses this allocation policy as well.
+
+@c
+@c === CONFIGURE_MALLOC_CACHE_BLOCKS ===
+@c
+@subsection Specify Malloc Per-Processor Cache Size
+
+@findex CONFIGURE_MALLOC_CACHE_BLOCKS
+
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_CACHE_BLOCKS}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+Zero or positive.
+
+@item DEFAULT VALUE:
+The default value is 0, which disables the per-processor malloc caches.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter specifies the maximum count of blocks of one
+size class held by the cache of each processor.  Requests of up to 256 bytes
+are served by @code{malloc()} from a cache of the executing processor without
+the allocator lock.  The cache has size classes of 16, 32, 64, 128 and 256
+bytes.  An empty cache is refilled with a batch of half the maximum count of
+blocks from the C Program Heap.  A @code{free()} to a full cache returns a
+batch of half the maximum count of blocks to the C Program Heap.
+
+@subheading NOTES:
+The blocks in the caches appear as used blocks in the C Program Heap.  The
+@code{malloc_cache_flush()} function returns all cached blocks to the C
+Program Heap.  The @code{malloc_get_statistics()} function reports the cache
+hits, refills and flushes and the count of cached blocks.  The
+@code{malloc_walk()} function checks the cache contents.  This option is
+intended for SMP configurations, but may be used on uni-processor
+configurations as well.
+
 @c
 @c === CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS ===
 @c
@@ -2709,6 +2867,79 @@ confused with the @code{CONFIGURE_MAXIMUM_DRIVERS} option.  This parameter only
 impacts the devFS and thus is only used by @code{<rtems/confdefs.h>} when
 @code{CONFIGURE_USE_DEVFS_AS_BASE_FILESYSTEM} is specified.
 
+@c
+@c === CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX ===
+@c
+@subsection Enable IMFS Directory Index
+
+@findex CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter is defined if the application wishes that
+each IMFS directory maintains a red-black tree of its entries ordered by
+name.  The path evaluation uses this tree to find a path component in
+logarithmic time instead of a linear search through all entries of the
+directory.
+
+@subheading NOTES:
+This is useful for directories with a large number of entries, e.g. a
+@code{/dev} directory with thousands of device nodes.  The creation,
+removal and rename of a node are slightly more expensive with the
+directory index.
+
+@c
+@c === CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS ===
+@c
+@subsection Enable IMFS Extent Files
+
+@findex CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter is defined if the application wishes that
+the regular files of the IMFS store their content in extents instead of
+blocks of @code{CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK} bytes.  An extent
+is a contiguous memory area.  Each new extent of a file is at least as
+large as all previous extents together, so a large read or write needs
+only a few @code{memcpy()} operations.
+
+@subheading NOTES:
+The maximum file size of extent files is not limited by the block size.
+Up to one half of the memory used by an extent file may be unused.
+
+The @code{IMFS_make_mapped_file()} function creates an extent file which
+uses a file image already in memory without a copy.  This is independent
+of this configuration parameter.
+
 @c
 @c === CONFIGURE_APPLICATION_DISABLE_FILESYSTEM ===
 @c
@@ -2977,6 +3208,40 @@ A value of 0 disables the read-ahead task (default).  The read-ahead task will
 issue speculative read transfers if a sequential access pattern is detected.
 This can improve the performance on some systems.
 
+@c
+@c === CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS ===
+@c
+@subsection Initial Blocks per Read-Ahead Request
+
+@findex CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+Zero or positive and less than or equal to
+@code{CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS}.
+
+@item DEFAULT VALUE:
+The default value is 0.
+
+@end table
+
+@subheading DESCRIPTION:
+Defines the blocks of the first read-ahead request of a sequential access
+stream.  Each further read-ahead request of the stream doubles the count of
+blocks up to the maximum blocks per read-ahead request.  A read miss outside
+the stream starts a new stream.
+
+@subheading NOTES:
+A value of 0 uses the maximum blocks per read-ahead request for all
+read-ahead requests (default).  The read-ahead hit and miss counters of the
+device statistics show how well the read-ahead serves the reads.
+
 @c
 @c === CONFIGURE_BDBUF_MAX_WRITE_BLOCKS ===
 @c
@@ -3117,6 +3382,106 @@ Defines the swapout worker task priority.
 @subheading NOTES:
 None.
 
+@c
+@c === CONFIGURE_SWAPOUT_WRITE_COALESCING ===
+@c
+@subsection Swapout Write Coalescing
+
+@findex CONFIGURE_SWAPOUT_WRITE_COALESCING
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SWAPOUT_WRITE_COALESCING}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+@code{true} or @code{false}.
+
+@item DEFAULT VALUE:
+The default value is @code{false}.
+
+@end table
+
+@subheading DESCRIPTION:
+If set to @code{true}, then the swapout task writes all modified buffers of a
+device once the hold time of one of them expired or a synchronization of the
+device is requested.  The buffers are written in block order and adjacent
+buffers are merged into one write request up to the maximum blocks per write
+request.
+
+@subheading NOTES:
+This results in fewer and larger write requests for scattered writes at the
+cost of writing buffers before their hold time expired.  The device
+statistics show the average count of blocks per write transfer.
+
+@c
+@c === CONFIGURE_BDBUF_LOOKUP ===
+@c
+@subsection Buffer Descriptor Lookup Method
+
+@findex CONFIGURE_BDBUF_LOOKUP
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_BDBUF_LOOKUP}
+
+@item DATA TYPE:
+Lookup method (@code{rtems_bdbuf_lookup}).
+
+@item RANGE:
+@code{RTEMS_BDBUF_LOOKUP_AVL_TREE} or @code{RTEMS_BDBUF_LOOKUP_HASH}.
+
+@item DEFAULT VALUE:
+The default value is @code{RTEMS_BDBUF_LOOKUP_AVL_TREE}.
+
+@end table
+
+@subheading DESCRIPTION:
+Defines how the block device cache finds the buffer of a block.  The AVL
+tree needs no additional memory and has a logarithmic lookup time.  The
+hash table has a constant average lookup time.
+
+@subheading NOTES:
+The hash table uses two pointers of memory for each minimum size buffer of
+the cache.  It is allocated from the C Program Heap during the block device
+cache initialization.
+
+@c
+@c === CONFIGURE_BDBUF_SHARDS ===
+@c
+@subsection Block Device Cache Shards
+
+@findex CONFIGURE_BDBUF_SHARDS
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_BDBUF_SHARDS}
+
+@item DATA TYPE:
+Unsigned integer (@code{size_t}).
+
+@item RANGE:
+Positive.
+
+@item DEFAULT VALUE:
+The default value is 1.
+
+@end table
+
+@subheading DESCRIPTION:
+Defines the count of block device cache shards.  Each shard has its own lock,
+buffer lists and buffer descriptor lookup structure.  The shards are assigned
+to the disks in a round-robin fashion in the order of their initialization.
+Operations on disks of different shards do not contend for the same lock.
+
+@subheading NOTES:
+The buffer groups of the cache are divided equally between the shards, the
+last shard gets the remaining buffers.  A disk can use only the buffers of its
+shard, so with more than one shard a disk can use only a part of the cache.  Each shard needs five semaphores
+or two POSIX mutexes and three POSIX condition variables.
+
 @c
 @c === BSP Specific Settings ===
 @c
@@ -3769,6 +4134,83 @@ explicitly selected by defining @code{CONFIGURE_SCHEDULER_SIMPLE_SMP}.
 This scheduler is only available when RTEMS is configured with SMP
 support enabled.
 
+@c
+@c === CONFIGURE_SCHEDULER_WORK_STEALING_SMP ===
+@c
+@subsection Use Work Stealing SMP Scheduler
+
+@findex CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SCHEDULER_WORK_STEALING_SMP}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+The Work Stealing SMP Scheduler is a partitioned fixed priority scheduler
+with thread migration.  Each processor has its own priority ordered ready
+queue.  A thread which becomes ready is placed on the processor it executed
+last or on an idle processor of its affinity set.  A processor which runs out
+of work steals the highest priority ready thread from the other processors.
+In addition each processor steals a more important ready thread from the
+other processors at each clock tick.  Thus the global priority order may be
+violated for at most one clock tick.  The thread affinity is honoured.
+
+In a configuration with SMP enabled at configure time, it may be
+explicitly selected by defining @code{CONFIGURE_SCHEDULER_WORK_STEALING_SMP}.
+
+@subheading NOTES:
+This scheduler is only available when RTEMS is configured with SMP
+support enabled.
+
+@c
+@c === CONFIGURE_SCHEDULER_EDF_SMP ===
+@c
+@subsection Use Global EDF SMP Scheduler
+
+@findex CONFIGURE_SCHEDULER_EDF_SMP
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SCHEDULER_EDF_SMP}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+The Global EDF SMP Scheduler is the SMP variant of the Earliest Deadline
+First Scheduler.  The ready threads with the earliest deadlines are scheduled
+on the processors owned by the scheduler instance.  Deadlines are assigned by
+the Rate Monotonic Manager in the same way as for the uni-processor EDF
+Scheduler.  Threads without a deadline are background threads and execute in
+priority order on the processors left over by the deadline driven threads.
+The ready threads are kept in a single red-black tree ordered by deadline.
+
+In a configuration with SMP enabled at configure time, it may be
+explicitly selected by defining @code{CONFIGURE_SCHEDULER_EDF_SMP}.
+
+@subheading NOTES:
+This scheduler is only available when RTEMS is configured with SMP
+support enabled.  The thread affinity is not supported.
+
 @c
 @c === Configuring a Scheduler Name ===
 @c
@@ -3793,9 +4235,11 @@ The default name is
 @item @code{"UEDF"} for the Uni-Processor EDF scheduler,
 @item @code{"UPD "} for the Uni-Processor Deterministic Priority scheduler,
 @item @code{"UPS "} for the Uni-Processor Simple Priority scheduler,
+@item @code{"MEDF"} for the Multi-Processor EDF scheduler,
 @item @code{"MPA "} for the Multi-Processor Priority Affinity scheduler, and
 @item @code{"MPD "} for the Multi-Processor Deterministic Priority scheduler, and
-@item @code{"MPS "} for the Multi-Processor Simple Priority scheduler.
+@item @code{"MPS "} for the Multi-Processor Simple Priority scheduler, and
+@item @code{"MPW "} for the Multi-Processor Work Stealing scheduler.
 @end itemize
 
 @end table
@@ -3887,8 +4331,10 @@ following defines
 
 @itemize @bullet
 @item @code{CONFIGURE_SCHEDULER_PRIORITY_SMP},
-@item @code{CONFIGURE_SCHEDULER_SIMPLE_SMP}, and
-@item @code{CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP}.
+@item @code{CONFIGURE_SCHEDULER_SIMPLE_SMP},
+@item @code{CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP},
+@item @code{CONFIGURE_SCHEDULER_WORK_STEALING_SMP}, and
+@item @code{CONFIGURE_SCHEDULER_EDF_SMP}.
 @end itemize
 
 This is necessary to calculate the per-thread overhead introduced by the
@@ -3900,8 +4346,10 @@ macros to create scheduler contexts
 
 @itemize @bullet
 @item @code{RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(name, prio_count)},
-@item @code{RTEMS_SCHEDULER_CONTEXT_SIMPLE_SMP(name)}, and
-@item @code{RTEMS_SCHEDULER_CONTEXT_PRIORITY_AFFINITY_SMP(name, prio_count)}.
+@item @code{RTEMS_SCHEDULER_CONTEXT_SIMPLE_SMP(name)},
+@item @code{RTEMS_SCHEDULER_CONTEXT_PRIORITY_AFFINITY_SMP(name, prio_count)},
+@item @code{RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP(name, cpu_count)}, and
+@item @code{RTEMS_SCHEDULER_CONTEXT_EDF_SMP(name)}.
 @end itemize
 
 The @code{name} parameter is used as part of a designator for a global
@@ -3913,8 +4361,10 @@ control initializers
 
 @itemize @bullet
 @item @code{RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(name, obj_name)},
-@item @code{RTEMS_SCHEDULER_CONTROL_SIMPLE_SMP(name, obj_name)}, and
-@item @code{RTEMS_SCHEDULER_CONTROL_PRIORITY_AFFINITY_SMP(name, obj_name)}.
+@item @code{RTEMS_SCHEDULER_CONTROL_SIMPLE_SMP(name, obj_name)},
+@item @code{RTEMS_SCHEDULER_CONTROL_PRIORITY_AFFINITY_SMP(name, obj_name)},
+@item @code{RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(name, obj_name)}, and
+@item @code{RTEMS_SCHEDULER_CONTROL_EDF_SMP(name, obj_name)}.
 @end itemize
 
 The @code{name} parameter must correspond to the parameter defining the
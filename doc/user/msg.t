@@ -24,6 +24,12 @@ directives provided by the message manager are:
 @item @code{@value{DIRPREFIX}message_queue_receive} - Receive message from a queue
 @item @code{@value{DIRPREFIX}message_queue_get_number_pending} - Get number of messages pending on a queue
 @item @code{@value{DIRPREFIX}message_queue_flush} - Flush all messages on a queue
+@item @code{@value{DIRPREFIX}message_queue_obtain_buffer} - Obtain a message buffer on loan
+@item @code{@value{DIRPREFIX}message_queue_send_buffer} - Send a message buffer on loan
+@item @code{@value{DIRPREFIX}message_queue_receive_buffer} - Receive a message buffer on loan
+@item @code{@value{DIRPREFIX}message_queue_release_buffer} - Release a message buffer on loan
+@item @code{@value{DIRPREFIX}message_queue_send_many} - Send a batch of messages
+@item @code{@value{DIRPREFIX}message_queue_receive_many} - Receive a batch of messages
 @end itemize
 
 @section Background
@@ -65,6 +71,8 @@ queue attributes is provided in the following table:
 @item @code{@value{RPREFIX}PRIORITY} - tasks wait by priority
 @item @code{@value{RPREFIX}LOCAL} - local message queue (default)
 @item @code{@value{RPREFIX}GLOBAL} - global message queue
+@item @code{@value{RPREFIX}MULTIPLE_PRODUCER_MULTIPLE_CONSUMER} - any number of senders and receivers (default)
+@item @code{@value{RPREFIX}SINGLE_PRODUCER_SINGLE_CONSUMER} - one sender and one receiver, lock-free ring buffer
 @end itemize
 
 
@@ -185,6 +193,64 @@ message queue.  Neither directive can successfully send a
 message to a message queue which has a full queue of pending
 messages.
 
+@subsection Single Producer Single Consumer Message Queues
+
+A message queue created with the
+@code{@value{RPREFIX}SINGLE_PRODUCER_SINGLE_CONSUMER} attribute is
+used by exactly one sender, which may be an interrupt service routine,
+and exactly one receiving task.  Its messages are passed through a
+lock-free ring buffer.  As long as the receiver is not blocked, neither
+the send nor the receive operation disables thread dispatching or uses
+the task wait queue and each message is copied only once into and once
+out of the ring buffer.  In case the queue is empty the receiver blocks
+as usual and the sender unblocks it with the next message.
+
+It is the responsibility of the application to ensure that at most one
+context sends to and at most one task receives from such a message
+queue at a time.  The flush operation counts as a receive operation.
+The @code{@value{DIRPREFIX}message_queue_urgent} and
+@code{@value{DIRPREFIX}message_queue_broadcast} directives are not
+supported for these message queues.  The
+@code{@value{DIRPREFIX}message_queue_delete} directive waits for the
+end of send and receive operations in progress on such a message queue.
+
+@subsection Message Buffers on Loan
+
+The send and receive directives copy the message into and out of a
+message buffer of the queue.  For large messages these copy operations
+may dominate the cost of message passing.  To avoid them, a task may
+borrow message buffers of the message queue.  The
+@code{@value{DIRPREFIX}message_queue_obtain_buffer} directive lends an
+inactive message buffer to the caller.  The message is built in place
+and sent with the @code{@value{DIRPREFIX}message_queue_send_buffer}
+directive.  A task waiting for a message receives a copy of the message
+as usual, or the buffer itself in case it uses the
+@code{@value{DIRPREFIX}message_queue_receive_buffer} directive.  This
+directive lends the message buffer of the next pending message to the
+caller.  It must be returned with the
+@code{@value{DIRPREFIX}message_queue_release_buffer} directive once the
+message has been processed.
+
+The message buffers on loan reduce the count of messages which may be
+pending on the message queue.  While at least one message buffer is on
+loan, a task may not wait to send to a full message queue.  Tasks
+waiting to send in this case are unblocked and returned the
+@code{@value{RPREFIX}TOO_MANY} status code.  Message buffers on loan
+are not available for single producer single consumer message queues
+and remote message queues.
+
+@subsection Sending and Receiving Batches of Messages
+
+The @code{@value{DIRPREFIX}message_queue_send_many} and
+@code{@value{DIRPREFIX}message_queue_receive_many} directives move a
+batch of messages with one directive call.  The message queue is looked
+up once, thread dispatching is disabled once and the message buffers
+are taken from and returned to the message queue in one critical
+section for the whole batch.  This reduces the overhead per message for
+tasks which produce or consume streams of small messages.  The messages
+of a batch are laid out in one contiguous area.  The message with index
+i starts at i times the maximum message size of the message queue.
+
 @subsection Broadcasting a Message
 
 The @code{@value{DIRPREFIX}message_queue_broadcast} directive sends the same
@@ -258,7 +324,8 @@ procedure Message_Queue_Create (
 @code{@value{RPREFIX}TOO_MANY} - too many queues created@*
 @code{@value{RPREFIX}UNSATISFIED} - unable to allocate message buffers@*
 @code{@value{RPREFIX}MP_NOT_CONFIGURED} - multiprocessing not configured@*
-@code{@value{RPREFIX}TOO_MANY} - too many global objects
+@code{@value{RPREFIX}TOO_MANY} - too many global objects@*
+@code{@value{RPREFIX}NOT_DEFINED} - global single producer single consumer queue
 
 @subheading DESCRIPTION:
 
@@ -275,6 +342,10 @@ waiting for a message to be serviced according to task priority.
 When @code{@value{RPREFIX}FIFO} is specified, waiting tasks are serviced
 in First In-First Out order.
 
+Specifying @code{@value{RPREFIX}SINGLE_PRODUCER_SINGLE_CONSUMER} in
+attribute_set creates a message queue for exactly one sender and one
+receiver which uses a lock-free ring buffer.
+
 @subheading NOTES:
 
 This directive will not cause the calling task to be
@@ -288,6 +359,8 @@ defined by RTEMS:
 @item @code{@value{RPREFIX}PRIORITY} - tasks wait by priority
 @item @code{@value{RPREFIX}LOCAL} - local message queue (default)
 @item @code{@value{RPREFIX}GLOBAL} - global message queue
+@item @code{@value{RPREFIX}MULTIPLE_PRODUCER_MULTIPLE_CONSUMER} - any number of senders and receivers (default)
+@item @code{@value{RPREFIX}SINGLE_PRODUCER_SINGLE_CONSUMER} - one sender and one receiver, lock-free ring buffer
 @end itemize
 
 Message queues should not be made global unless
@@ -540,7 +613,8 @@ procedure Message_Queue_Urgent (
 @code{@value{RPREFIX}INVALID_SIZE} - invalid message size@*
 @code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
 @code{@value{RPREFIX}UNSATISFIED} - out of message buffers@*
-@code{@value{RPREFIX}TOO_MANY} - queue's limit has been reached
+@code{@value{RPREFIX}TOO_MANY} - queue's limit has been reached@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue
 
 @subheading DESCRIPTION:
 
@@ -607,7 +681,8 @@ procedure Message_Queue_Broadcast (
 @code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
 @code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
 @code{@value{RPREFIX}INVALID_ADDRESS} - @code{count} is NULL@*
-@code{@value{RPREFIX}INVALID_SIZE} - invalid message size
+@code{@value{RPREFIX}INVALID_SIZE} - invalid message size@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue
 
 @subheading DESCRIPTION:
 
@@ -831,3 +906,353 @@ Flushing all messages on a global message queue which
 does not reside on the local node will generate a request to the
 remote node to actually flush the specified message queue.
 
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_OBTAIN_BUFFER - Obtain a message buffer on loan
+
+@cindex obtain message buffer
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_obtain_buffer
+@example
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Obtain_Buffer (
+   ID     : in     RTEMS.ID;
+   Buffer :    out RTEMS.Address;
+   Result :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer obtained successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
+@code{@value{RPREFIX}TOO_MANY} - no inactive message buffer available@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive lends an inactive message buffer of the message queue
+specified by id to the caller.  The start address of the message area is
+returned in buffer.  The message area has the maximum message size of
+the message queue.
+
+@subheading NOTES:
+
+The message buffer must be either sent with
+@code{@value{DIRPREFIX}message_queue_send_buffer} or returned with
+@code{@value{DIRPREFIX}message_queue_release_buffer}.
+
+This directive will not cause the calling task to be preempted.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_SEND_BUFFER - Send a message buffer on loan
+
+@cindex send message buffer
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_send_buffer
+@example
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Send_Buffer (
+   ID     : in     RTEMS.ID;
+   Buffer : in     RTEMS.Address;
+   Size   : in     RTEMS.Unsigned32;
+   Result :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message sent successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a message buffer on loan@*
+@code{@value{RPREFIX}INVALID_SIZE} - invalid message size@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive sends the message contained in the message buffer on
+loan to the message queue specified by id.  If a task is waiting at the
+queue, then the message is given to this task and the task is unblocked.
+A task waiting in @code{@value{DIRPREFIX}message_queue_receive_buffer}
+receives the message buffer itself, otherwise the message is copied and
+the message buffer is returned to the message queue.  If no task is
+waiting, then the message buffer is placed at the rear of the message
+queue.
+
+@subheading NOTES:
+
+On success the message buffer is no longer on loan to the caller.  In
+case of an error the message buffer remains on loan.
+
+The calling task will be preempted if it has preemption enabled and a
+higher priority task is unblocked as the result of this directive.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RECEIVE_BUFFER - Receive a message buffer on loan
+
+@cindex receive message buffer
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_receive_buffer
+@example
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id        id,
+  void          **buffer,
+  size_t         *size,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Receive_Buffer (
+   ID         : in     RTEMS.ID;
+   Buffer     :    out RTEMS.Address;
+   Size       :    out RTEMS.Unsigned32;
+   Option_Set : in     RTEMS.Option;
+   Timeout    : in     RTEMS.Interval;
+   Result     :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message received successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} or @code{size} is NULL@*
+@code{@value{RPREFIX}UNSATISFIED} - queue is empty@*
+@code{@value{RPREFIX}TIMEOUT} - timed out waiting for message@*
+@code{@value{RPREFIX}OBJECT_WAS_DELETED} - queue deleted while waiting@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive works like @code{@value{DIRPREFIX}message_queue_receive},
+however, the message is not copied.  Instead, the message buffer of the
+received message is lent to the caller.  The start address of the
+message is returned in buffer and its size in size.
+
+@subheading NOTES:
+
+The message buffer must be returned with
+@code{@value{DIRPREFIX}message_queue_release_buffer} after use.  It may
+also be sent again with @code{@value{DIRPREFIX}message_queue_send_buffer}.
+
+Tasks waiting to send to the full message queue are unblocked and
+returned the @code{@value{RPREFIX}TOO_MANY} status code.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RELEASE_BUFFER - Release a message buffer on loan
+
+@cindex release message buffer
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_release_buffer
+@example
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Release_Buffer (
+   ID     : in     RTEMS.ID;
+   Buffer : in     RTEMS.Address;
+   Result :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer released successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a message buffer on loan@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive returns the message buffer on loan to the inactive
+message buffers of the message queue specified by id.
+
+@subheading NOTES:
+
+This directive will not cause the calling task to be preempted.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_SEND_MANY - Send a batch of messages
+
+@cindex send batch of messages
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_send_many
+@example
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Send_Many (
+   ID     : in     RTEMS.ID;
+   Buffer : in     RTEMS.Address;
+   Sizes  : in     RTEMS.Address;
+   Count  : in     RTEMS.Unsigned32;
+   Sent   :    out RTEMS.Unsigned32;
+   Result :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - all messages sent successfully@*
+@code{@value{RPREFIX}TOO_MANY} - queue full, only some messages sent@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer}, @code{sizes} or @code{sent} is NULL@*
+@code{@value{RPREFIX}INVALID_NUMBER} - @code{count} is zero@*
+@code{@value{RPREFIX}INVALID_SIZE} - invalid message size@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive sends count messages to the rear of the message queue
+specified by id.  The message with index i starts at buffer plus i times
+the maximum message size of the message queue and its size is
+@code{sizes[i]}.  Waiting tasks receive the first messages of the batch
+and are unblocked.  The remaining messages are placed on the message
+queue.  The count of messages actually sent is returned in sent.
+
+@subheading NOTES:
+
+In case one message size is invalid, no message is sent.  If the message
+queue becomes full, the remaining messages are not sent.
+
+The calling task will be preempted if it has preemption enabled and a
+higher priority task is unblocked as the result of this directive.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RECEIVE_MANY - Receive a batch of messages
+
+@cindex receive batch of messages
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_receive_many
+@example
+rtems_status_code rtems_message_queue_receive_many(
+  rtems_id        id,
+  void           *buffer,
+  size_t         *sizes,
+  uint32_t        max_count,
+  uint32_t       *count,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+procedure Message_Queue_Receive_Many (
+   ID         : in     RTEMS.ID;
+   Buffer     : in     RTEMS.Address;
+   Sizes      : in     RTEMS.Address;
+   Max_Count  : in     RTEMS.Unsigned32;
+   Count      :    out RTEMS.Unsigned32;
+   Option_Set : in     RTEMS.Option;
+   Timeout    : in     RTEMS.Interval;
+   Result     :    out RTEMS.Status_Codes
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - messages received successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer}, @code{sizes} or @code{count} is NULL@*
+@code{@value{RPREFIX}INVALID_NUMBER} - @code{max_count} is zero@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}UNSATISFIED} - queue is empty@*
+@code{@value{RPREFIX}TIMEOUT} - timed out waiting for message@*
+@code{@value{RPREFIX}OBJECT_WAS_DELETED} - queue deleted while waiting@*
+@code{@value{RPREFIX}NOT_DEFINED} - single producer single consumer queue@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported on remote queues
+
+@subheading DESCRIPTION:
+
+This directive receives up to max_count pending messages from the
+message queue specified by id.  The message with index i is stored at
+buffer plus i times the maximum message size of the message queue and
+its size is returned in @code{sizes[i]}.  The count of received messages
+is returned in count.  In case the message queue is empty, the calling
+task waits for one message according to the option set and timeout like
+in @code{@value{DIRPREFIX}message_queue_receive}.
+
+@subheading NOTES:
+
+The buffer must provide room for max_count messages of the maximum
+message size of the message queue.
+
+A task can not wait for more than one message with this directive.
@@ -112,6 +112,19 @@ chain with the @code{@value{DIRPREFIX}partition_return_buffer} directive.  This
 directive returns an error status code if the returned buffer
 was not previously allocated from this partition.
 
+@subsection Per-Processor Buffer Caches
+
+In case the application configuration option
+@code{CONFIGURE_PARTITION_CACHE_BUFFERS} is positive, then each partition has
+a cache of free buffers for each processor.  The
+@code{@value{DIRPREFIX}partition_get_buffer} and
+@code{@value{DIRPREFIX}partition_return_buffer} directives use the cache of
+the executing processor, so that on SMP configurations processors do not
+contend for the partition's free buffer chain in most cases.  Buffers move in
+batches between the caches and the free buffer chain.  A buffer in the cache
+of one processor is not available to the other processors, so a partition may
+report no available buffer even if some buffers are free.
+
 @subsection Deleting a Partition
 
 The @code{@value{DIRPREFIX}partition_delete} directive allows a partition to
@@ -16,6 +16,7 @@ The application level services currently provided are:
 @itemize @bullet
 @item @code{rtems_get_processor_count} - Get processor count
 @item @code{rtems_get_current_processor} - Get current processor index
+@item @code{rtems_get_processor_ipi_statistics} - Get inter-processor interrupt statistics
 @item @code{rtems_scheduler_ident} - Get ID of a scheduler
 @item @code{rtems_scheduler_get_processor_set} - Get processor set of a scheduler
 @item @code{rtems_task_get_scheduler} - Get scheduler of a task
@@ -358,6 +359,52 @@ thread dispatching disabled.
 
 None.
 
+@c
+@c rtems_get_processor_ipi_statistics
+@c
+@page
+@subsection GET_PROCESSOR_IPI_STATISTICS - Get inter-processor interrupt statistics
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@example
+rtems_status_code rtems_get_processor_ipi_statistics(
+  uint32_t                        cpu_index,
+  rtems_processor_ipi_statistics *statistics
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+
+@code{@value{RPREFIX}SUCCESSFUL} - successful operation@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{statistics} is NULL@*
+@code{@value{RPREFIX}INVALID_NUMBER} - invalid processor index
+
+@subheading DESCRIPTION:
+
+Returns the inter-processor interrupt statistics of the processor specified by
+@code{cpu_index} in @code{statistics}.  The request count is the count of
+thread dispatch requests and SMP messages posted by this processor to other
+processors.  The send count is the count of inter-processor interrupts
+actually sent by this processor.  The receive count is the count of
+inter-processor interrupts received by this processor.
+
+A processor acknowledges an inter-processor interrupt at the beginning of its
+interrupt handler.  Requests posted to a processor which has not yet
+acknowledged the previous interrupt are served by this interrupt, so no
+further interrupt is sent.  The ratio of the send count to the request count
+shows how effective this batching is.
+
+@subheading NOTES:
+
+On uni-processor configurations all counters are zero.  The counters may
+overflow.
+
 @c
 @c rtems_scheduler_ident
 @c
@@ -133,7 +133,9 @@ static void test_normal_file_write(
     .read_errors          = 0,
     .write_transfers      = 1,
     .write_blocks         = 1,
-    .write_errors         = 0
+    .write_errors         = 0,
+    .read_ahead_hits      = 0,
+    .read_ahead_misses    = 0
   };
   static const rtems_blkdev_stats new_block_stats = {
     .read_hits            = 8,
@@ -143,7 +145,9 @@ static void test_normal_file_write(
     .read_errors          = 0,
     .write_transfers      = 1,
     .write_blocks         = 4,
-    .write_errors         = 0
+    .write_errors         = 0,
+    .read_ahead_hits      = 0,
+    .read_ahead_misses    = 0
   };
 
   int                             rv;
@@ -205,7 +209,9 @@ static void test_fat12_root_directory_write( const char *dev_name,
     .read_errors          = 0,
     .write_transfers      = 1,
     .write_blocks         = 1,
-    .write_errors         = 0
+    .write_errors         = 0,
+    .read_ahead_hits      = 0,
+    .read_ahead_misses    = 0
   };
 
   int                             fd;
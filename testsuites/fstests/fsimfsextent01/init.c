@@ -0,0 +1,248 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libcsupport.h>
+
+const char rtems_test_name[] = "FSIMFSEXTENT 1";
+
+#define FILE_SIZE (64 * 1024 + 17)
+
+static const char image[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static unsigned char buffer[FILE_SIZE];
+
+static unsigned char pattern(size_t i)
+{
+  return (unsigned char) ((i * 7) % 251);
+}
+
+static void read_and_check(int fd, off_t offset, const void *data, size_t n)
+{
+  unsigned char in[64];
+  ssize_t s;
+  off_t o;
+
+  rtems_test_assert(n <= sizeof(in));
+
+  o = lseek(fd, offset, SEEK_SET);
+  rtems_test_assert(o == offset);
+
+  s = read(fd, in, n);
+  rtems_test_assert(s == (ssize_t) n);
+  rtems_test_assert(memcmp(in, data, n) == 0);
+}
+
+static void test_mapped_file(void)
+{
+  static const char zeros[8];
+  rtems_resource_snapshot before;
+  struct stat st;
+  ssize_t s;
+  off_t o;
+  int rv;
+  int fd;
+
+  rtems_resource_snapshot_take(&before);
+
+  rv = IMFS_make_mapped_file("/mapped", S_IRWXU, image, sizeof(image) - 1);
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = IMFS_make_mapped_file("/mapped", S_IRWXU, image, sizeof(image) - 1);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EEXIST);
+
+  rv = stat("/mapped", &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(S_ISREG(st.st_mode));
+  rtems_test_assert(st.st_size == (off_t) (sizeof(image) - 1));
+
+  fd = open("/mapped", O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  read_and_check(fd, 0, image, sizeof(image) - 1);
+  read_and_check(fd, 10, &image[10], sizeof(image) - 11);
+
+  /* The write copies the image, it must not modify the image */
+  o = lseek(fd, 5, SEEK_SET);
+  rtems_test_assert(o == 5);
+
+  s = write(fd, "XY", 2);
+  rtems_test_assert(s == 2);
+
+  read_and_check(fd, 0, "01234XY789", 10);
+  rtems_test_assert(image[5] == '5');
+
+  /* An extend after a truncate must fill the gap with zeros */
+  rv = ftruncate(fd, 3);
+  rtems_test_assert(rv == 0);
+
+  rv = ftruncate(fd, 3 + sizeof(zeros));
+  rtems_test_assert(rv == 0);
+
+  read_and_check(fd, 0, "012", 3);
+  read_and_check(fd, 3, zeros, sizeof(zeros));
+
+  /* A write beyond the end of file must fill the gap with zeros */
+  o = lseek(fd, 40, SEEK_SET);
+  rtems_test_assert(o == 40);
+
+  s = write(fd, "Z", 1);
+  rtems_test_assert(s == 1);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == 41);
+
+  read_and_check(fd, 3, zeros, sizeof(zeros));
+  read_and_check(fd, 33, zeros, 7);
+  read_and_check(fd, 40, "Z", 1);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/mapped");
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(rtems_resource_snapshot_check(&before));
+}
+
+static void test_extent_file(void)
+{
+  rtems_resource_snapshot before;
+  struct stat st;
+  size_t chunk;
+  size_t i;
+  ssize_t s;
+  off_t o;
+  int rv;
+  int fd;
+
+  rtems_resource_snapshot_take(&before);
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    buffer[i] = pattern(i);
+  }
+
+  fd = open("/file", O_RDWR | O_CREAT | O_EXCL, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  /* Write the file in chunks of increasing size */
+  i = 0;
+  chunk = 1;
+  while (i < FILE_SIZE) {
+    size_t n = FILE_SIZE - i < chunk ? FILE_SIZE - i : chunk;
+
+    s = write(fd, &buffer[i], n);
+    rtems_test_assert(s == (ssize_t) n);
+
+    i += n;
+    chunk = 2 * chunk + 1;
+  }
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == FILE_SIZE);
+
+  /* Read the file in one piece */
+  memset(buffer, 0, sizeof(buffer));
+
+  o = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(o == 0);
+
+  s = read(fd, buffer, sizeof(buffer));
+  rtems_test_assert(s == FILE_SIZE);
+
+  for (i = 0; i < FILE_SIZE; ++i) {
+    rtems_test_assert(buffer[i] == pattern(i));
+  }
+
+  s = read(fd, buffer, sizeof(buffer));
+  rtems_test_assert(s == 0);
+
+  /* Shrink the file and overwrite an area which crosses extent boundaries */
+  rv = ftruncate(fd, FILE_SIZE / 2);
+  rtems_test_assert(rv == 0);
+
+  o = lseek(fd, 100, SEEK_SET);
+  rtems_test_assert(o == 100);
+
+  memset(buffer, 0xff, FILE_SIZE / 2);
+  s = write(fd, buffer, FILE_SIZE / 2);
+  rtems_test_assert(s == FILE_SIZE / 2);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == 100 + FILE_SIZE / 2);
+
+  o = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(o == 0);
+
+  s = read(fd, buffer, sizeof(buffer));
+  rtems_test_assert(s == 100 + FILE_SIZE / 2);
+
+  for (i = 0; i < 100; ++i) {
+    rtems_test_assert(buffer[i] == pattern(i));
+  }
+
+  for (i = 100; i < (size_t) s; ++i) {
+    rtems_test_assert(buffer[i] == 0xff);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink("/file");
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(rtems_resource_snapshot_check(&before));
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_mapped_file();
+  test_extent_file();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_IMFS_ENABLE_MEMFILE_EXTENTS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,286 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/counter.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSDIRINDEX 1";
+
+#define DEVICE "/dev/rda"
+
+#define MOUNT_POINT "/mnt"
+
+#define DIRECTORY MOUNT_POINT "/dir"
+
+#define MEDIA_BLOCK_SIZE 512
+
+#define MEDIA_BLOCK_COUNT 8192
+
+/*
+ * With 512 byte blocks this count of files needs a two level index.
+ */
+#define FILE_COUNT 4096
+
+#define LOOKUP_ROUNDS 4
+
+static void make_path(char *path, size_t size, const char *prefix, int i)
+{
+  int n = snprintf(path, size, "%s/%s-%05i", DIRECTORY, prefix, i);
+
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_files(void)
+{
+  char path[64];
+  int rv;
+  int fd;
+  int i;
+
+  rv = mkdir(DIRECTORY, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), "file", i);
+
+    fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_directory(int expected_count)
+{
+  struct dirent *entry;
+  DIR *dir;
+  int count = 0;
+  int rv;
+
+  dir = opendir(DIRECTORY);
+  rtems_test_assert(dir != NULL);
+
+  while ((entry = readdir(dir)) != NULL) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      ++count;
+    }
+  }
+
+  rv = closedir(dir);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(count == expected_count);
+}
+
+static void lookup_files(const char *name)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  uint64_t ns;
+  char path[64];
+  struct stat st;
+  int rv;
+  int r;
+  int i;
+
+  a = rtems_counter_read();
+
+  for (r = 0; r < LOOKUP_ROUNDS; ++r) {
+    for (i = 0; i < FILE_COUNT; ++i) {
+      /* Do not look up the files in the order of creation */
+      int j = (int) (((unsigned) i * 2503U) % FILE_COUNT);
+
+      make_path(path, sizeof(path), "file", j);
+
+      rv = stat(path, &st);
+      rtems_test_assert(rv == 0);
+      rtems_test_assert(S_ISREG(st.st_mode));
+    }
+  }
+
+  b = rtems_counter_read();
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a));
+
+  printf(
+    "%s: %i lookups: %" PRIu64 "ns per lookup\n",
+    name,
+    LOOKUP_ROUNDS * FILE_COUNT,
+    ns / (LOOKUP_ROUNDS * FILE_COUNT)
+  );
+
+  make_path(path, sizeof(path), "file", FILE_COUNT);
+  errno = 0;
+  rv = stat(path, &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+}
+
+static void rename_and_remove_files(void)
+{
+  char old_path[64];
+  char new_path[64];
+  struct stat st;
+  int rv;
+  int i;
+
+  /* The renames add entries and split leaves of the index */
+  for (i = 0; i < FILE_COUNT; i += 2) {
+    make_path(old_path, sizeof(old_path), "file", i);
+    make_path(new_path, sizeof(new_path), "renamed-file", i);
+
+    rv = rename(old_path, new_path);
+    rtems_test_assert(rv == 0);
+  }
+
+  check_directory(FILE_COUNT);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(old_path, sizeof(old_path), "file", i);
+    make_path(new_path, sizeof(new_path), "renamed-file", i);
+
+    errno = 0;
+    rv = stat((i % 2) == 0 ? old_path : new_path, &st);
+    rtems_test_assert(rv == -1);
+    rtems_test_assert(errno == ENOENT);
+
+    rv = unlink((i % 2) == 0 ? new_path : old_path);
+    rtems_test_assert(rv == 0);
+  }
+
+  check_directory(0);
+
+  rv = rmdir(DIRECTORY);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_format(const char *name, bool dir_index)
+{
+  rtems_rfs_format_config config;
+  int rv;
+
+  memset(&config, 0, sizeof(config));
+  config.block_size = MEDIA_BLOCK_SIZE;
+  config.group_inodes = FILE_COUNT;
+  config.dir_index = dir_index;
+
+  rv = rtems_rfs_format(DEVICE, &config);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEVICE,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  create_files();
+  check_directory(FILE_COUNT);
+  lookup_files(name);
+
+  /* The index must survive a remount */
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEVICE,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  lookup_files(name);
+  rename_and_remove_files();
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  ramdisk *rd;
+  int rv;
+
+  rd = ramdisk_allocate(NULL, MEDIA_BLOCK_SIZE, MEDIA_BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(
+    DEVICE,
+    MEDIA_BLOCK_SIZE,
+    MEDIA_BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  test_format("linear", false);
+  test_format("index", true);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE MEDIA_BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (64 * MEDIA_BLOCK_SIZE)
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,191 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <inttypes.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+#include <rtems/counter.h>
+
+/*
+ * This test is built twice.  The BLOCK 18 test uses the AVL tree and the
+ * BLOCK 19 test uses the hash table to look up the buffers.  The output of
+ * both tests may be compared to see the lookup cost of each method.
+ */
+#if defined(TEST_BDBUF_LOOKUP_HASH)
+const char rtems_test_name[] = "BLOCK 19";
+#define TEST_BDBUF_LOOKUP RTEMS_BDBUF_LOOKUP_HASH
+#else
+const char rtems_test_name[] = "BLOCK 18";
+#define TEST_BDBUF_LOOKUP RTEMS_BDBUF_LOOKUP_AVL_TREE
+#endif
+
+#define BUFFER_COUNT_MAX (128 * 1024)
+
+/*
+ * A prime stride is used to access the blocks, so that consecutive lookups
+ * hit different parts of the lookup structure.
+ */
+#define BLOCK_STRIDE 7919
+
+static const uint32_t buffer_counts[] = {
+  1024,
+  16 * 1024,
+  BUFFER_COUNT_MAX
+};
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void read_and_release(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_lookup(rtems_disk_device *dd, uint32_t buffer_count)
+{
+  rtems_blkdev_stats stats;
+  uint32_t read_hits;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t ns;
+  uint32_t i;
+
+  rtems_bdbuf_purge_dev(dd);
+
+  for (i = 0; i < buffer_count; ++i) {
+    read_and_release(dd, i);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  read_hits = stats.read_hits;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < buffer_count; ++i) {
+    read_and_release(dd, (i * BLOCK_STRIDE) % buffer_count);
+  }
+
+  t1 = rtems_counter_read();
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits - read_hits == buffer_count);
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0));
+
+  printf(
+    "buffers %6" PRIu32 ": cache hit read and release %" PRIu64 "ns\n",
+    buffer_count,
+    ns / buffer_count
+  );
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+  size_t i;
+
+  /*
+   * The buffer cache needs one buffer descriptor for each of the
+   * BUFFER_COUNT_MAX buffers.  This may exceed the memory of small targets.
+   */
+  sc = rtems_disk_io_initialize();
+  if (sc == RTEMS_UNSATISFIED) {
+    puts("not enough memory for the buffer cache, test skipped");
+    return;
+  }
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BUFFER_COUNT_MAX,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(buffer_counts); ++i) {
+    test_lookup(dd, buffer_counts[i]);
+  }
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 8
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BUFFER_COUNT_MAX
+#define CONFIGURE_BDBUF_LOOKUP TEST_BDBUF_LOOKUP
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,241 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define SHARD_COUNT 4
+
+#define DISK_COUNT 6
+
+#define BLOCK_SIZE 4
+
+#define BLOCK_COUNT 32
+
+#define WORKER_DONE_EVENT RTEMS_EVENT_0
+
+static uint8_t disk_data[DISK_COUNT][BLOCK_COUNT][BLOCK_SIZE];
+
+static rtems_id init_task;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    uint8_t (*data)[BLOCK_SIZE] = rtems_disk_get_driver_data(dd);
+    uint32_t i;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &breq->bufs[i];
+
+      rtems_test_assert(sg->block < BLOCK_COUNT);
+      rtems_test_assert(sg->length == BLOCK_SIZE);
+
+      if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+        memcpy(sg->buffer, data[sg->block], BLOCK_SIZE);
+      } else {
+        rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+        memcpy(data[sg->block], sg->buffer, BLOCK_SIZE);
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static uint8_t pattern(uint32_t disk, rtems_blkdev_bnum block, uint32_t i)
+{
+  return (uint8_t) (disk * 61 + block * 7 + i + 1);
+}
+
+static void write_blocks(rtems_disk_device *dd, uint32_t disk)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+    uint32_t i;
+
+    sc = rtems_bdbuf_get(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      bd->buffer[i] = pattern(disk, block, i);
+    }
+
+    sc = rtems_bdbuf_release_modified(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void check_blocks(rtems_disk_device *dd, uint32_t disk)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+    uint32_t i;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      rtems_test_assert(bd->buffer[i] == pattern(disk, block, i));
+      rtems_test_assert(disk_data[disk][block][i] == pattern(disk, block, i));
+    }
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  uint32_t disk = (uint32_t) arg;
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  rtems_blkdev_stats stats;
+
+  dd = rtems_disk_obtain(rtems_filesystem_make_dev_t(0, disk));
+  rtems_test_assert(dd != NULL);
+
+  write_blocks(dd, disk);
+
+  sc = rtems_bdbuf_syncdev(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_bdbuf_purge_dev(dd);
+  check_blocks(dd, disk);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == BLOCK_COUNT);
+  rtems_test_assert(stats.write_blocks >= BLOCK_COUNT);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_send(init_task, WORKER_DONE_EVENT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  uint32_t disk;
+
+  init_task = rtems_task_self();
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    sc = rtems_disk_create_phys(
+      rtems_filesystem_make_dev_t(0, disk),
+      BLOCK_SIZE,
+      BLOCK_COUNT,
+      test_disk_ioctl,
+      disk_data[disk],
+      NULL
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /*
+   * Each worker uses its own disk.  The disks are distributed to the cache
+   * shards, so some workers share a shard and others do not.  A disk has fewer
+   * buffers available than blocks, so the workers have to recycle modified
+   * buffers of their shard.
+   */
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      1,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(id, worker_task, (rtems_task_argument) disk);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      WORKER_DONE_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (SHARD_COUNT * 16 * BLOCK_SIZE)
+#define CONFIGURE_BDBUF_SHARDS SHARD_COUNT
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + DISK_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
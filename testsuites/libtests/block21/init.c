@@ -0,0 +1,184 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define BLOCK_COUNT 64
+
+#define SEQUENTIAL_READ_COUNT 32
+
+#define RANDOM_BLOCK 50
+
+#define REQUEST_COUNT_MAX 16
+
+static uint32_t request_bufnums [REQUEST_COUNT_MAX];
+
+static size_t request_count;
+
+/*
+ * The read-ahead window starts with one block and doubles with each
+ * read-ahead transfer up to eight blocks.  The random access restarts the
+ * window.
+ */
+static const uint32_t expected_request_bufnums [] = {
+  1, 1, 1, 2, 4, 8, 8, 8, 8,
+  1, 1, 1
+};
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+    rtems_test_assert(request_count < REQUEST_COUNT_MAX);
+
+    request_bufnums [request_count] = breq->bufnum;
+    ++request_count;
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void read_and_release(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_read_ahead(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < SEQUENTIAL_READ_COUNT; ++block) {
+    read_and_release(dd, block);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits == 30);
+  rtems_test_assert(stats.read_misses == 2);
+  rtems_test_assert(stats.read_ahead_transfers == 7);
+  rtems_test_assert(stats.read_ahead_hits == 30);
+  rtems_test_assert(stats.read_ahead_misses == 0);
+  rtems_test_assert(stats.read_blocks == 41);
+
+  read_and_release(dd, RANDOM_BLOCK);
+  read_and_release(dd, RANDOM_BLOCK + 1);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_ahead_transfers == 8);
+  rtems_test_assert(stats.read_ahead_misses == 0);
+  rtems_test_assert(stats.read_blocks == 44);
+
+  rtems_test_assert(request_count == RTEMS_ARRAY_SIZE(expected_request_bufnums));
+  rtems_test_assert(
+    memcmp(
+      request_bufnums,
+      expected_request_bufnums,
+      sizeof(expected_request_bufnums)
+    ) == 0
+  );
+
+  rtems_blkdev_print_stats(&stats, rtems_printf_plugin, NULL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_read_ahead(dd);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 8
+#define CONFIGURE_BDBUF_INITIAL_READ_AHEAD_BLOCKS 1
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
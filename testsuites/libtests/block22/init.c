@@ -0,0 +1,215 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 22";
+
+#define BLOCK_COUNT 16
+
+#define REQUEST_COUNT 2
+
+#define WRITE_COUNT 5
+
+#define MAX_WRITE_BLOCKS 8
+
+#define SWAP_PERIOD_IN_MS 10
+
+#define BLOCK_HOLD_IN_MS 100
+
+#define REQUEST_DONE_EVENT RTEMS_EVENT_0
+
+static rtems_id init_task;
+
+static size_t request_index;
+
+static const uint32_t expected_request_bufnums [REQUEST_COUNT] = {
+  4, 1
+};
+
+static size_t write_index;
+
+static const rtems_blkdev_bnum expected_write_blocks [WRITE_COUNT] = {
+  0, 1, 2, 3, 5
+};
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_status_code sc;
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    printf("REQ %" PRIu32 "\n", breq->bufnum);
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+    rtems_test_assert(request_index < REQUEST_COUNT);
+    rtems_test_assert(breq->bufnum == expected_request_bufnums [request_index]);
+    ++request_index;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &breq->bufs [i];
+
+      printf("W %" PRIu32 "\n", sg->block);
+
+      rtems_test_assert(write_index < WRITE_COUNT);
+      rtems_test_assert(expected_write_blocks [write_index] == sg->block);
+      ++write_index;
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_send(init_task, REQUEST_DONE_EVENT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else if (req == RTEMS_BLKIO_CAPABILITIES) {
+    *(uint32_t *) arg = RTEMS_BLKDEV_CAP_MULTISECTOR_CONT;
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void modify(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_write_coalescing(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_stats stats;
+  size_t i;
+
+  /*
+   * The hold time of block 0 expires first.  The swapout task must write the
+   * other modified blocks of the device together with block 0.  The blocks 0
+   * to 3 are merged into one request.
+   */
+  modify(dd, 0);
+
+  sc = rtems_task_wake_after(
+    RTEMS_MILLISECONDS_TO_TICKS(BLOCK_HOLD_IN_MS / 2)
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  modify(dd, 5);
+  modify(dd, 3);
+  modify(dd, 1);
+  modify(dd, 2);
+
+  for (i = 0; i < REQUEST_COUNT; ++i) {
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      REQUEST_DONE_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(request_index == REQUEST_COUNT);
+  rtems_test_assert(write_index == WRITE_COUNT);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.write_transfers == REQUEST_COUNT);
+  rtems_test_assert(stats.write_blocks == WRITE_COUNT);
+
+  rtems_blkdev_print_stats(&stats, rtems_printf_plugin, NULL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+
+  init_task = rtems_task_self();
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_write_coalescing(dd);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_WRITE_BLOCKS MAX_WRITE_BLOCKS
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAP_PERIOD_IN_MS
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD BLOCK_HOLD_IN_MS
+#define CONFIGURE_SWAPOUT_WRITE_COALESCING true
+
+#define CONFIGURE_MICROSECONDS_PER_TICK (SWAP_PERIOD_IN_MS * 1000)
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
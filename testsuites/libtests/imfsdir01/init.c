@@ -0,0 +1,206 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/counter.h>
+#include <rtems/libio.h>
+
+/*
+ * This test is built twice.  The IMFSDIR 1 test uses the linear search through
+ * the directory entries and the IMFSDIR 2 test uses the directory index to
+ * look up the path components.  The output of both tests may be compared to
+ * see the lookup cost of each method.
+ */
+#if defined(TEST_IMFS_DIRECTORY_INDEX)
+const char rtems_test_name[] = "IMFSDIR 2";
+#define CONFIGURE_IMFS_ENABLE_DIRECTORY_INDEX
+#else
+const char rtems_test_name[] = "IMFSDIR 1";
+#endif
+
+#define ENTRY_COUNT_MAX 2048
+
+/*
+ * A prime stride is used to access the entries, so that consecutive lookups
+ * do not visit the entries in creation order.
+ */
+#define ENTRY_STRIDE 7919
+
+static const uint32_t entry_counts[] = {
+  16,
+  128,
+  512,
+  ENTRY_COUNT_MAX
+};
+
+static void make_path(char *path, size_t size, uint32_t i)
+{
+  int n = snprintf(path, size, "/dir/node-%05" PRIu32, i);
+
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_entries(uint32_t entry_count)
+{
+  uint32_t i;
+
+  for (i = 0; i < entry_count; ++i) {
+    char path[32];
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    rv = mknod(path, S_IFCHR | S_IRWXU, rtems_filesystem_make_dev_t(1, i));
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void remove_entries(uint32_t entry_count)
+{
+  uint32_t i;
+
+  for (i = 0; i < entry_count; ++i) {
+    char path[32];
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    rv = unlink(path);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void test_lookup(uint32_t entry_count)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t ns;
+  uint32_t i;
+
+  create_entries(entry_count);
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < entry_count; ++i) {
+    uint32_t j = (i * ENTRY_STRIDE) % entry_count;
+    char path[32];
+    struct stat st;
+    int rv;
+
+    make_path(path, sizeof(path), j);
+    rv = stat(path, &st);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(st.st_rdev == rtems_filesystem_make_dev_t(1, j));
+  }
+
+  t1 = rtems_counter_read();
+
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0));
+
+  printf(
+    "entries %4" PRIu32 ": stat %" PRIu64 "ns\n",
+    entry_count,
+    ns / entry_count
+  );
+
+  remove_entries(entry_count);
+}
+
+static void test_rename_and_unlink(void)
+{
+  struct stat st;
+  int rv;
+
+  create_entries(3);
+
+  rv = rename("/dir/node-00001", "/dir/a");
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = stat("/dir/node-00001", &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  rv = stat("/dir/a", &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_rdev == rtems_filesystem_make_dev_t(1, 1));
+
+  rv = rename("/dir/a", "/dir/node-00001");
+  rtems_test_assert(rv == 0);
+
+  rv = stat("/dir/node-00001", &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_rdev == rtems_filesystem_make_dev_t(1, 1));
+
+  /* A prefix of an existing name must not match */
+  errno = 0;
+  rv = stat("/dir/node-0000", &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  remove_entries(3);
+
+  errno = 0;
+  rv = stat("/dir/node-00000", &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+}
+
+static void test(void)
+{
+  size_t i;
+  int rv;
+
+  rv = mkdir("/dir", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  test_rename_and_unlink();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(entry_counts); ++i) {
+    test_lookup(entry_counts[i]);
+  }
+
+  rv = rmdir("/dir");
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
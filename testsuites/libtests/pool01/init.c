@@ -0,0 +1,321 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+#include <rtems/pool.h>
+
+#include <stdint.h>
+#include <string.h>
+
+const char rtems_test_name[] = "POOL 1";
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define OBJECT_SIZE 24
+
+#define OBJECT_COUNT 8
+
+#define EXTEND_COUNT 4
+
+#define MAGAZINE_SIZE 4
+
+static char area[OBJECT_COUNT * OBJECT_SIZE + CPU_ALIGNMENT - 1]
+  CPU_STRUCTURE_ALIGNMENT;
+
+static void *objects[4 * OBJECT_COUNT];
+
+static void *volatile interrupt_object;
+
+static volatile bool interrupt_done;
+
+static void test_statistics(
+  rtems_pool_control *pool,
+  uint32_t expected_objects,
+  uint32_t expected_free_objects
+)
+{
+  rtems_pool_statistics stats;
+
+  rtems_pool_get_statistics(pool, &stats);
+  rtems_test_assert(stats.objects == expected_objects);
+  rtems_test_assert(stats.free_objects == expected_free_objects);
+}
+
+static void test_initialize_errors(void)
+{
+  rtems_pool_control pool;
+  rtems_pool_config config;
+  rtems_status_code sc;
+
+  memset(&config, 0, sizeof(config));
+
+  sc = rtems_pool_initialize(NULL, &config);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_pool_initialize(&pool, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  config.object_size = SIZE_MAX / 2;
+  config.extend_count = 2;
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  config.object_size = 1;
+  config.extend_count = 0;
+  config.area_begin = (void *) (UINTPTR_MAX - 15);
+  config.area_size = 32;
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  config.area_begin = NULL;
+  config.area_size = 0;
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_pool_get_object_size(&pool) >= sizeof(void *));
+  rtems_test_assert(rtems_pool_get_object_size(&pool) % CPU_ALIGNMENT == 0);
+  rtems_test_assert(rtems_pool_get(&pool) == NULL);
+
+  sc = rtems_pool_destroy(&pool);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_fixed_area(uint32_t magazine_size)
+{
+  rtems_pool_control pool;
+  rtems_pool_config config;
+  rtems_pool_statistics stats;
+  rtems_status_code sc;
+  uint32_t i;
+  uint32_t j;
+
+  memset(&config, 0, sizeof(config));
+  config.object_size = OBJECT_SIZE;
+  config.area_begin = &area[0];
+  config.area_size = OBJECT_COUNT * OBJECT_SIZE;
+  config.magazine_size = magazine_size;
+
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  test_statistics(&pool, OBJECT_COUNT, OBJECT_COUNT);
+
+  for (i = 0; i < OBJECT_COUNT; ++i) {
+    uintptr_t object;
+
+    objects[i] = rtems_pool_get(&pool);
+    rtems_test_assert(objects[i] != NULL);
+
+    object = (uintptr_t) objects[i];
+    rtems_test_assert(object % CPU_ALIGNMENT == 0);
+    rtems_test_assert(object >= (uintptr_t) &area[0]);
+    rtems_test_assert(object + OBJECT_SIZE <= (uintptr_t) &area[sizeof(area)]);
+
+    for (j = 0; j < i; ++j) {
+      rtems_test_assert(objects[i] != objects[j]);
+    }
+
+    memset(objects[i], 0xff, OBJECT_SIZE);
+  }
+
+  rtems_test_assert(rtems_pool_get(&pool) == NULL);
+  test_statistics(&pool, OBJECT_COUNT, 0);
+
+  sc = rtems_pool_destroy(&pool);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  for (i = 0; i < OBJECT_COUNT; ++i) {
+    rtems_pool_put(&pool, objects[i]);
+  }
+
+  rtems_pool_get_statistics(&pool, &stats);
+  rtems_test_assert(stats.objects == OBJECT_COUNT);
+  rtems_test_assert(stats.free_objects == OBJECT_COUNT);
+  rtems_test_assert(stats.gets == OBJECT_COUNT);
+  rtems_test_assert(stats.puts == OBJECT_COUNT);
+  rtems_test_assert(stats.extends == 0);
+  rtems_test_assert(stats.failed_gets == 1);
+
+  if (magazine_size > 0) {
+    objects[0] = rtems_pool_get(&pool);
+    rtems_test_assert(objects[0] != NULL);
+
+    rtems_pool_get_statistics(&pool, &stats);
+    rtems_test_assert(stats.magazine_hits > 0);
+
+    rtems_pool_put(&pool, objects[0]);
+    rtems_pool_flush(&pool);
+  } else {
+    rtems_test_assert(stats.magazine_hits == 0);
+  }
+
+  sc = rtems_pool_destroy(&pool);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_extend(uint32_t magazine_size)
+{
+  rtems_pool_control pool;
+  rtems_pool_config config;
+  rtems_pool_statistics stats;
+  rtems_status_code sc;
+  uint32_t maximum = 3 * OBJECT_COUNT - 1;
+  uint32_t i;
+
+  memset(&config, 0, sizeof(config));
+  config.object_size = OBJECT_SIZE;
+  config.area_begin = &area[0];
+  config.area_size = OBJECT_COUNT * OBJECT_SIZE;
+  config.extend_count = EXTEND_COUNT;
+  config.maximum_objects = maximum;
+  config.magazine_size = magazine_size;
+
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < maximum; ++i) {
+    objects[i] = rtems_pool_get(&pool);
+    rtems_test_assert(objects[i] != NULL);
+    memset(objects[i], 0xff, OBJECT_SIZE);
+  }
+
+  rtems_test_assert(rtems_pool_get(&pool) == NULL);
+
+  rtems_pool_get_statistics(&pool, &stats);
+  rtems_test_assert(stats.objects == maximum);
+  rtems_test_assert(stats.free_objects == 0);
+  rtems_test_assert(stats.gets == maximum);
+  rtems_test_assert(
+    stats.extends == (maximum - OBJECT_COUNT + EXTEND_COUNT - 1) / EXTEND_COUNT
+  );
+  rtems_test_assert(stats.failed_gets == 1);
+
+  for (i = 0; i < maximum; ++i) {
+    rtems_pool_put(&pool, objects[i]);
+  }
+
+  test_statistics(&pool, maximum, maximum);
+
+  sc = rtems_pool_destroy(&pool);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void get_in_interrupt(rtems_id timer_id, void *arg)
+{
+  rtems_pool_control *pool = arg;
+
+  interrupt_object = rtems_pool_get(pool);
+  interrupt_done = true;
+}
+
+static void test_extend_in_interrupt(void)
+{
+  rtems_pool_control pool;
+  rtems_pool_config config;
+  rtems_status_code sc;
+  rtems_id timer_id;
+  void *object;
+
+  memset(&config, 0, sizeof(config));
+  config.object_size = OBJECT_SIZE;
+  config.extend_count = EXTEND_COUNT;
+
+  sc = rtems_pool_initialize(&pool, &config);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The pool cannot be extended in interrupt context.
+   */
+  interrupt_object = &pool;
+  interrupt_done = false;
+  sc = rtems_timer_fire_after(timer_id, 1, get_in_interrupt, &pool);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (!interrupt_done) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(interrupt_object == NULL);
+  test_statistics(&pool, 0, 0);
+
+  object = rtems_pool_get(&pool);
+  rtems_test_assert(object != NULL);
+  test_statistics(&pool, EXTEND_COUNT, EXTEND_COUNT - 1);
+
+  rtems_pool_put(&pool, object);
+
+  sc = rtems_pool_destroy(&pool);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_delete(timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_workspace_free(void)
+{
+  Heap_Information_block before;
+  Heap_Information_block after;
+  bool ok;
+
+  ok = rtems_workspace_get_information(&before);
+  rtems_test_assert(ok);
+
+  test_extend(MAGAZINE_SIZE);
+
+  ok = rtems_workspace_get_information(&after);
+  rtems_test_assert(ok);
+  rtems_test_assert(before.Free.total == after.Free.total);
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  TEST_BEGIN();
+
+  test_initialize_errors();
+  test_fixed_area(0);
+  test_fixed_area(MAGAZINE_SIZE);
+  test_extend(0);
+  test_extend(1);
+  test_extend(MAGAZINE_SIZE);
+  test_extend_in_interrupt();
+  test_workspace_free();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MEMORY_OVERHEAD 16
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
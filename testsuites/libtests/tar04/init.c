@@ -0,0 +1,362 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libcsupport.h>
+
+#include "image_tar.h"
+#include "image_tar_gz.h"
+
+const char rtems_test_name[] = "TAR 4";
+
+#define BIG_LINE_COUNT 300000
+
+static const char test_file_content[] =
+  "This is a test of mounting an RTEMS file system from a\n"
+  "tar image.\n";
+
+static void make_path(
+  char *path,
+  size_t size,
+  const char *mountpoint,
+  const char *name
+)
+{
+  int n = snprintf(path, size, "%s/%s", mountpoint, name);
+
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void *read_file(const char *mountpoint, const char *name, size_t *size)
+{
+  char path[64];
+  struct stat st;
+  char *buf;
+  ssize_t n;
+  int rv;
+  int fd;
+
+  make_path(path, sizeof(path), mountpoint, name);
+
+  rv = stat(path, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(S_ISREG(st.st_mode));
+
+  buf = malloc((size_t) st.st_size + 1);
+  rtems_test_assert(buf != NULL);
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, buf, (size_t) st.st_size + 1);
+  rtems_test_assert(n == (ssize_t) st.st_size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  *size = (size_t) n;
+
+  return buf;
+}
+
+static void check_file(
+  const char *mountpoint,
+  const char *name,
+  const char *content
+)
+{
+  size_t size;
+  char *buf = read_file(mountpoint, name, &size);
+
+  rtems_test_assert(size == strlen(content));
+  rtems_test_assert(memcmp(buf, content, size) == 0);
+
+  free(buf);
+}
+
+static void check_chunk(int fd, const char *content, size_t size, off_t offset)
+{
+  char chunk[1000];
+  size_t n = sizeof(chunk);
+  ssize_t m;
+
+  if (n > size - (size_t) offset) {
+    n = size - (size_t) offset;
+  }
+
+  m = read(fd, chunk, sizeof(chunk));
+  rtems_test_assert(m == (ssize_t) n);
+  rtems_test_assert(memcmp(chunk, &content[offset], n) == 0);
+}
+
+static void check_big_file_chunks(
+  const char *mountpoint,
+  const char *content,
+  size_t size
+)
+{
+  char path[64];
+  off_t offset;
+  off_t pos;
+  int rv;
+  int fd;
+
+  make_path(path, sizeof(path), mountpoint, "home/big");
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  /* Small reads which are not aligned with the cache blocks */
+  for (offset = 0; offset < (off_t) size; offset += 1000) {
+    check_chunk(fd, content, size, offset);
+  }
+
+  /* Seek backwards to blocks which were evicted from the cache */
+  offset = (off_t) size / 3;
+  pos = lseek(fd, offset, SEEK_SET);
+  rtems_test_assert(pos == offset);
+  check_chunk(fd, content, size, offset);
+
+  offset = 12345;
+  pos = lseek(fd, offset, SEEK_SET);
+  rtems_test_assert(pos == offset);
+  check_chunk(fd, content, size, offset);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_big_file(const char *mountpoint)
+{
+  size_t size;
+  char *buf = read_file(mountpoint, "home/big", &size);
+  size_t offset = 0;
+  int i;
+
+  for (i = 1; i <= BIG_LINE_COUNT; ++i) {
+    char line[16];
+    int n = snprintf(line, sizeof(line), "%i\n", i);
+
+    rtems_test_assert(offset + (size_t) n <= size);
+    rtems_test_assert(memcmp(&buf[offset], line, (size_t) n) == 0);
+    offset += (size_t) n;
+  }
+
+  rtems_test_assert(offset == size);
+
+  check_big_file_chunks(mountpoint, buf, size);
+
+  free(buf);
+}
+
+static void check_content(const char *mountpoint)
+{
+  char path[64];
+  char target[64];
+  struct stat st;
+  ssize_t n;
+  int rv;
+  int fd;
+
+  make_path(path, sizeof(path), mountpoint, "home");
+  rv = stat(path, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(S_ISDIR(st.st_mode));
+
+  check_file(mountpoint, "home/test_file", test_file_content);
+  check_file(mountpoint, "symlink", test_file_content);
+
+  make_path(path, sizeof(path), mountpoint, "symlink");
+  n = readlink(path, target, sizeof(target));
+  rtems_test_assert(n == (ssize_t) strlen("home/test_file"));
+  rtems_test_assert(memcmp(target, "home/test_file", (size_t) n) == 0);
+
+  /* The tail follows the big file, so it needs a later access point */
+  check_file(mountpoint, "home/tail", "tail\n");
+  check_big_file(mountpoint);
+
+  /* The file system is read-only */
+  make_path(path, sizeof(path), mountpoint, "home/test_file");
+  errno = 0;
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd == -1);
+  rtems_test_assert(errno == EROFS);
+
+  make_path(path, sizeof(path), mountpoint, "new");
+  errno = 0;
+  rv = mkdir(path, S_IRWXU);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EROFS);
+}
+
+static void test_mount(
+  const char *mountpoint,
+  const void *image,
+  size_t size,
+  const rtems_tarfs_decompressor *decompressor
+)
+{
+  rtems_resource_snapshot before;
+  int rv;
+
+  rtems_resource_snapshot_take(&before);
+
+  rv = rtems_tarfs_mount(mountpoint, image, size, decompressor);
+  rtems_test_assert(rv == 0);
+
+  check_content(mountpoint);
+
+  rv = unmount(mountpoint);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(rtems_resource_snapshot_check(&before));
+}
+
+static void test_mount_error(
+  const char *mountpoint,
+  const void *image,
+  size_t size,
+  const rtems_tarfs_decompressor *decompressor,
+  int expected_errno
+)
+{
+  rtems_resource_snapshot before;
+  char path[64];
+  struct stat st;
+  int rv;
+
+  rtems_resource_snapshot_take(&before);
+
+  errno = 0;
+  rv = rtems_tarfs_mount(mountpoint, image, size, decompressor);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == expected_errno);
+
+  /* The file system must be unmounted */
+  make_path(path, sizeof(path), mountpoint, "home");
+  errno = 0;
+  rv = stat(path, &st);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  rtems_test_assert(rtems_resource_snapshot_check(&before));
+}
+
+static void test_errors(void)
+{
+  unsigned char *image;
+
+  image = malloc(image_tar_gz_size);
+  rtems_test_assert(image != NULL);
+
+  /* A gzip image needs a decompressor */
+  test_mount_error("/gz", image_tar_gz, image_tar_gz_size, NULL, EINVAL);
+
+  /* The CRC of the gzip trailer does not match */
+  memcpy(image, image_tar_gz, image_tar_gz_size);
+  image[image_tar_gz_size - 8] ^= 0xff;
+  test_mount_error(
+    "/gz",
+    image,
+    image_tar_gz_size,
+    &rtems_tarfs_decompressor_gzip,
+    EIO
+  );
+
+  /* The compressed data is truncated */
+  test_mount_error(
+    "/gz",
+    image_tar_gz,
+    image_tar_gz_size - 16,
+    &rtems_tarfs_decompressor_gzip,
+    EIO
+  );
+
+  free(image);
+
+  image = malloc(image_tar_size);
+  rtems_test_assert(image != NULL);
+
+  /* The header checksum does not match */
+  memcpy(image, image_tar, image_tar_size);
+  image[0] ^= 0x20;
+  test_mount_error("/plain", image, image_tar_size, NULL, EINVAL);
+
+  /* The content of the test file is truncated */
+  test_mount_error("/plain", image_tar, 1024 + 16, NULL, EINVAL);
+
+  free(image);
+}
+
+static void test(void)
+{
+  int rv;
+
+  rv = mkdir("/plain", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mkdir("/gz", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  test_mount("/plain", image_tar, image_tar_size, NULL);
+  test_mount(
+    "/plain",
+    image_tar,
+    image_tar_size,
+    &rtems_tarfs_decompressor_gzip
+  );
+  test_mount(
+    "/gz",
+    image_tar_gz,
+    image_tar_gz_size,
+    &rtems_tarfs_decompressor_gzip
+  );
+  test_errors();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,314 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPEDF 1";
+
+#define SCHED_GLOBAL rtems_build_name('G', 'L', 'O', 'B')
+
+#define SCHED_EDF rtems_build_name('M', 'E', 'D', 'F')
+
+#define CLUSTER_CPU_MAX 4
+
+#define TASKS_PER_CPU 3
+
+#define TASK_MAX (TASKS_PER_CPU * CLUSTER_CPU_MAX)
+
+#define INIT_PRIO 1
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#define TASK_PRIO_BASE (INIT_PRIO + 1)
+
+typedef struct {
+  rtems_id id;
+  rtems_interval period;
+  uint32_t exec_ns;
+  uint32_t jobs;
+  uint32_t misses;
+  volatile bool finished;
+} task_context;
+
+typedef struct {
+  volatile bool stop;
+  task_context tasks[TASK_MAX];
+} test_context;
+
+static test_context test_instance;
+
+/*
+ * The periods of the tasks of one processor in clock ticks.  The sum of the
+ * utilizations of a task set should not be an integral multiple of the
+ * processor count, otherwise every load is trivially schedulable by both
+ * algorithms.
+ */
+static const rtems_interval periods[TASKS_PER_CPU] = { 7, 11, 13 };
+
+/* Total utilization of a cluster in percent of its processing capacity */
+static const uint32_t load_levels[] = { 50, 70, 85, 95, 100 };
+
+static void periodic_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  task_context *task = &ctx->tasks[arg];
+  rtems_status_code sc;
+  rtems_id period_id;
+
+  sc = rtems_rate_monotonic_create(
+    rtems_build_name('P', 'E', 'R', 'D'),
+    &period_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Start the first period */
+  sc = rtems_rate_monotonic_period(period_id, task->period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (!ctx->stop) {
+    rtems_counter_delay_nanoseconds(task->exec_ns);
+
+    /*
+     * A timeout status indicates that the job did not finish within its
+     * period, so its deadline was missed.
+     */
+    sc = rtems_rate_monotonic_period(period_id, task->period);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL || sc == RTEMS_TIMEOUT);
+
+    if (sc == RTEMS_TIMEOUT) {
+      ++task->misses;
+    }
+
+    ++task->jobs;
+  }
+
+  sc = rtems_rate_monotonic_delete(period_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  task->finished = true;
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static uint32_t get_processor_count(rtems_id scheduler_id)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  sc = rtems_scheduler_get_processor_set(
+    scheduler_id,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return (uint32_t) CPU_COUNT(&cpuset);
+}
+
+static void run_load(
+  test_context *ctx,
+  rtems_id scheduler_id,
+  uint32_t cpu_count,
+  uint32_t load,
+  const char *description
+)
+{
+  rtems_status_code sc;
+  uint32_t ns_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+  uint32_t task_count = TASKS_PER_CPU * cpu_count;
+  uint32_t jobs;
+  uint32_t misses;
+  uint32_t i;
+
+  ctx->stop = false;
+
+  for (i = 0; i < task_count; ++i) {
+    task_context *task = &ctx->tasks[i];
+    uint32_t period_index = i % TASKS_PER_CPU;
+
+    task->period = periods[period_index];
+    task->exec_ns = (uint32_t) (
+      ((uint64_t) task->period * ns_per_tick * load)
+        / (100 * TASKS_PER_CPU)
+    );
+    task->jobs = 0;
+    task->misses = 0;
+    task->finished = false;
+
+    /*
+     * The priorities are assigned rate monotonic, so the task with the
+     * shortest period has the highest priority.  The EDF scheduler uses the
+     * priorities only for the background tasks.
+     */
+    sc = rtems_task_create(
+      rtems_build_name('T', 'A', 'S', 'K'),
+      TASK_PRIO_BASE + period_index,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &task->id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(task->id, scheduler_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(task->id, periodic_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_wake_after(rtems_clock_get_ticks_per_second());
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop = true;
+
+  jobs = 0;
+  misses = 0;
+
+  for (i = 0; i < task_count; ++i) {
+    task_context *task = &ctx->tasks[i];
+
+    while (!task->finished) {
+      sc = rtems_task_wake_after(periods[TASKS_PER_CPU - 1]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    sc = rtems_task_delete(task->id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    jobs += task->jobs;
+    misses += task->misses;
+  }
+
+  rtems_test_assert(jobs > 0);
+
+  printf(
+    "%s: load %" PRIu32 "%%, jobs %" PRIu32 ", deadline misses %" PRIu32
+      " (%" PRIu32 ".%" PRIu32 "%%)\n",
+    description,
+    load,
+    jobs,
+    misses,
+    (1000 * misses / jobs) / 10,
+    (1000 * misses / jobs) % 10
+  );
+}
+
+static void run_loads(
+  test_context *ctx,
+  rtems_name scheduler_name,
+  const char *description
+)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_id;
+  uint32_t cpu_count;
+  size_t i;
+
+  sc = rtems_scheduler_ident(scheduler_name, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_count = get_processor_count(scheduler_id);
+  if (cpu_count == 0) {
+    printf("%s: no processors available\n", description);
+    return;
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(load_levels); ++i) {
+    run_load(ctx, scheduler_id, cpu_count, load_levels[i], description);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  run_loads(ctx, SCHED_GLOBAL, "global fixed priority scheduler");
+  run_loads(ctx, SCHED_EDF, "global EDF scheduler");
+}
+
+#else /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void test(void)
+{
+  /* Nothing to do */
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS (2 * CLUSTER_CPU_MAX)
+
+#define CONFIGURE_MAXIMUM_PRIORITY 255
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_EDF_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(global, CONFIGURE_MAXIMUM_PRIORITY + 1);
+
+RTEMS_SCHEDULER_CONTEXT_EDF_SMP(edf);
+
+#define CONFIGURE_SCHEDULER_CONTROLS \
+  RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(global, SCHED_GLOBAL), \
+  RTEMS_SCHEDULER_CONTROL_EDF_SMP(edf, SCHED_EDF)
+
+/*
+ * The first half of the processors uses the global fixed priority scheduler,
+ * the second half uses the global EDF scheduler.
+ */
+#define CONFIGURE_SMP_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASK_MAX)
+
+#define CONFIGURE_MAXIMUM_PERIODS TASK_MAX
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIO
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -29,6 +29,8 @@ const char rtems_test_name[] = "SMPIPI 1";
 
 #define CPU_COUNT 32
 
+#define MESSAGE_COUNT 100000
+
 typedef struct {
   uint32_t value;
   uint32_t cache_line_separation[31];
@@ -149,7 +151,7 @@ static void test_send_message_flood(
       }
     }
 
-    for (i = 0; i < 100000; ++i) {
+    for (i = 0; i < MESSAGE_COUNT; ++i) {
       _SMP_Send_message(cpu_index, SMP_MESSAGE_TEST);
     }
 
@@ -171,12 +173,123 @@ static void test_send_message_flood(
   }
 }
 
+static void get_ipi_statistics(
+  uint32_t cpu_index,
+  rtems_processor_ipi_statistics *stats
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_get_processor_ipi_statistics(cpu_index, stats);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_ipi_statistics_errors(void)
+{
+  rtems_status_code sc;
+  rtems_processor_ipi_statistics stats;
+
+  sc = rtems_get_processor_ipi_statistics(0, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_get_processor_ipi_statistics(
+    rtems_get_processor_count(),
+    &stats
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_send_message_batching(
+  test_context *ctx
+)
+{
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_index_self = rtems_get_current_processor();
+  uint32_t cpu_index;
+
+  _SMP_Set_test_message_handler(counter_handler);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    if (cpu_index != cpu_index_self) {
+      rtems_processor_ipi_statistics self_before;
+      rtems_processor_ipi_statistics self_after;
+      rtems_processor_ipi_statistics other_before;
+      rtems_processor_ipi_statistics other_after;
+      rtems_counter_ticks t0;
+      rtems_counter_ticks t1;
+      uint32_t requests;
+      uint32_t sent;
+      uint32_t received;
+      uint32_t i;
+
+      /* Wait 1ms so that all outstanding messages have been processed */
+      rtems_counter_delay_nanoseconds(1000000);
+
+      get_ipi_statistics(cpu_index_self, &self_before);
+      get_ipi_statistics(cpu_index, &other_before);
+
+      t0 = rtems_counter_read();
+
+      for (i = 0; i < MESSAGE_COUNT; ++i) {
+        _SMP_Send_message(cpu_index, SMP_MESSAGE_TEST);
+      }
+
+      t1 = rtems_counter_read();
+
+      rtems_counter_delay_nanoseconds(1000000);
+
+      get_ipi_statistics(cpu_index_self, &self_after);
+      get_ipi_statistics(cpu_index, &other_after);
+
+      requests = self_after.request_count - self_before.request_count;
+      sent = self_after.send_count - self_before.send_count;
+      received = other_after.receive_count - other_before.receive_count;
+
+      rtems_test_assert(requests >= MESSAGE_COUNT);
+      rtems_test_assert(sent <= requests);
+      rtems_test_assert(sent > 0);
+      rtems_test_assert(received > 0);
+
+      printf(
+        "batching for processor %" PRIu32 ": requests %" PRIu32
+          ", interrupts sent %" PRIu32 ", interrupts received %" PRIu32
+          ", %" PRIu64 "ns per request\n",
+        cpu_index,
+        requests,
+        sent,
+        received,
+        rtems_counter_ticks_to_nanoseconds(
+          rtems_counter_difference(t1, t0)
+        ) / MESSAGE_COUNT
+      );
+    }
+  }
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_processor_ipi_statistics stats;
+
+    get_ipi_statistics(cpu_index, &stats);
+
+    printf(
+      "inter-processor interrupt statistics for processor %" PRIu32
+        "%s: requests %" PRIu32 ", sent %" PRIu32 ", received %" PRIu32 "\n",
+      cpu_index,
+      cpu_index == cpu_index_self ? " (main)" : "",
+      stats.request_count,
+      stats.send_count,
+      stats.receive_count
+    );
+  }
+}
+
 static void test(void)
 {
   test_context *ctx = &test_instance;
 
+  test_ipi_statistics_errors();
   test_send_message_while_processing_a_message(ctx);
   test_send_message_flood(ctx);
+  test_send_message_batching(ctx);
 }
 
 static void Init(rtems_task_argument arg)
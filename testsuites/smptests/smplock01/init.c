@@ -29,7 +29,7 @@ const char rtems_test_name[] = "SMPLOCK 1";
 
 #define CPU_COUNT 32
 
-#define TEST_COUNT 5
+#define TEST_COUNT 9
 
 typedef enum {
   INITIAL,
@@ -45,12 +45,16 @@ typedef struct {
   unsigned long counter[TEST_COUNT];
   unsigned long test_counter[TEST_COUNT][CPU_COUNT];
   SMP_lock_Control lock;
+  SMP_ticket_lock_Control ticket_lock;
+  SMP_MCS_lock_Control mcs_lock;
 } global_context;
 
 static global_context context = {
   .state = ATOMIC_INITIALIZER_UINT(INITIAL),
   .barrier = SMP_BARRIER_CONTROL_INITIALIZER,
-  .lock = SMP_LOCK_INITIALIZER("global")
+  .lock = SMP_LOCK_INITIALIZER("global"),
+  .ticket_lock = SMP_TICKET_LOCK_INITIALIZER("global ticket"),
+  .mcs_lock = SMP_MCS_LOCK_INITIALIZER("global MCS")
 };
 
 static const char *test_names[TEST_COUNT] = {
@@ -58,7 +62,11 @@ static const char *test_names[TEST_COUNT] = {
   "aquire global lock with global counter",
   "aquire local lock with local counter",
   "aquire local lock with global counter",
-  "aquire global lock with busy section"
+  "aquire global lock with busy section",
+  "acquire global ticket lock with local counter",
+  "acquire global MCS lock with local counter",
+  "acquire global ticket lock with busy section",
+  "acquire global MCS lock with busy section"
 };
 
 static void stop_test_timer(rtems_id timer_id, void *arg)
@@ -215,12 +223,98 @@ static void test_4_body(
   ctx->test_counter[test][cpu_self] = counter;
 }
 
+static void test_5_body(
+  int test,
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  SMP_lock_Stats_context stats_context;
+
+  while (assert_state(ctx, START_TEST)) {
+    _SMP_ticket_lock_Acquire(&ctx->ticket_lock, &stats_context);
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &stats_context);
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static void test_6_body(
+  int test,
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  SMP_MCS_lock_Context lock_context;
+
+  while (assert_state(ctx, START_TEST)) {
+    _SMP_MCS_lock_Acquire(&ctx->mcs_lock, &lock_context);
+    _SMP_MCS_lock_Release(&ctx->mcs_lock, &lock_context);
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static void test_7_body(
+  int test,
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  SMP_lock_Stats_context stats_context;
+
+  while (assert_state(ctx, START_TEST)) {
+    _SMP_ticket_lock_Acquire(&ctx->ticket_lock, &stats_context);
+    busy_section();
+    _SMP_ticket_lock_Release(&ctx->ticket_lock, &stats_context);
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static void test_8_body(
+  int test,
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  SMP_MCS_lock_Context lock_context;
+
+  while (assert_state(ctx, START_TEST)) {
+    _SMP_MCS_lock_Acquire(&ctx->mcs_lock, &lock_context);
+    busy_section();
+    _SMP_MCS_lock_Release(&ctx->mcs_lock, &lock_context);
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
 static const test_body test_bodies[TEST_COUNT] = {
   test_0_body,
   test_1_body,
   test_2_body,
   test_3_body,
-  test_4_body
+  test_4_body,
+  test_5_body,
+  test_6_body,
+  test_7_body,
+  test_8_body
 };
 
 static void run_tests(
@@ -0,0 +1,332 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/score/protectedheap.h>
+#include <rtems/score/smpbarrier.h>
+#include <rtems/score/atomic.h>
+#include <rtems.h>
+
+#include <stdlib.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMALLOC 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define OBJECT_COUNT 16
+
+#define CACHE_BLOCKS 32
+
+typedef enum {
+  INITIAL,
+  START_TEST,
+  STOP_TEST
+} states;
+
+typedef struct {
+  Atomic_Uint state;
+  SMP_barrier_Control barrier;
+  rtems_id timer_id;
+  rtems_interval timeout;
+  unsigned long test_counter[TEST_COUNT][CPU_COUNT];
+} global_context;
+
+static global_context context = {
+  .state = ATOMIC_INITIALIZER_UINT(INITIAL),
+  .barrier = SMP_BARRIER_CONTROL_INITIALIZER
+};
+
+static const char *test_names[TEST_COUNT] = {
+  "malloc and free with per-processor caches",
+  "protected heap allocate and free"
+};
+
+/*
+ * Small object sizes typical for network buffer descriptors and file system
+ * nodes.
+ */
+static size_t object_size(int i)
+{
+  return 16 + (i % 8) * 24;
+}
+
+static void stop_test_timer(rtems_id timer_id, void *arg)
+{
+  global_context *ctx = arg;
+
+  _Atomic_Store_uint(&ctx->state, STOP_TEST, ATOMIC_ORDER_RELEASE);
+}
+
+static void wait_for_state(global_context *ctx, int desired_state)
+{
+  while (
+    _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_ACQUIRE) != desired_state
+  ) {
+    /* Wait */
+  }
+}
+
+static bool assert_state(global_context *ctx, int desired_state)
+{
+  return _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_RELAXED) == desired_state;
+}
+
+typedef void (*test_body)(
+  int test,
+  global_context *ctx,
+  unsigned int cpu_self
+);
+
+static void test_0_body(
+  int test,
+  global_context *ctx,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  void *objects[OBJECT_COUNT];
+  int i;
+
+  while (assert_state(ctx, START_TEST)) {
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      objects[i] = malloc(object_size(i));
+      rtems_test_assert(objects[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      free(objects[i]);
+    }
+
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static void test_1_body(
+  int test,
+  global_context *ctx,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  void *objects[OBJECT_COUNT];
+  int i;
+
+  while (assert_state(ctx, START_TEST)) {
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      objects[i] = _Protected_heap_Allocate(
+        RTEMS_Malloc_Heap,
+        object_size(i)
+      );
+      rtems_test_assert(objects[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      bool ok = _Protected_heap_Free(RTEMS_Malloc_Heap, objects[i]);
+      rtems_test_assert(ok);
+    }
+
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static const test_body test_bodies[TEST_COUNT] = {
+  test_0_body,
+  test_1_body
+};
+
+static void run_tests(
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self,
+  bool master
+)
+{
+  int test;
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+
+    if (master) {
+      rtems_status_code sc = rtems_timer_fire_after(
+        ctx->timer_id,
+        ctx->timeout,
+        stop_test_timer,
+        ctx
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      _Atomic_Store_uint(&ctx->state, START_TEST, ATOMIC_ORDER_RELEASE);
+    }
+
+    wait_for_state(ctx, START_TEST);
+
+    (*test_bodies[test])(test, ctx, cpu_self);
+  }
+
+  _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+}
+
+static void task(rtems_task_argument arg)
+{
+  global_context *ctx = (global_context *) arg;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, false);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_caches(void)
+{
+  rtems_malloc_statistics_t stats;
+  bool ok;
+  int rv;
+
+  ok = malloc_walk(0, false);
+  rtems_test_assert(ok);
+
+  rv = malloc_get_statistics(&stats);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stats.cache_hits > 0);
+  rtems_test_assert(stats.cache_refills > 0);
+  rtems_test_assert(stats.cached_blocks > 0);
+
+  printf(
+    "cache hits %" PRIu32 ", refills %" PRIu32 ", flushes %" PRIu32 "\n",
+    stats.cache_hits,
+    stats.cache_refills,
+    stats.cache_flushes
+  );
+
+  malloc_cache_flush();
+
+  rv = malloc_get_statistics(&stats);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(stats.cached_blocks == 0);
+
+  ok = malloc_walk(0, false);
+  rtems_test_assert(ok);
+}
+
+static void test(void)
+{
+  global_context *ctx = &context;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  uint32_t cpu;
+  int test;
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    if (cpu != cpu_self) {
+      rtems_id task_id;
+
+      sc = rtems_task_create(
+        rtems_build_name('T', 'A', 'S', 'K'),
+        TASK_PRIORITY,
+        RTEMS_MINIMUM_STACK_SIZE,
+        RTEMS_DEFAULT_MODES,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &task_id
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  ctx->timeout = 10 * rtems_clock_get_ticks_per_second();
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, true);
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    unsigned long sum = 0;
+
+    printf("%s\n", test_names[test]);
+
+    for (cpu = 0; cpu < cpu_count; ++cpu) {
+      unsigned long local_counter = ctx->test_counter[test][cpu];
+
+      sum += local_counter;
+
+      printf(
+        "\tprocessor %" PRIu32 ", local counter %lu\n",
+        cpu,
+        local_counter
+      );
+    }
+
+    printf(
+      "\tsum of local counter %lu, objects per iteration %i\n",
+      sum,
+      OBJECT_COUNT
+    );
+  }
+
+  check_caches();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MALLOC_CACHE_BLOCKS CACHE_BLOCKS
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
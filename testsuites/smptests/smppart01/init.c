@@ -0,0 +1,301 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smpbarrier.h>
+#include <rtems/score/atomic.h>
+#include <rtems.h>
+
+#include <stdlib.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPPART 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define CACHE_BUFFERS 16
+
+#define SMALL_OBJECT_COUNT (CACHE_BUFFERS / 2)
+
+#define LARGE_OBJECT_COUNT (4 * CACHE_BUFFERS)
+
+#define BUFFER_SIZE 64
+
+#define BUFFER_COUNT (CPU_COUNT * (CACHE_BUFFERS + LARGE_OBJECT_COUNT))
+
+typedef enum {
+  INITIAL,
+  START_TEST,
+  STOP_TEST
+} states;
+
+typedef struct {
+  Atomic_Uint state;
+  SMP_barrier_Control barrier;
+  rtems_id timer_id;
+  rtems_id partition_id;
+  rtems_interval timeout;
+  unsigned long test_counter[TEST_COUNT][CPU_COUNT];
+} global_context;
+
+static global_context context = {
+  .state = ATOMIC_INITIALIZER_UINT(INITIAL),
+  .barrier = SMP_BARRIER_CONTROL_INITIALIZER
+};
+
+static const char *test_names[TEST_COUNT] = {
+  "get and return buffers within the per-processor cache size",
+  "get and return buffers exceeding the per-processor cache size"
+};
+
+static const int object_counts[TEST_COUNT] = {
+  SMALL_OBJECT_COUNT,
+  LARGE_OBJECT_COUNT
+};
+
+static char partition_area[BUFFER_COUNT * BUFFER_SIZE]
+  CPU_STRUCTURE_ALIGNMENT;
+
+static void stop_test_timer(rtems_id timer_id, void *arg)
+{
+  global_context *ctx = arg;
+
+  _Atomic_Store_uint(&ctx->state, STOP_TEST, ATOMIC_ORDER_RELEASE);
+}
+
+static void wait_for_state(global_context *ctx, int desired_state)
+{
+  while (
+    _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_ACQUIRE) != desired_state
+  ) {
+    /* Wait */
+  }
+}
+
+static bool assert_state(global_context *ctx, int desired_state)
+{
+  return _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_RELAXED) == desired_state;
+}
+
+static void get_and_return_buffers(
+  int test,
+  global_context *ctx,
+  unsigned int cpu_self
+)
+{
+  unsigned long counter = 0;
+  void *objects[LARGE_OBJECT_COUNT];
+  int object_count = object_counts[test];
+  int i;
+
+  while (assert_state(ctx, START_TEST)) {
+    rtems_status_code sc;
+
+    for (i = 0; i < object_count; ++i) {
+      sc = rtems_partition_get_buffer(ctx->partition_id, &objects[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    for (i = 0; i < object_count; ++i) {
+      sc = rtems_partition_return_buffer(ctx->partition_id, objects[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    ++counter;
+  }
+
+  ctx->test_counter[test][cpu_self] = counter;
+}
+
+static void run_tests(
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self,
+  bool master
+)
+{
+  int test;
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+
+    if (master) {
+      rtems_status_code sc = rtems_timer_fire_after(
+        ctx->timer_id,
+        ctx->timeout,
+        stop_test_timer,
+        ctx
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      _Atomic_Store_uint(&ctx->state, START_TEST, ATOMIC_ORDER_RELEASE);
+    }
+
+    wait_for_state(ctx, START_TEST);
+
+    get_and_return_buffers(test, ctx, cpu_self);
+  }
+
+  _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+}
+
+static void task(rtems_task_argument arg)
+{
+  global_context *ctx = (global_context *) arg;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, false);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void check_partition(global_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+
+  sc = rtems_partition_get_buffer(ctx->partition_id, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_partition_delete(ctx->partition_id);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  sc = rtems_partition_return_buffer(ctx->partition_id, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The free buffers in the caches of all processors return to the partition
+   * during the deletion.
+   */
+  sc = rtems_partition_delete(ctx->partition_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  global_context *ctx = &context;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  uint32_t cpu;
+  int test;
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    if (cpu != cpu_self) {
+      rtems_id task_id;
+
+      sc = rtems_task_create(
+        rtems_build_name('T', 'A', 'S', 'K'),
+        TASK_PRIORITY,
+        RTEMS_MINIMUM_STACK_SIZE,
+        RTEMS_DEFAULT_MODES,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &task_id
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  ctx->timeout = 10 * rtems_clock_get_ticks_per_second();
+
+  sc = rtems_partition_create(
+    rtems_build_name('P', 'A', 'R', 'T'),
+    partition_area,
+    sizeof(partition_area),
+    BUFFER_SIZE,
+    RTEMS_LOCAL,
+    &ctx->partition_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, true);
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    unsigned long sum = 0;
+
+    printf("%s\n", test_names[test]);
+
+    for (cpu = 0; cpu < cpu_count; ++cpu) {
+      unsigned long local_counter = ctx->test_counter[test][cpu];
+
+      sum += local_counter;
+
+      printf(
+        "\tprocessor %" PRIu32 ", local counter %lu\n",
+        cpu,
+        local_counter
+      );
+    }
+
+    printf(
+      "\tsum of local counter %lu, buffers per iteration %i\n",
+      sum,
+      object_counts[test]
+    );
+  }
+
+  check_partition(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MAXIMUM_PARTITIONS 1
+
+#define CONFIGURE_PARTITION_CACHE_BUFFERS CACHE_BUFFERS
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
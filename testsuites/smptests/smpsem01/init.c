@@ -0,0 +1,328 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smpbarrier.h>
+#include <rtems/score/atomic.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSEM 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 3
+
+typedef enum {
+  INITIAL,
+  START_TEST,
+  STOP_TEST
+} states;
+
+typedef struct {
+  Atomic_Uint state;
+  SMP_barrier_Control barrier;
+  rtems_id timer_id;
+  rtems_interval timeout;
+  rtems_id counting_ids[CPU_COUNT];
+  rtems_id mutex_ids[CPU_COUNT];
+  rtems_id shared_id;
+  unsigned long test_counter[TEST_COUNT][CPU_COUNT][CPU_COUNT];
+} global_context;
+
+static global_context context = {
+  .state = ATOMIC_INITIALIZER_UINT(INITIAL),
+  .barrier = SMP_BARRIER_CONTROL_INITIALIZER
+};
+
+static const char *test_names[TEST_COUNT] = {
+  "obtain and release a counting semaphore per processor",
+  "obtain and release a priority inheritance mutex per processor",
+  "obtain and release one binary semaphore shared by all processors"
+};
+
+static void stop_test_timer(rtems_id timer_id, void *arg)
+{
+  global_context *ctx = arg;
+
+  _Atomic_Store_uint(&ctx->state, STOP_TEST, ATOMIC_ORDER_RELEASE);
+}
+
+static void wait_for_state(global_context *ctx, int desired_state)
+{
+  while (
+    _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_ACQUIRE) != desired_state
+  ) {
+    /* Wait */
+  }
+}
+
+static bool assert_state(global_context *ctx, int desired_state)
+{
+  return _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_RELAXED) == desired_state;
+}
+
+static rtems_id get_semaphore(
+  global_context *ctx,
+  int test,
+  unsigned int cpu_self
+)
+{
+  switch (test) {
+    case 0:
+      return ctx->counting_ids[cpu_self];
+    case 1:
+      return ctx->mutex_ids[cpu_self];
+    default:
+      return ctx->shared_id;
+  }
+}
+
+static void obtain_and_release(
+  global_context *ctx,
+  int test,
+  unsigned int active,
+  unsigned int cpu_self
+)
+{
+  rtems_id id = get_semaphore(ctx, test, cpu_self);
+  unsigned long counter = 0;
+
+  while (assert_state(ctx, START_TEST)) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_obtain(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_release(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++counter;
+  }
+
+  ctx->test_counter[test][active - 1][cpu_self] = counter;
+}
+
+static void run_tests(
+  global_context *ctx,
+  SMP_barrier_State *bs,
+  unsigned int cpu_count,
+  unsigned int cpu_self,
+  bool master
+)
+{
+  int test;
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    unsigned int active;
+
+    for (active = 1; active <= cpu_count; ++active) {
+      _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+
+      if (master) {
+        rtems_status_code sc = rtems_timer_fire_after(
+          ctx->timer_id,
+          ctx->timeout,
+          stop_test_timer,
+          ctx
+        );
+        rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+        _Atomic_Store_uint(&ctx->state, START_TEST, ATOMIC_ORDER_RELEASE);
+      }
+
+      wait_for_state(ctx, START_TEST);
+
+      if (cpu_self < active) {
+        obtain_and_release(ctx, test, active, cpu_self);
+      } else {
+        wait_for_state(ctx, STOP_TEST);
+      }
+    }
+  }
+
+  _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+}
+
+static void task(rtems_task_argument arg)
+{
+  global_context *ctx = (global_context *) arg;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, false);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_semaphores(global_context *ctx, uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  uint32_t cpu;
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    sc = rtems_semaphore_create(
+      rtems_build_name('C', 'O', 'U', 'N'),
+      1,
+      RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+      0,
+      &ctx->counting_ids[cpu]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_create(
+      rtems_build_name('M', 'U', 'T', 'X'),
+      1,
+      RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+      0,
+      &ctx->mutex_ids[cpu]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'H', 'R', 'D'),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->shared_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_semaphores(global_context *ctx, uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  uint32_t cpu;
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    /*
+     * The counting semaphores must have their initial count again.
+     */
+    sc = rtems_semaphore_obtain(ctx->counting_ids[cpu], RTEMS_NO_WAIT, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_obtain(ctx->counting_ids[cpu], RTEMS_NO_WAIT, 0);
+    rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+    sc = rtems_semaphore_delete(ctx->counting_ids[cpu]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_delete(ctx->mutex_ids[cpu]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_semaphore_delete(ctx->shared_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  global_context *ctx = &context;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu_self = rtems_get_current_processor();
+  uint32_t cpu;
+  int test;
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  create_semaphores(ctx, cpu_count);
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    if (cpu != cpu_self) {
+      rtems_id task_id;
+
+      sc = rtems_task_create(
+        rtems_build_name('T', 'A', 'S', 'K'),
+        TASK_PRIORITY,
+        RTEMS_MINIMUM_STACK_SIZE,
+        RTEMS_DEFAULT_MODES,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &task_id
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  ctx->timeout = rtems_clock_get_ticks_per_second();
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  run_tests(ctx, &bs, cpu_count, cpu_self, true);
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    uint32_t active;
+
+    printf("%s\n", test_names[test]);
+
+    for (active = 1; active <= cpu_count; ++active) {
+      unsigned long sum = 0;
+
+      for (cpu = 0; cpu < active; ++cpu) {
+        sum += ctx->test_counter[test][active - 1][cpu];
+      }
+
+      printf(
+        "\t%" PRIu32 " active processors, sum of local counters %lu\n",
+        active,
+        sum
+      );
+    }
+  }
+
+  delete_semaphores(ctx, cpu_count);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES (2 * CPU_COUNT + 1)
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,333 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smpbarrier.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPWATCHDOG 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define LOAD_TIMER_COUNT 16
+
+typedef enum {
+  INITIAL,
+  START_TEST,
+  STOP_TEST
+} states;
+
+typedef struct {
+  Atomic_Uint state;
+  SMP_barrier_Control barrier;
+  rtems_id stop_timer_id;
+  rtems_interval duration;
+  Watchdog_Control watchdogs[CPU_COUNT];
+  Watchdog_Control load_watchdogs[CPU_COUNT][LOAD_TIMER_COUNT];
+  Atomic_Uint fired[CPU_COUNT];
+  unsigned long counter[CPU_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .state = ATOMIC_INITIALIZER_UINT(INITIAL),
+  .barrier = SMP_BARRIER_CONTROL_INITIALIZER
+};
+
+static void stop_test_timer(rtems_id timer_id, void *arg)
+{
+  test_context *ctx = arg;
+
+  _Atomic_Store_uint(&ctx->state, STOP_TEST, ATOMIC_ORDER_RELEASE);
+}
+
+static void wait_for_state(test_context *ctx, unsigned int desired_state)
+{
+  while (
+    _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_ACQUIRE) != desired_state
+  ) {
+    /* Wait */
+  }
+}
+
+static bool assert_state(test_context *ctx, unsigned int desired_state)
+{
+  return _Atomic_Load_uint(&ctx->state, ATOMIC_ORDER_RELAXED) == desired_state;
+}
+
+static void fired(Objects_Id id, void *arg)
+{
+  Atomic_Uint *fired = arg;
+
+  _Atomic_Store_uint(fired, 1, ATOMIC_ORDER_RELEASE);
+}
+
+static void never_fired(Objects_Id id, void *arg)
+{
+  rtems_test_assert(0);
+}
+
+static void insert_watchdog(
+  Watchdog_Control *watchdog,
+  Watchdog_Interval units,
+  uint32_t *cpu_arm
+)
+{
+  ISR_Level level;
+
+  /* Prevent a migration between the processor query and the arming */
+  _ISR_Disable_without_giant(level);
+  *cpu_arm = rtems_get_current_processor();
+  _Watchdog_Insert_ticks(watchdog, units);
+  _ISR_Enable_without_giant(level);
+}
+
+static void test_insert_on_arming_processor(
+  test_context *ctx,
+  uint32_t cpu_self
+)
+{
+  Watchdog_Control *watchdog = &ctx->watchdogs[cpu_self];
+  uint32_t cpu_arm;
+
+  _Atomic_Store_uint(&ctx->fired[cpu_self], 0, ATOMIC_ORDER_RELAXED);
+
+  _Watchdog_Initialize(watchdog, fired, 0, &ctx->fired[cpu_self]);
+  insert_watchdog(watchdog, 1, &cpu_arm);
+
+  /*
+   * The watchdog may expire on any processor, but it must use the watchdogs
+   * of the arming processor.
+   */
+  rtems_test_assert(
+    watchdog->sync == &_Per_CPU_Get_by_index(cpu_arm)->Watchdog_ticks->Sync
+  );
+
+  while (
+    _Atomic_Load_uint(&ctx->fired[cpu_self], ATOMIC_ORDER_ACQUIRE) == 0
+  ) {
+    /* Wait */
+  }
+
+  rtems_test_assert(!_Watchdog_Is_active(watchdog));
+}
+
+static void arm_load_watchdogs(test_context *ctx, uint32_t cpu_self)
+{
+  int i;
+
+  for (i = 0; i < LOAD_TIMER_COUNT; ++i) {
+    Watchdog_Control *watchdog = &ctx->load_watchdogs[cpu_self][i];
+    uint32_t cpu_arm;
+
+    _Watchdog_Initialize(watchdog, never_fired, 0, NULL);
+    insert_watchdog(
+      watchdog,
+      (Watchdog_Interval) (1000000 + i * 1000),
+      &cpu_arm
+    );
+  }
+}
+
+static void cancel_load_watchdogs(test_context *ctx, uint32_t cpu_self)
+{
+  int i;
+
+  for (i = 0; i < LOAD_TIMER_COUNT; ++i) {
+    Watchdog_States state = _Watchdog_Remove(
+      &ctx->load_watchdogs[cpu_self][i]
+    );
+    rtems_test_assert(state == WATCHDOG_ACTIVE);
+  }
+}
+
+static void test_arm_and_cancel(
+  test_context *ctx,
+  uint32_t active,
+  uint32_t cpu_self
+)
+{
+  unsigned long counter = 0;
+  Watchdog_Control *watchdog = &ctx->watchdogs[cpu_self];
+
+  _Watchdog_Initialize(watchdog, never_fired, 0, NULL);
+
+  wait_for_state(ctx, START_TEST);
+
+  if (cpu_self < active) {
+    while (assert_state(ctx, START_TEST)) {
+      Watchdog_States state;
+      uint32_t cpu_arm;
+
+      insert_watchdog(watchdog, 500000, &cpu_arm);
+
+      state = _Watchdog_Remove(watchdog);
+      rtems_test_assert(state == WATCHDOG_ACTIVE);
+
+      ++counter;
+    }
+  }
+
+  ctx->counter[active - 1][cpu_self] = counter;
+}
+
+static void run_tests(
+  test_context *ctx,
+  SMP_barrier_State *bs,
+  uint32_t cpu_count,
+  uint32_t cpu_self,
+  bool master
+)
+{
+  uint32_t active;
+
+  _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+
+  test_insert_on_arming_processor(ctx, cpu_self);
+  arm_load_watchdogs(ctx, cpu_self);
+
+  for (active = 1; active <= cpu_count; ++active) {
+    _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+
+    if (master) {
+      rtems_status_code sc = rtems_timer_fire_after(
+        ctx->stop_timer_id,
+        ctx->duration,
+        stop_test_timer,
+        ctx
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      _Atomic_Store_uint(&ctx->state, START_TEST, ATOMIC_ORDER_RELEASE);
+    }
+
+    test_arm_and_cancel(ctx, active, cpu_self);
+
+    _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+  }
+
+  cancel_load_watchdogs(ctx, cpu_self);
+
+  _SMP_barrier_Wait(&ctx->barrier, bs, cpu_count);
+}
+
+static void task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_get_processor_count();
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+  rtems_status_code sc;
+
+  run_tests(ctx, &bs, cpu_count, (uint32_t) arg, false);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_timer(rtems_id *id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_get_processor_count();
+  uint32_t cpu;
+  uint32_t active;
+  rtems_status_code sc;
+  SMP_barrier_State bs = SMP_BARRIER_STATE_INITIALIZER;
+
+  ctx->duration = rtems_clock_get_ticks_per_second();
+
+  create_timer(&ctx->stop_timer_id);
+
+  /* The Init task uses the context slot zero */
+  for (cpu = 1; cpu < cpu_count; ++cpu) {
+    rtems_id task_id;
+
+    sc = rtems_task_create(
+      rtems_build_name('T', 'A', 'S', 'K'),
+      TASK_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &task_id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(task_id, task, cpu);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  run_tests(ctx, &bs, cpu_count, 0, true);
+
+  printf("arm and cancel a watchdog with %i active watchdogs per task\n",
+    LOAD_TIMER_COUNT);
+
+  for (active = 1; active <= cpu_count; ++active) {
+    unsigned long sum = 0;
+
+    printf("\tactive processors %" PRIu32 "\n", active);
+
+    for (cpu = 0; cpu < active; ++cpu) {
+      unsigned long counter = ctx->counter[active - 1][cpu];
+
+      sum += counter;
+
+      printf("\t\ttask %" PRIu32 ", counter %lu\n", cpu, counter);
+    }
+
+    printf("\t\tsum of counter %lu\n", sum);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
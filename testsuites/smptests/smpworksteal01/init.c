@@ -0,0 +1,428 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPWORKSTEAL 1";
+
+#define SCHED_GLOBAL rtems_build_name('G', 'L', 'O', 'B')
+
+#define SCHED_STEAL rtems_build_name('S', 'T', 'E', 'A')
+
+#define CLUSTER_CPU_MAX 4
+
+#define WORKERS_PER_CPU 4
+
+#define WORKER_COUNT (WORKERS_PER_CPU * CLUSTER_CPU_MAX)
+
+#define INIT_PRIO 1
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#define WORKER_PRIO_BASE (INIT_PRIO + 1)
+
+#define WORKER_PRIO_COUNT 3
+
+#define MAX_DELAY_NS 20000
+
+typedef struct {
+  rtems_id id;
+  uint32_t iterations;
+  uint32_t migrations;
+} worker_context;
+
+typedef struct {
+  rtems_id sem;
+  volatile bool stop;
+  worker_context workers[WORKER_COUNT];
+  rtems_id busy_ids[CLUSTER_CPU_MAX];
+  volatile bool busy[CLUSTER_CPU_MAX];
+  volatile bool stop_busy;
+  rtems_id low_id;
+  volatile bool low_done;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t simple_random(uint32_t v)
+{
+  v *= 1664525;
+  v += 1013904223;
+
+  return v;
+}
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  worker_context *worker = &ctx->workers[arg];
+  uint32_t last_cpu = rtems_get_current_processor();
+  uint32_t v = (uint32_t) arg;
+
+  while (!ctx->stop) {
+    rtems_status_code sc;
+    uint32_t cpu;
+
+    v = simple_random(v);
+    rtems_counter_delay_nanoseconds(v % MAX_DELAY_NS);
+
+    /*
+     * The semaphore has less tokens than workers, so workers block and
+     * unblock frequently and processors run out of work now and then.
+     */
+    sc = rtems_semaphore_obtain(ctx->sem, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_counter_delay_nanoseconds(v % (MAX_DELAY_NS / 4));
+
+    sc = rtems_semaphore_release(ctx->sem);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    cpu = rtems_get_current_processor();
+    if (cpu != last_cpu) {
+      last_cpu = cpu;
+      ++worker->migrations;
+    }
+
+    ++worker->iterations;
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void busy_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->busy[arg] = true;
+
+  while (!ctx->stop_busy) {
+    /* Wait */
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void low_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  rtems_event_set events;
+
+  sc = rtems_event_receive(
+    RTEMS_EVENT_0,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->low_done = true;
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static uint32_t get_processor_count(rtems_id scheduler_id)
+{
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  CPU_ZERO(&cpuset);
+  sc = rtems_scheduler_get_processor_set(
+    scheduler_id,
+    sizeof(cpuset),
+    &cpuset
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return (uint32_t) CPU_COUNT(&cpuset);
+}
+
+static void run_load(
+  test_context *ctx,
+  rtems_name scheduler_name,
+  const char *description
+)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_id;
+  uint32_t cpu_count;
+  uint32_t worker_count;
+  uint32_t iterations;
+  uint32_t migrations;
+  uint32_t i;
+
+  sc = rtems_scheduler_ident(scheduler_name, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_count = get_processor_count(scheduler_id);
+  if (cpu_count == 0) {
+    printf("%s: no processors available\n", description);
+    return;
+  }
+
+  worker_count = WORKERS_PER_CPU * cpu_count;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('L', 'O', 'A', 'D'),
+    (cpu_count + 1) / 2,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->sem
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop = false;
+
+  for (i = 0; i < worker_count; ++i) {
+    worker_context *worker = &ctx->workers[i];
+
+    worker->iterations = 0;
+    worker->migrations = 0;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      WORKER_PRIO_BASE + (i % WORKER_PRIO_COUNT),
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &worker->id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(worker->id, scheduler_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(worker->id, worker_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_wake_after(rtems_clock_get_ticks_per_second());
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop = true;
+
+  /* Give the workers a chance to finish their current iteration */
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  iterations = 0;
+  migrations = 0;
+
+  for (i = 0; i < worker_count; ++i) {
+    worker_context *worker = &ctx->workers[i];
+
+    sc = rtems_task_delete(worker->id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    iterations += worker->iterations;
+    migrations += worker->migrations;
+  }
+
+  sc = rtems_semaphore_delete(ctx->sem);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "%s: processors %" PRIu32 ", workers %" PRIu32
+      ", iterations %" PRIu32 ", migrations %" PRIu32 "\n",
+    description,
+    cpu_count,
+    worker_count,
+    iterations,
+    migrations
+  );
+}
+
+static rtems_id create_task(
+  rtems_id scheduler_id,
+  rtems_task_priority priority,
+  rtems_task_entry entry,
+  rtems_task_argument arg
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler(id, scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, entry, arg);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+/*
+ * Unblock a thread while all processors of the work stealing cluster execute
+ * more important threads.  The thread must wait in the ready set until a
+ * processor becomes available.
+ */
+static void test_all_processors_busy(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_id;
+  uint32_t cpu_count;
+  uint32_t i;
+
+  sc = rtems_scheduler_ident(SCHED_STEAL, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  cpu_count = get_processor_count(scheduler_id);
+  if (cpu_count == 0) {
+    return;
+  }
+
+  ctx->low_done = false;
+  ctx->low_id = create_task(scheduler_id, WORKER_PRIO_BASE + 1, low_task, 0);
+
+  /* Let the low priority task block on its event */
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop_busy = false;
+
+  for (i = 0; i < cpu_count; ++i) {
+    ctx->busy[i] = false;
+    ctx->busy_ids[i] =
+      create_task(scheduler_id, WORKER_PRIO_BASE, busy_task, i);
+  }
+
+  for (i = 0; i < cpu_count; ++i) {
+    while (!ctx->busy[i]) {
+      sc = rtems_task_wake_after(1);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  sc = rtems_event_send(ctx->low_id, RTEMS_EVENT_0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(!ctx->low_done);
+
+  ctx->stop_busy = true;
+
+  while (!ctx->low_done) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < cpu_count; ++i) {
+    sc = rtems_task_delete(ctx->busy_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->low_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  test_all_processors_busy(ctx);
+  run_load(ctx, SCHED_GLOBAL, "global fixed priority scheduler");
+  run_load(ctx, SCHED_STEAL, "work stealing scheduler");
+}
+
+#else /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void test(void)
+{
+  /* Nothing to do */
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS (2 * CLUSTER_CPU_MAX)
+
+#define CONFIGURE_MAXIMUM_PRIORITY 255
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_CONTEXT_PRIORITY_SMP(global, CONFIGURE_MAXIMUM_PRIORITY + 1);
+
+RTEMS_SCHEDULER_CONTEXT_WORK_STEALING_SMP(
+  steal,
+  CONFIGURE_SMP_MAXIMUM_PROCESSORS
+);
+
+#define CONFIGURE_SCHEDULER_CONTROLS \
+  RTEMS_SCHEDULER_CONTROL_PRIORITY_SMP(global, SCHED_GLOBAL), \
+  RTEMS_SCHEDULER_CONTROL_WORK_STEALING_SMP(steal, SCHED_STEAL)
+
+/*
+ * The first half of the processors uses the global scheduler, the second half
+ * uses the work stealing scheduler.
+ */
+#define CONFIGURE_SMP_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIO
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
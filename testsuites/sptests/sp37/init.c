@@ -160,9 +160,15 @@ static void test_isr_level( void )
 }
 
 #if defined(RTEMS_SMP) && defined(RTEMS_PROFILING)
+#if defined(RTEMS_SMP_MCS_LOCK)
+static const size_t lock_size =
+  offsetof( ISR_lock_Control, lock.mcs_lock.Stats.name )
+    + sizeof( ((ISR_lock_Control *) 0)->lock.mcs_lock.Stats.name );
+#else
 static const size_t lock_size =
   offsetof( ISR_lock_Control, lock.ticket_lock.Stats.name )
     + sizeof( ((ISR_lock_Control *) 0)->lock.ticket_lock.Stats.name );
+#endif
 #else
 static const size_t lock_size = sizeof( ISR_lock_Control );
 #endif
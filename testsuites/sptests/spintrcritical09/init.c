@@ -43,14 +43,22 @@ static rtems_timer_service_routine test_release_from_isr(
   void     *arg
 )
 {
-  Chain_Control *chain = &_Watchdog_Ticks_chain;
+#if defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+  Watchdog_Wheel *wheel = &_Watchdog_Ticks_get()->Wheel;
+  Chain_Control *chain =
+    &wheel->Root[ wheel->current & WATCHDOG_WHEEL_ROOT_MASK ];
+#else
+  Chain_Control *chain = &_Watchdog_Ticks_get()->Chain;
+#endif
 
   if ( !_Chain_Is_empty( chain ) ) {
     Watchdog_Control *watchdog = _Watchdog_First( chain );
 
     if (
-      watchdog->delta_interval == 0
-        && watchdog->routine == _Thread_queue_Timeout
+#if !defined(RTEMS_WATCHDOG_TIMING_WHEEL)
+      watchdog->delta_interval == 0 &&
+#endif
+        watchdog->routine == _Thread_queue_Timeout
     ) {
       Watchdog_States state = _Watchdog_Remove( watchdog );
 
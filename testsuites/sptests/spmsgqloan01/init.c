@@ -0,0 +1,360 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQLOAN 1";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 64
+
+#define INIT_PRIORITY 2
+
+#define RECEIVER_PRIORITY 1
+
+typedef struct {
+  rtems_id queue;
+  rtems_id receiver;
+  bool zero_copy;
+  void *buffer;
+  size_t size;
+  char data[MESSAGE_SIZE];
+  volatile bool done;
+} test_context;
+
+static test_context test_instance;
+
+static void receiver(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  while (true) {
+    if (ctx->zero_copy) {
+      sc = rtems_message_queue_receive_buffer(
+        ctx->queue,
+        &ctx->buffer,
+        &ctx->size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    } else {
+      sc = rtems_message_queue_receive(
+        ctx->queue,
+        &ctx->data[0],
+        &ctx->size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    }
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ctx->done = true;
+  }
+}
+
+static void test_errors(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  size_t size;
+  char data;
+
+  sc = rtems_message_queue_obtain_buffer(ctx->queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_obtain_buffer(0, &buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    NULL,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  /* Buffers not on loan must be rejected */
+  sc = rtems_message_queue_send_buffer(ctx->queue, &data, sizeof(data));
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, &data);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_obtain_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release_buffer(
+    ctx->queue,
+    (char *) buffer + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->queue,
+    buffer,
+    MESSAGE_SIZE + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Double release */
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+}
+
+static void test_pool(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+  uint32_t count;
+  size_t size;
+  int i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_obtain_buffer(ctx->queue, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_obtain_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  /* The buffers on loan occupy the pending message slots */
+  sc = rtems_message_queue_send(ctx->queue, &ctx->data[0], 1);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    memset(buffers[i], 'a' + i, MESSAGE_SIZE);
+
+    sc = rtems_message_queue_send_buffer(
+      ctx->queue,
+      buffers[i],
+      (size_t) (i + 1)
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_get_number_pending(ctx->queue, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == MESSAGE_COUNT);
+
+  /* The first message is received by copy */
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    &ctx->data[0],
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 1);
+  rtems_test_assert(ctx->data[0] == 'a');
+
+  /* The second message is received in place */
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(buffer == buffers[1]);
+  rtems_test_assert(size == 2);
+  rtems_test_assert(memcmp(buffer, "bb", 2) == 0);
+
+  sc = rtems_message_queue_get_number_pending(ctx->queue, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == 0);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* All buffers are available again */
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_obtain_buffer(ctx->queue, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_release_buffer(ctx->queue, buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_waiting_receiver(test_context *ctx, bool zero_copy)
+{
+  rtems_status_code sc;
+  void *buffer;
+
+  ctx->zero_copy = zero_copy;
+  ctx->done = false;
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'C', 'V'),
+    RECEIVER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->receiver
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The receiver preempts us and blocks on the empty message queue */
+  sc = rtems_task_start(ctx->receiver, receiver, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(!ctx->done);
+
+  sc = rtems_message_queue_obtain_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(buffer, 'x', MESSAGE_SIZE);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->done);
+  rtems_test_assert(ctx->size == 3);
+
+  if (zero_copy) {
+    rtems_test_assert(ctx->buffer == buffer);
+
+    sc = rtems_message_queue_release_buffer(ctx->queue, ctx->buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    rtems_test_assert(memcmp(&ctx->data[0], "xxx", 3) == 0);
+
+    /* The message buffer was returned to the message queue */
+    sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+    rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+  }
+
+  /* The zero-copy receiver gets a copy of messages sent the usual way */
+  if (zero_copy) {
+    ctx->done = false;
+
+    sc = rtems_message_queue_send(ctx->queue, "yy", 2);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(ctx->done);
+    rtems_test_assert(ctx->size == 2);
+    rtems_test_assert(memcmp(ctx->buffer, "yy", 2) == 0);
+
+    sc = rtems_message_queue_release_buffer(ctx->queue, ctx->buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->receiver);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_single_producer_single_consumer(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  void *buffer;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('S', 'P', 'S', 'C'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_SINGLE_PRODUCER_SINGLE_CONSUMER,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_obtain_buffer(id, &buffer);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_message_queue_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_errors(ctx);
+  test_pool(ctx);
+  test_waiting_receiver(ctx, false);
+  test_waiting_receiver(ctx, true);
+  test_single_producer_single_consumer();
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 2
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  (2 * CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT + 1, MESSAGE_SIZE))
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
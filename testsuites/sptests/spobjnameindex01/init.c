@@ -0,0 +1,175 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPOBJNAMEINDEX 1";
+
+#define ALLOCATION_SIZE 4
+
+#define SEMAPHORE_COUNT (4 * ALLOCATION_SIZE + 1)
+
+static rtems_id semaphores[SEMAPHORE_COUNT];
+
+static rtems_name name_of(int i)
+{
+  return rtems_build_name('S', '0' + (i / 10), '0' + (i % 10), ' ');
+}
+
+static rtems_id create(rtems_name name)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_create(
+    name,
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void destroy(rtems_id id)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_status_code ident(rtems_name name, rtems_id *id)
+{
+  return rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, id);
+}
+
+static void test_create_and_ident(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  int i;
+
+  /* This extends the object information several times */
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    semaphores[i] = create(name_of(i));
+  }
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    sc = ident(name_of(i), &id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(id == semaphores[i]);
+  }
+
+  sc = ident(rtems_build_name('N', 'O', 'N', 'E'), &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+}
+
+static void test_duplicate_names(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  /* The object with the lowest index wins, like in a linear search */
+  sc = rtems_object_set_name(semaphores[7], "S01 ");
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = ident(name_of(1), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == semaphores[1]);
+
+  sc = ident(name_of(7), &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  destroy(semaphores[1]);
+
+  sc = ident(name_of(1), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == semaphores[7]);
+
+  sc = rtems_object_set_name(semaphores[7], "S07 ");
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = ident(name_of(7), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == semaphores[7]);
+
+  sc = ident(name_of(1), &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  semaphores[1] = create(name_of(1));
+
+  sc = ident(name_of(1), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == semaphores[1]);
+}
+
+static void test_delete(void)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  int i;
+
+  for (i = 0; i < SEMAPHORE_COUNT; i += 2) {
+    destroy(semaphores[i]);
+  }
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    sc = ident(name_of(i), &id);
+
+    if (i % 2 == 0) {
+      rtems_test_assert(sc == RTEMS_INVALID_NAME);
+    } else {
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      rtems_test_assert(id == semaphores[i]);
+    }
+  }
+
+  for (i = 1; i < SEMAPHORE_COUNT; i += 2) {
+    destroy(semaphores[i]);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_create_and_ident();
+  test_duplicate_names();
+  test_delete();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_OBJECT_NAME_INDEX
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited(ALLOCATION_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
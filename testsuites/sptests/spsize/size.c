@@ -401,10 +401,11 @@ uninitialized =
 
 /*userext.h*/   (sizeof _User_extensions_List)            +
 
-/*watchdog.h*/  (sizeof _Watchdog_Sync_level)             +
-                (sizeof _Watchdog_Sync_count)             +
+/*watchdog.h*/  (sizeof _Watchdog_Sync)                   +
                 (sizeof _Watchdog_Ticks_since_boot)       +
-                (sizeof _Watchdog_Ticks_chain)            +
+#if !defined(RTEMS_SMP)
+                (sizeof *_Watchdog_Ticks_get())           +
+#endif
                 (sizeof _Watchdog_Seconds_chain)          +
 
 /*wkspace.h*/   (sizeof _Workspace_Area);
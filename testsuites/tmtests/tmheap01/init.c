@@ -0,0 +1,211 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 63
+
+#define BLOCK_COUNT 2048
+
+#define MAXIMUM_FREE_BLOCKS (BLOCK_COUNT / 2)
+
+#define HEAP_AREA_SIZE (512 * 1024)
+
+#define ALIGNMENT 64
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+static rtems_counter_ticks t_alloc[SAMPLES];
+
+static rtems_counter_ticks t_alloc_aligned[SAMPLES];
+
+static Heap_Control test_heap;
+
+/*
+ * The last block separates the fragments from the free block at the end of the
+ * heap area.
+ */
+static void *blocks[BLOCK_COUNT + 1];
+
+static char heap_area[HEAP_AREA_SIZE] CPU_STRUCTURE_ALIGNMENT;
+
+/*
+ * The fragments are smaller than the measured allocations, so that the first
+ * fit method has to visit all of them.
+ */
+static uintptr_t fragment_size(uint32_t i)
+{
+  return 16 + ((i * 7919) % 13) * 8;
+}
+
+static uintptr_t measured_size(int s)
+{
+  return 256 + (s % 8) * 64;
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void print_samples(const char *name, rtems_counter_ticks *t)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+
+  printf(
+    "      <%s>"
+      "<Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t[0]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES / 2]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES - 1]),
+    name
+  );
+}
+
+static void test_by_free_blocks(Heap_Control *heap, uint32_t free_blocks)
+{
+  int s;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    void *p;
+    bool ok;
+
+    a = rtems_counter_read();
+    p = _Heap_Allocate(heap, measured_size(s));
+    b = rtems_counter_read();
+    rtems_test_assert(p != NULL);
+
+    ok = _Heap_Free(heap, p);
+    rtems_test_assert(ok);
+
+    t_alloc[s] = rtems_counter_difference(b, a);
+
+    a = rtems_counter_read();
+    p = _Heap_Allocate_aligned(heap, measured_size(s), ALIGNMENT);
+    b = rtems_counter_read();
+    rtems_test_assert(p != NULL);
+    rtems_test_assert(((uintptr_t) p % ALIGNMENT) == 0);
+
+    ok = _Heap_Free(heap, p);
+    rtems_test_assert(ok);
+
+    t_alloc_aligned[s] = rtems_counter_difference(b, a);
+  }
+
+  printf("    <Sample freeBlocks=\"%" PRIu32 "\">\n", free_blocks);
+  print_samples("Allocate", t_alloc);
+  print_samples("AllocateAligned", t_alloc_aligned);
+  printf("    </Sample>\n");
+}
+
+static void test_policy(const char *name, bool segregated)
+{
+  Heap_Control *heap = &test_heap;
+  uintptr_t size;
+  uint32_t free_blocks = 0;
+  uint32_t next = 0;
+  uint32_t i;
+  bool ok;
+
+  size = _Heap_Initialize(heap, &heap_area[0], sizeof(heap_area), 0);
+  rtems_test_assert(size > 0);
+
+  if (segregated) {
+    ok = _Heap_Enable_segregated_fit(heap);
+    rtems_test_assert(ok);
+  }
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(blocks); ++i) {
+    blocks[i] = _Heap_Allocate(heap, fragment_size(i));
+    rtems_test_assert(blocks[i] != NULL);
+  }
+
+  printf("  <HeapAllocateTest policy=\"%s\">\n", name);
+
+  /*
+   * Free every second block, so that the fragments cannot be coalesced.  The
+   * remaining free block at the end of the heap area satisfies the measured
+   * allocations.
+   */
+  while (free_blocks <= MAXIMUM_FREE_BLOCKS) {
+    if (free_blocks == next) {
+      test_by_free_blocks(heap, free_blocks);
+      next = next == 0 ? 1 : 2 * next;
+    }
+
+    if (free_blocks == MAXIMUM_FREE_BLOCKS) {
+      break;
+    }
+
+    ok = _Heap_Free(heap, blocks[2 * free_blocks + 1]);
+    rtems_test_assert(ok);
+    blocks[2 * free_blocks + 1] = NULL;
+
+    ++free_blocks;
+    rtems_test_assert(heap->stats.free_blocks == free_blocks + 1);
+  }
+
+  printf("  </HeapAllocateTest>\n");
+
+  ok = _Heap_Walk(heap, 0, false);
+  rtems_test_assert(ok);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(blocks); ++i) {
+    ok = _Heap_Free(heap, blocks[i]);
+    rtems_test_assert(ok);
+  }
+
+  ok = _Heap_Walk(heap, 0, false);
+  rtems_test_assert(ok);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  printf("<Test>\n");
+  test_policy("FirstFit", false);
+  test_policy("SegregatedFit", true);
+  printf("</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
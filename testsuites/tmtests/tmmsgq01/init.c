@@ -0,0 +1,231 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 63
+
+#define MESSAGE_SIZE 16
+
+#define INIT_PRIORITY 250
+
+#define RECEIVER_PRIORITY 125
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+typedef struct {
+  rtems_id queue;
+  rtems_id receiver;
+  volatile rtems_counter_ticks send_begin;
+  volatile rtems_counter_ticks receive_end;
+  rtems_counter_ticks t_send[SAMPLES];
+  rtems_counter_ticks t_receive[SAMPLES];
+  rtems_counter_ticks t_wake_up[SAMPLES];
+} test_context;
+
+static test_context test_instance;
+
+static void receiver(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    char buf[MESSAGE_SIZE];
+    size_t size;
+
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      &buf[0],
+      &size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    ctx->receive_end = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(size == MESSAGE_SIZE);
+  }
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void print_samples(const char *name, rtems_counter_ticks *t)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+
+  printf(
+    "      <%s>"
+      "<Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t[0]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES / 2]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES - 1]),
+    name
+  );
+}
+
+static void test_not_blocked(test_context *ctx)
+{
+  char buf[MESSAGE_SIZE];
+  int s;
+
+  memset(&buf[0], 0, sizeof(buf));
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_status_code sc;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+    size_t size;
+
+    a = rtems_counter_read();
+    sc = rtems_message_queue_send(ctx->queue, &buf[0], sizeof(buf));
+    b = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      &buf[0],
+      &size,
+      RTEMS_NO_WAIT,
+      0
+    );
+    c = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(size == sizeof(buf));
+
+    ctx->t_send[s] = rtems_counter_difference(b, a);
+    ctx->t_receive[s] = rtems_counter_difference(c, b);
+  }
+
+  print_samples("Send", ctx->t_send);
+  print_samples("Receive", ctx->t_receive);
+}
+
+static void test_blocked(test_context *ctx)
+{
+  rtems_status_code sc;
+  char buf[MESSAGE_SIZE];
+  int s;
+
+  memset(&buf[0], 0, sizeof(buf));
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'C', 'V'),
+    RECEIVER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->receiver
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The receiver preempts us and blocks on the empty message queue */
+  sc = rtems_task_start(ctx->receiver, receiver, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_counter_ticks a;
+
+    /*
+     * The send unblocks the receiver which preempts us immediately.  It
+     * blocks again on the message queue before we continue.
+     */
+    a = rtems_counter_read();
+    sc = rtems_message_queue_send(ctx->queue, &buf[0], sizeof(buf));
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ctx->t_wake_up[s] = rtems_counter_difference(ctx->receive_end, a);
+  }
+
+  sc = rtems_task_delete(ctx->receiver);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  print_samples("WakeUp", ctx->t_wake_up);
+}
+
+static void test(
+  test_context *ctx,
+  rtems_attribute attribute_set,
+  const char *name
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    1,
+    MESSAGE_SIZE,
+    attribute_set,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("    <Sample queue=\"%s\">\n", name);
+  test_not_blocked(ctx);
+  test_blocked(ctx);
+  printf("    </Sample>\n");
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  printf("<Test>\n  <MessageQueueTest>\n");
+
+  test(ctx, RTEMS_DEFAULT_ATTRIBUTES, "regular");
+  test(ctx, RTEMS_SINGLE_PRODUCER_SINGLE_CONSUMER, "SPSC");
+
+  printf("  </MessageQueueTest>\n</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(2, MESSAGE_SIZE)
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,231 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 63
+
+#define MESSAGE_SIZE 16
+
+#define BATCH_MAX 64
+
+#define INIT_PRIORITY 250
+
+const char rtems_test_name[] = "TMMSGQ 2";
+
+typedef struct {
+  rtems_id queue;
+  char buf[BATCH_MAX * MESSAGE_SIZE];
+  size_t sizes[BATCH_MAX];
+  rtems_counter_ticks t_send[SAMPLES];
+  rtems_counter_ticks t_receive[SAMPLES];
+  rtems_counter_ticks t_send_many[SAMPLES];
+  rtems_counter_ticks t_receive_many[SAMPLES];
+} test_context;
+
+static test_context test_instance;
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+/*
+ * Prints the statistics of the time per message.
+ */
+static void print_samples(
+  const char *name,
+  rtems_counter_ticks *t,
+  uint32_t batch_size
+)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+
+  printf(
+    "      <%s>"
+      "<Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t[0]) / batch_size,
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES / 2]) / batch_size,
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES - 1]) / batch_size,
+    name
+  );
+}
+
+static void test_single(test_context *ctx, uint32_t batch_size, int s)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks c;
+  uint32_t i;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < batch_size; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_message_queue_send(
+      ctx->queue,
+      &ctx->buf[i * MESSAGE_SIZE],
+      MESSAGE_SIZE
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  b = rtems_counter_read();
+
+  for (i = 0; i < batch_size; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      &ctx->buf[i * MESSAGE_SIZE],
+      &ctx->sizes[i],
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  c = rtems_counter_read();
+
+  ctx->t_send[s] = rtems_counter_difference(b, a);
+  ctx->t_receive[s] = rtems_counter_difference(c, b);
+}
+
+static void test_many(test_context *ctx, uint32_t batch_size, int s)
+{
+  rtems_status_code sc;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks c;
+  uint32_t count;
+  uint32_t i;
+
+  for (i = 0; i < batch_size; ++i) {
+    ctx->sizes[i] = MESSAGE_SIZE;
+  }
+
+  a = rtems_counter_read();
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    &ctx->buf[0],
+    &ctx->sizes[0],
+    batch_size,
+    &count
+  );
+  b = rtems_counter_read();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == batch_size);
+
+  sc = rtems_message_queue_receive_many(
+    ctx->queue,
+    &ctx->buf[0],
+    &ctx->sizes[0],
+    BATCH_MAX,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  c = rtems_counter_read();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == batch_size);
+
+  for (i = 0; i < batch_size; ++i) {
+    rtems_test_assert(ctx->sizes[i] == MESSAGE_SIZE);
+  }
+
+  ctx->t_send_many[s] = rtems_counter_difference(b, a);
+  ctx->t_receive_many[s] = rtems_counter_difference(c, b);
+}
+
+static void test(test_context *ctx, uint32_t batch_size)
+{
+  int s;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    test_single(ctx, batch_size, s);
+    test_many(ctx, batch_size, s);
+  }
+
+  printf("    <Sample batchSize=\"%" PRIu32 "\">\n", batch_size);
+  print_samples("Send", ctx->t_send, batch_size);
+  print_samples("Receive", ctx->t_receive, batch_size);
+  print_samples("SendMany", ctx->t_send_many, batch_size);
+  print_samples("ReceiveMany", ctx->t_receive_many, batch_size);
+  printf("    </Sample>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  uint32_t batch_size;
+
+  TEST_BEGIN();
+
+  memset(&ctx->buf[0], 0, sizeof(ctx->buf));
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    BATCH_MAX,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<Test>\n  <MessageQueueBatchTest>\n");
+
+  for (batch_size = 1; batch_size <= BATCH_MAX; batch_size *= 2) {
+    test(ctx, batch_size);
+  }
+
+  printf("  </MessageQueueBatchTest>\n</Test>\n");
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(BATCH_MAX, MESSAGE_SIZE)
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
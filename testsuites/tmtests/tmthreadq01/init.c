@@ -0,0 +1,203 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 63
+
+#define MAXIMUM_WAITERS 1024
+
+#define INIT_PRIORITY 250
+
+#define MEASURED_PRIORITY 125
+
+const char rtems_test_name[] = "TMTHREADQ 1";
+
+static rtems_counter_ticks t_block[SAMPLES];
+
+static volatile rtems_counter_ticks block_begin;
+
+static rtems_id semaphore;
+
+static rtems_id measured_task;
+
+static void waiter(rtems_task_argument arg)
+{
+  rtems_semaphore_obtain(semaphore, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(0);
+}
+
+static void measured(rtems_task_argument arg)
+{
+  block_begin = rtems_counter_read();
+  rtems_semaphore_obtain(semaphore, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(0);
+}
+
+/*
+ * Spread the priorities of the waiting tasks so that the measured task must
+ * be placed somewhere in between them.  All waiting tasks have a higher
+ * priority than the Init task, so they block on the semaphore once started.
+ */
+static rtems_task_priority waiter_priority(uint32_t i)
+{
+  return 3 + (i * 7919) % (INIT_PRIORITY - 5);
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void print_samples(const char *name, rtems_counter_ticks *t)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+
+  printf(
+    "      <%s>"
+      "<Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t[0]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES / 2]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES - 1]),
+    name
+  );
+}
+
+static void test_by_waiters(uint32_t waiters)
+{
+  int s;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_status_code sc;
+    rtems_counter_ticks b;
+
+    /*
+     * The restart extracts the measured task from the semaphore wait queue
+     * if necessary.  It immediately preempts the Init task and blocks on the
+     * semaphore again.
+     */
+    sc = rtems_task_restart(measured_task, 0);
+    b = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    t_block[s] = rtems_counter_difference(b, block_begin);
+  }
+
+  printf("    <Sample waiters=\"%" PRIu32 "\">\n", waiters);
+  print_samples("Block", t_block);
+  printf("    </Sample>\n");
+}
+
+static bool add_waiter(uint32_t i)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'A', 'I', 'T'),
+    waiter_priority(i),
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    return false;
+  }
+
+  sc = rtems_task_start(id, waiter, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return true;
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  uint32_t waiters = 0;
+  uint32_t next = 0;
+
+  TEST_BEGIN();
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'E', 'M', 'A'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &semaphore
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('M', 'E', 'A', 'S'),
+    MEASURED_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &measured_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(measured_task, measured, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<Test>\n  <ThreadQueueEnqueuePriorityTest>\n");
+
+  while (waiters <= MAXIMUM_WAITERS) {
+    if (waiters == next) {
+      test_by_waiters(waiters);
+      next = next == 0 ? 1 : 2 * next;
+    }
+
+    if (waiters == MAXIMUM_WAITERS || !add_waiter(waiters)) {
+      break;
+    }
+
+    ++waiters;
+  }
+
+  printf("  </ThreadQueueEnqueuePriorityTest>\n</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS rtems_resource_unlimited(32)
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY INIT_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
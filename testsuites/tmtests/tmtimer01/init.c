@@ -0,0 +1,169 @@
+/*
+ *  COPYRIGHT (c) 2014.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.org/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "tmacros.h"
+
+#define SAMPLES 63
+
+#define MAXIMUM_ACTIVE_TIMERS 16384
+
+const char rtems_test_name[] = "TMTIMER 1";
+
+static rtems_counter_ticks t_fire[SAMPLES];
+
+static rtems_counter_ticks t_cancel[SAMPLES];
+
+static rtems_id timers[MAXIMUM_ACTIVE_TIMERS];
+
+static rtems_id measured_timer;
+
+static rtems_timer_service_routine never_fired(rtems_id id, void *arg)
+{
+  rtems_test_assert(0);
+}
+
+/*
+ * Spread the intervals of the active timers so that the measured timer must
+ * be placed somewhere in between them.  The intervals are far in the future
+ * so that no timer fires during the test.
+ */
+static rtems_interval active_interval(uint32_t i)
+{
+  return 1000000 + (i * 7919) % 1000000;
+}
+
+static int cmp(const void *ap, const void *bp)
+{
+  const rtems_counter_ticks *a = ap;
+  const rtems_counter_ticks *b = bp;
+
+  return *a - *b;
+}
+
+static void print_samples(const char *name, rtems_counter_ticks *t)
+{
+  qsort(&t[0], SAMPLES, sizeof(t[0]), cmp);
+
+  printf(
+    "      <%s>"
+      "<Min unit=\"ns\">%" PRIu64 "</Min>"
+      "<Q2 unit=\"ns\">%" PRIu64 "</Q2>"
+      "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(t[0]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES / 2]),
+    rtems_counter_ticks_to_nanoseconds(t[SAMPLES - 1]),
+    name
+  );
+}
+
+static void test_by_active_timers(uint32_t active)
+{
+  int s;
+
+  for (s = 0; s < SAMPLES; ++s) {
+    rtems_status_code sc;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks c;
+
+    a = rtems_counter_read();
+    sc = rtems_timer_fire_after(
+      measured_timer,
+      active_interval(active + s),
+      never_fired,
+      NULL
+    );
+    b = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_timer_cancel(measured_timer);
+    c = rtems_counter_read();
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    t_fire[s] = rtems_counter_difference(b, a);
+    t_cancel[s] = rtems_counter_difference(c, b);
+  }
+
+  printf("    <Sample activeTimers=\"%" PRIu32 "\">\n", active);
+  print_samples("FireAfter", t_fire);
+  print_samples("Cancel", t_cancel);
+  printf("    </Sample>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  uint32_t active = 0;
+  uint32_t next = 0;
+
+  TEST_BEGIN();
+
+  sc = rtems_timer_create(rtems_build_name('M', 'E', 'A', 'S'), &measured_timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<Test>\n  <TimerInsertTest>\n");
+
+  while (active <= MAXIMUM_ACTIVE_TIMERS) {
+    if (active == next) {
+      test_by_active_timers(active);
+      next = next == 0 ? 1 : 2 * next;
+    }
+
+    if (active == MAXIMUM_ACTIVE_TIMERS) {
+      break;
+    }
+
+    sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &timers[active]);
+    if (sc != RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    sc = rtems_timer_fire_after(
+      timers[active],
+      active_interval(active),
+      never_fired,
+      NULL
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++active;
+  }
+
+  printf("  </TimerInsertTest>\n</Test>\n");
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS rtems_resource_unlimited(32)
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>